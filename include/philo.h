@@ -19,10 +19,16 @@
  # include <unistd.h>
  # include <stdio.h>
  # include <stdlib.h>
+ # include <string.h>
  # include <stdbool.h>
  # include <limits.h>
  # include <errno.h>
  # include <sys/time.h>
+ # include <time.h>
+ # include <linux/io_uring.h>
+ # include "philo_trace.h"
+ # include "philo_shm.h"
+ # include "philo_live.h"
  
  /**
   * @defgroup philosopher_core Philosopher Core
@@ -35,6 +41,45 @@
   * @{
   */
  
+ /**
+  * @typedef t_tab
+  * @brief What one philosopher went through, for `--report`.
+  *
+  * @details
+  * Written by the philosopher's own thread only, and read once it is
+  * joined. Hunger is counted from one `last_meal` to the next, as the
+  * monitor sees it. Fork waits and naps are only timed while the report
+  * or `--io-stats` is selected; a nap cut short by the end of the dinner
+  * is not counted.
+  */
+ typedef struct s_tab
+ {
+	 long long		hunger_max;      ///< Longest wait for a meal (ms)
+	 long long		fork_wait;       ///< Time spent waiting for forks (ns)
+	 long long		fork_wait_max;   ///< Longest wait for both forks (ns)
+	 long long		meals_timed;     ///< Fork waits measured
+	 long long		naps;            ///< Naps measured
+	 long long		oversleep;       ///< Time slept past the request (ns)
+	 long long		oversleep_max;   ///< Longest single overrun (ns)
+ }					t_tab;
+ 
+ /**
+  * @typedef t_timing
+  * @brief One version of the timings, as published by `--control`.
+  *
+  * @details
+  * Never changed once published; each version links the one it replaced.
+  * A philosopher's own timings from `--scenario` use the same type, with
+  * -1 for the values it shares with the table.
+  */
+ typedef struct s_timing
+ {
+	 int				time_to_die;        ///< Time until a philosopher dies
+	 int				time_to_eat;        ///< Time spent eating
+	 int				time_to_sleep;      ///< Time spent sleeping
+	 struct s_timing	*previous;          ///< Version replaced, or NULL
+ }					t_timing;
+ 
  /**
   * @typedef t_philo
   * @brief Represents a single philosopher in the simulation.
@@ -46,8 +91,16 @@
   * - `left_fork`: Index of the left fork.
   * - `right_fork`: Index of the right fork.
   * - `last_meal`: Timestamp of the last meal in milliseconds.
+  * - `events`: Number of actions performed, counted even when not logged.
+  * - `seat`: Whether the seat is empty, taken, or was left (`--seats`).
+  * - `hold`, `dining`: Handshake with `--control` while the ring is
+  *   being re-linked around the philosopher (see ushers.c).
+  * - `own`: Timings of its own, from `--scenario`.
+  * - `draw`: Seed of the bottles it wants this session (`--drinking`).
+  * - `tab`: Hunger, fork wait and sleep figures for the report.
   * - `table`: Pointer to the shared table structure.
   * - `thread`: Thread handle running this philosopher's routine.
+  * - `room`: Its process instead, with `--processes`.
   */
  typedef struct s_philo
  {
@@ -56,10 +109,229 @@
 	 int				left_fork;       ///< Index of the left fork
 	 int				right_fork;      ///< Index of the right fork
 	 long long		last_meal;       ///< Last meal timestamp
+	 long			events;          ///< Actions performed, logged or not
+	 int				seat;            ///< One of the SEAT_* states
+	 long long		hold;            ///< Ticket asking it to park, or 0
+	 bool			dining;          ///< Taking or holding its forks
+	 t_timing		own;             ///< `--scenario` timings, -1 if shared
+	 uint64_t		draw;            ///< `--drinking`: this session's draw
+	 t_tab			tab;             ///< Figures for `--report`
 	 struct s_table	*table;          ///< Pointer to shared table
 	 pthread_t		thread;          ///< Associated thread
+	 pid_t			room;            ///< Its process with `--processes`
  }					t_philo;
  
+ /**
+  * @typedef t_order
+  * @brief One action to log, as handed to `print_order`.
+  *
+  * @details
+  * `when` is read when the action happens, before the print lock is asked
+  * for; `print_order` replaces it with the time actually logged.
+  */
+ typedef struct s_order
+ {
+	 const char		*action;         ///< Action macro (TAKE, EAT, ...)
+	 int				fork;            ///< Fork index for TAKE, -1 otherwise
+	 long long		when;            ///< Time of the event (ms)
+ }					t_order;
+ 
+ /**
+  * @typedef t_slip
+  * @brief One message about a border fork on a `--link`.
+  *
+  * @details
+  * `kind` is SLIP_ASK or SLIP_RETURN from the philosopher using the fork
+  * across the border, SLIP_GRANT from the porter keeping it. `sent` is
+  * when the slip was written, on the monotonic clock every process of the
+  * host shares.
+  */
+ typedef struct s_slip
+ {
+	 int				kind;            ///< One of the SLIP_* messages
+	 int				fork;            ///< Fork index
+	 long long		sent;            ///< When it was sent (ns)
+ }					t_slip;
+ 
+ /**
+  * @typedef t_menu
+  * @brief Optional run modes chosen on the command line.
+  *
+  * @details
+  * Filled by `read_menu` from the `--name=value` options that may precede
+  * the positional arguments. The defaults reproduce the classic behavior.
+  */
+ typedef struct s_menu
+ {
+	 int				format;             ///< One of the FORMAT_* output modes
+	 int				run_for;            ///< Wall time limit (ms), 0 for none
+	 bool			io_stats;           ///< Report print timings on stderr
+	 int				writer;             ///< One of the WRITER_* backends
+	 const char		*shm_name;          ///< Object name for `--format=shm`
+	 const char		*report;            ///< JSON report path or fd, or NULL
+	 const char		*samples;           ///< Sample file path or fd, or NULL
+	 const char		*live;              ///< `--live` object name, or NULL
+	 const char		*metrics;           ///< `--metrics` socket path, or NULL
+	 const char		*control;           ///< `--control` socket path, or NULL
+	 int				sample_every;       ///< Sampling interval (ms)
+	 int				sample_format;      ///< One of the SAMPLE_* line formats
+	 int				seats;              ///< `--seats` count, 0 for a fixed ring
+	 const char		*scenario;          ///< `--scenario` file, or NULL
+	 const char		*graph;             ///< `--graph` file, or NULL
+	 int				drinking;           ///< `--drinking` percent, 0 for forks
+	 unsigned int	seed;               ///< `--seed` of the draws
+	 int				tables;             ///< `--tables` count, 1 by default
+	 bool			processes;          ///< Philosophers in processes
+	 int				workers;            ///< `--workers` count, 0 for one each
+	 int				link;               ///< One of the LINK_* transports
+	 int				link_delay;         ///< `--link-delay` per slip (us)
+ }					t_menu;
+ 
+ /**
+  * @typedef t_ledger
+  * @brief Measurements kept while `--io-stats` is selected.
+  *
+  * @details
+  * Print figures are updated under `pass_padlock`, the margin by the
+  * monitor under `eat_padlock`. The margin is how far any philosopher was
+  * from `time_to_die` when the monitor looked; negative means a death was
+  * detected that late. `contended`, `queue` and `passes` are kept whatever
+  * the options, with atomic updates, for `--samples` and `--metrics`. The
+  * reseat figures belong to the control thread.
+  */
+ typedef struct s_ledger
+ {
+	 long long		lines;              ///< Lines or records written
+	 long long		uses;               ///< Times print_padlock was taken
+	 long long		hold_total;         ///< Time print_padlock was held (ns)
+	 long long		hold_max;           ///< Longest single hold (ns)
+	 long long		wait_total;         ///< Time spent waiting for it (ns)
+	 long long		wait_max;           ///< Longest single wait (ns)
+	 long long		min_margin;         ///< Smallest time_to_die slack (ms)
+	 long long		lag_total;          ///< Event to print delays (ms)
+	 long long		lag_max;            ///< Longest one (ms)
+	 long long		last_call;          ///< Closing message latency (ns)
+	 long long		last_call_wait;     ///< Its print lock wait (ns)
+	 long long		contended;          ///< Fork and print locks found taken
+	 int				queue;              ///< Threads at the print lock
+	 long long		passes;             ///< Monitor passes over the table
+	 long long		reseats;            ///< Joins and leaves of `--control`
+	 long long		reseat_total;       ///< Time they took (ns)
+	 long long		reseat_max;         ///< Longest one (ns)
+ }					t_ledger;
+ 
+ /**
+  * @typedef t_scrape
+  * @brief The figures served by `--metrics`, as read at one scrape.
+  *
+  * @details
+  * The server keeps the previous scrape to turn counters into rates.
+  */
+ typedef struct s_scrape
+ {
+	 long long		at;                 ///< When it was taken (ms)
+	 long long		meals;              ///< Meals eaten so far
+	 long long		passes;             ///< Monitor passes so far
+	 long long		contended;          ///< Locks found taken so far
+	 long long		slack_min;          ///< Smallest margin right now (ms)
+	 int				queue;              ///< Threads at the print lock
+	 int				deaths;             ///< 1 once somebody died
+	 int				seated;             ///< Philosophers at the table
+ }					t_scrape;
+ 
+ /**
+  * @typedef t_clock
+  * @brief State of the dinner clock, which `--control` can stop.
+  *
+  * @details
+  * The dinner time is the time of day minus `lost`, never past `ceiling`,
+  * which is LLONG_MAX while the clock runs.
+  */
+ typedef struct s_clock
+ {
+	 long long		lost;               ///< Time spent stopped so far (ms)
+	 long long		ceiling;            ///< Time stopped at, or LLONG_MAX
+ }					t_clock;
+ 
+ /* === Output Writers === */
+ # define WRITER_STDIO	0
+ # define WRITER_WRITE	1
+ # define WRITER_URING	2
+ # define WRITER_SPLICE	3
+ # define TRAY_COUNT		8
+ # define TRAY_SIZE		65536
+ # define SPLICE_PIPE_SIZE	262144
+ 
+ /**
+  * @typedef t_ring
+  * @brief An io_uring instance, mapped for the `--writer=uring` backend.
+  *
+  * @details
+  * Set up with raw system calls. Only the fields the backend needs are
+  * kept: the submission tail it advances and the completion head and tail
+  * it consumes, plus the mappings to release at the end.
+  */
+ typedef struct s_ring
+ {
+	 int					fd;         ///< io_uring instance, -1 if none
+	 unsigned int		entries;    ///< Submission queue entries
+	 unsigned int		*sq_tail;   ///< Submission queue tail
+	 unsigned int		sq_mask;    ///< Submission index mask
+	 unsigned int		*sq_array;  ///< Submission index array
+	 struct io_uring_sqe	*sqes;      ///< Submission entries
+	 unsigned int		*cq_head;   ///< Completion queue head
+	 unsigned int		*cq_tail;   ///< Completion queue tail
+	 unsigned int		cq_mask;    ///< Completion index mask
+	 struct io_uring_cqe	*cqes;      ///< Completion entries
+	 void				*sq_map;    ///< Submission ring mapping
+	 size_t				sq_size;    ///< Its size
+	 void				*cq_map;    ///< Completion ring mapping
+	 size_t				cq_size;    ///< Its size
+ }						t_ring;
+ 
+ /**
+  * @typedef t_dumbwaiter
+  * @brief Log buffers carried to stdout by the `write` and `uring` writers.
+  *
+  * @details
+  * Log output is loaded into one of TRAY_COUNT trays under
+  * `pass_padlock`. A full tray is written with `write` or, when the ring
+  * is open, handed to io_uring while the next tray is loaded, or with
+  * `--writer=splice` gifted to the stdout pipe with `vmsplice`. Trays are
+  * used in order, so the busy ones always follow `oldest`, whose first
+  * `resume` bytes may already be written.
+  */
+ typedef struct s_dumbwaiter
+ {
+	 char			*trays;             ///< TRAY_COUNT trays of TRAY_SIZE
+	 int				sizes[TRAY_COUNT];  ///< Bytes loaded in each busy tray
+	 int				filled;             ///< Bytes in the tray being loaded
+	 int				loading;            ///< Tray being loaded
+	 int				busy;               ///< Trays not yet fully written
+	 int				oldest;             ///< Oldest busy tray
+	 int				resume;             ///< Bytes of `oldest` written
+	 int				flying;             ///< Writes submitted, not completed
+	 bool			severed;            ///< The chain in flight was cut
+	 bool			piped;              ///< Trays are spliced into a pipe
+	 t_ring			ring;               ///< io_uring, or `fd` -1
+ }					t_dumbwaiter;
+ 
+ /**
+  * @typedef t_cellar
+  * @brief Bottles of the drinking philosophers (`--drinking`).
+  *
+  * @details
+  * One bit per fork, set while somebody drinks from it. A philosopher
+  * takes all the bottles of its session at once, or none, under
+  * `padlock`, and waits on `returned` while one is missing.
+  */
+ typedef struct s_cellar
+ {
+	 pthread_mutex_t	padlock;            ///< Guards `held`
+	 pthread_cond_t	returned;           ///< Broadcast when bottles come back
+	 uint64_t		*held;              ///< Bottles taken, or NULL
+ }					t_cellar;
+ 
  /**
   * @typedef t_table
   * @brief Configuration and global state shared by all philosophers.
@@ -69,29 +341,70 @@
   * - Simulation parameters like timeouts and counts.
   * - Philosopher list and synchronization primitives.
   * - Flags for termination, meal tracking, and start time.
+  *
+  * With `--tables`, each table has its own forks, flags and monitor, but
+  * logs through the print locks, ledger and output of its `host`.
   */
  typedef struct s_table
  {
-	 int				philosopher_count;  ///< Total number of philosophers
+	 int				philosopher_count;  ///< Philosophers seated right now
+	 int				seat_count;         ///< Seats, at least as many
 	 int				time_to_die;        ///< Time until a philosopher dies without eating
 	 int				time_to_eat;        ///< Time spent eating
 	 int				time_to_sleep;      ///< Time spent sleeping
 	 long long		start_time;         ///< Timestamp when simulation started
+	 long long		start_wall;         ///< Wall clock at the start (ms)
+	 int				doors_open;         ///< Set once the dinner starts
 	 int				must_eat_count;     ///< Minimum meals required per philosopher
  
 	 int				meal_count;         ///< Shared count of meals eaten
 	 int				is_full;            ///< Flag indicating all philosophers are full
 	 int				end_flag;           ///< Flag to terminate simulation
+	 long long		last_stamp;         ///< Latest time logged (ms)
+	 t_philo			*closer;            ///< Who ended the dinner, or NULL
+	 const char		*closing;           ///< DIE or END, NULL on time out
+	 long long		closed_at;          ///< When the dinner ended (ms)
+	 long long		closed_wall;        ///< Wall clock then (ms)
  
 	 t_philo			*philo;             ///< Array of philosopher entities
 	 pthread_mutex_t	*fork_padlock;      ///< Array of mutexes representing forks
+	 int				fork_count;         ///< Forks in `fork_padlock`
+	 int				*fork_start;        ///< `--graph`: each seat's first fork
+	 int				*fork_list;         ///< `--graph`: forks, seat by seat
+	 t_cellar		cellar;             ///< `--drinking` bottles
 	 pthread_mutex_t	print_padlock;      ///< Mutex for printing messages
+	 pthread_mutex_t	pass_padlock;       ///< Mutex for the output itself
 	 pthread_mutex_t	eat_padlock;        ///< Mutex for updating meal stats
 	 pthread_mutex_t	end_padlock;        ///< Mutex for accessing end flag
+ 
+	 t_menu			menu;               ///< Options selected on the command line
+	 t_ledger		ledger;             ///< Measurements for `--io-stats`
+	 t_dumbwaiter	dumbwaiter;         ///< Buffered `--writer` output
+	 t_shm_stream	*stream;            ///< `--format=shm` ring, or NULL
+	 FILE			*report;            ///< `--report` stream, or NULL
+	 FILE			*samples;           ///< `--samples` stream, or NULL
+	 pthread_t		sampler;            ///< Thread writing the samples
+	 bool			sampling;           ///< Whether `sampler` was started
+	 t_live_page		*live;              ///< `--live` stats page, or NULL
+	 int				metrics_fd;         ///< `--metrics` socket, or -1
+	 pthread_t		metrics;            ///< Thread serving the metrics
+	 int				control_fd;         ///< `--control` socket, or -1
+	 pthread_t		control;            ///< Thread obeying the control socket
+	 t_timing		*timing;            ///< Timings in force
+	 t_timing		first_timing;       ///< Those of the command line
+	 struct s_table	*host;              ///< Table 1, owner of the log
+	 struct s_table	*annex;             ///< `--tables` 2 and on, or NULL
+	 int				number;             ///< Table number, from 1
+	 pthread_t		monitor;            ///< Monitor thread of an annex
+	 int				*links;             ///< `--link` sockets, two per fork
  }					t_table;
  
  /* === Status Macros === */
- # define MAX_PHILO 200
+ # ifndef MAX_PHILO
+ #  define MAX_PHILO 200
+ # endif
+ # define STRINGIFY(x)	#x
+ # define TO_STRING(x)	STRINGIFY(x)
  
  # define TAKE		"has taken a fork"
  # define EAT		"is eating"
@@ -101,8 +414,74 @@
  # define END		"e"
  # define END_MSG	"All philosophers ate enough!"
  
+ /* === Seats === */
+ # define SEAT_EMPTY		0
+ # define SEAT_TAKEN		1
+ # define SEAT_LEFT		2
+ # define SEAT_ANYONE	4
+ # define PARK_NAP		100
+ # define DOORS_NAP		100
+ 
+ /* === Scenarios === */
+ # define SCENARIO_LINE	256
+ # define YIELD_NAP		200
+ 
+ /* === Graphs === */
+ # define GRAPH_LINE		64
+ 
+ /* === Drinking === */
+ # define DRINK_SEED		42
+ # define BOTTLE_CHECK	0
+ # define BOTTLE_TAKE	1
+ # define BOTTLE_RETURN	2
+ # define POUR_BATCH		16
+ 
+ /* === Tables === */
+ # define HOUSE_MAX		64
+ 
+ /* === Links === */
+ # define LINK_NONE		0
+ # define LINK_UNIX		1
+ # define LINK_TCP		2
+ # define SLIP_ASK		0
+ # define SLIP_GRANT		1
+ # define SLIP_RETURN	2
+ # define SLIP_BATCH		32
+ 
+ /* === Output Formats === */
+ # define FORMAT_TEXT	0
+ # define FORMAT_BINARY	1
+ # define FORMAT_NONE	2
+ # define FORMAT_SHM		3
+ # define FORMAT_SUMMARY	4
+ # define FORMAT_JSON	5
+ 
+ /* === Samples === */
+ # define SAMPLE_CSV		0
+ # define SAMPLE_NDJSON	1
+ # define SAMPLE_EVERY	1000
+ 
+ /* === Metrics === */
+ # define METRICS_POLL_MS	100
+ # define METRICS_WAIT_MS	20
+ # define METRICS_SIZE		8192
+ 
+ /* === Control === */
+ # define CONTROL_POLL_MS	100
+ # define CONTROL_LINE		256
+ # define PAUSE_NAP			1000
+ 
  /* === Initialization === */
- void		receive_guests(int argc, char **argv);
+ int			read_menu(t_menu *menu, int argc, char **argv);
+ bool		read_shape(t_menu *menu, const char *arg);
+ void		show_menu(int fd);
+ bool		is_option(const char *arg, const char *name, const char **value);
+ bool		is_same(const char *a, const char *b);
+ bool		is_number(const char *str);
+ bool		is_quiet(const t_menu *menu);
+ bool		is_measured(const t_menu *menu);
+ void		receive_guests(t_menu *menu, int argc, char **argv);
+ void		check_menu(const t_menu *menu, int philosophers);
  void		set_table(t_table *table, int argc, char **argv);
  void		welcome_philosophers(t_table *table);
  void		set_rules(t_table *table);
@@ -112,15 +491,153 @@
  void		*dinner_routine(void *arg);
  bool		is_dinner_over(t_philo *philo, bool order);
  void		advance_time(t_philo *philo, long long ms);
+ long long	print_order(t_philo *philo, t_order *order, int count);
  void		print_action(t_philo *philo, const char *status);
+ void		print_fork(t_philo *philo, int fork);
+ void		last_call(t_philo *philo, const char *action);
+ void		present_last_call(t_table *table);
+ void		present_summary(t_table *table);
+ void		print_outcome(FILE *out, t_table *table);
+ 
+ /* === Journal === */
+ void		print_trace_header(t_table *table);
+ long long	write_action(t_philo *philo, const char *action, int fork,
+				 long long when);
+ void		write_end_message(t_philo *philo);
+ void		open_shm_stream(t_table *table, const t_trace_header *header);
+ void		publish_event(t_shm_stream *stream, const t_trace_event *event);
+ void		close_shm_stream(t_table *table);
+ uint32_t	trace_kind(const char *action);
+ void		open_live_page(t_table *table);
+ void		tally_actions(t_philo *philo, t_order *order, int count);
+ void		close_live_page(t_table *table);
+ 
+ /* === Dumbwaiter === */
+ void		install_dumbwaiter(t_table *table);
+ void		remove_dumbwaiter(t_table *table);
+ void		serve_dish(t_table *table, const void *dish, size_t size);
+ void		send_tray(t_dumbwaiter *dumbwaiter, bool last);
+ int			open_ring(t_ring *ring, char *trays);
+ void		close_ring(t_ring *ring);
+ int			open_pipe_sink(t_dumbwaiter *dumbwaiter);
+ void		splice_tray(t_dumbwaiter *dumbwaiter);
+ void		queue_tray(t_dumbwaiter *dumbwaiter);
+ void		submit_trays(t_dumbwaiter *dumbwaiter);
+ void		collect_trays(t_dumbwaiter *dumbwaiter, int keep);
  
  /* === Monitoring & Cleanup === */
  void		dinner_monitor(t_table *table);
  void		clean_table(t_table *table);
  void		end_dinner(t_table *table);
  
+ /* === Ledger === */
+ long long	read_stopwatch(t_table *table);
+ void		keep_ledger(t_table *table, long long asked, long long locked,
+				 int lines);
+ void		note_margin(t_philo *philo);
+ void		note_lag(t_table *table, long long when);
+ void		present_bill(t_table *table);
+ void		take_padlock(t_table *table, pthread_mutex_t *padlock);
+ 
+ /* === Report === */
+ void		note_forks(t_philo *philo, long long asked);
+ void		note_nap(t_philo *philo, long long began, long long ms);
+ void		note_hunger(t_philo *philo);
+ double		average(double total, long long count);
+ void		open_reports(t_table *table);
+ void		present_report(t_table *table);
+ void		print_usage(FILE *report);
+ const char	*bool_name(bool value);
+ const char	*format_name(int format);
+ const char	*writer_name(int writer);
+ const char	*link_name(int link);
+ void		start_sampler(t_table *table);
+ void		stop_sampler(t_table *table);
+ void		open_metrics(t_table *table);
+ size_t		write_metrics(t_table *table, char *text, size_t size,
+				 t_scrape *last);
+ 
+ /* === Control === */
+ int			listen_on(const char *path);
+ void		send_all(int fd, const char *data, size_t size);
+ void		stop_server(int *fd, pthread_t thread, const char *path);
+ void		open_control(t_table *table);
+ void		obey(t_table *table, const char *line, char *reply);
+ void		seat_guest(t_table *table, int after, char *reply);
+ void		unseat_guest(t_table *table, int id, char *reply);
+ bool		sit_down(t_philo *philo, int time_to_eat);
+ void		stand_up(t_philo *philo);
+ bool		park(t_philo *philo, long long ticket);
+ long long	freeze_clock(void);
+ long long	thaw_clock(void);
+ bool		is_clock_frozen(void);
+ t_timing	*read_timing(t_table *table);
+ int			retime(t_table *table, const char *what, long long ms);
+ bool		next_phase(t_philo *philo, t_timing *timing);
+ void		forget_timings(t_table *table);
+ 
+ /* === Scenarios === */
+ void		load_scenario(t_table *table);
+ void		own_timing(t_philo *philo, t_timing *timing);
+ int			own_time_to_die(t_philo *philo);
+ void		wait_turn(t_philo *philo, int time_to_eat);
+ long long	urgency(t_philo *philo, long long now);
+ int			meal_around(t_philo *philo, int time_to_eat);
+ 
+ /* === Graphs === */
+ void		load_graph(t_table *table);
+ void		lay_forks(t_table *table, t_philo *philo);
+ 
+ /* === Drinking === */
+ void		open_cellar(t_table *table);
+ void		close_cellar(t_table *table);
+ long long	pour_bottles(t_philo *philo);
+ void		return_bottles(t_philo *philo);
+ int			count_bottles(t_philo *philo);
+ int			bottle_at(t_philo *philo, int k);
+ bool		is_wanted(t_philo *philo, int k, int count);
+ bool		tap_bottles(t_philo *philo, int mode);
+ uint64_t	mix_draw(uint64_t z);
+ long long	seize_forks(t_philo *philo);
+ void		release_forks(t_philo *philo);
+ 
+ /* === Processes === */
+ t_table		*book_room(t_table *room);
+ void		*share_alloc(const t_menu *menu, size_t size);
+ void		share_free(const t_menu *menu, void *memory, size_t size);
+ int			start_guest(t_philo *philo);
+ int			open_wing(t_philo *philo);
+ void		wait_guest(t_philo *philo);
+ const pthread_mutexattr_t	*padlock_kind(const t_menu *menu);
+ const pthread_condattr_t	*signal_kind(const t_menu *menu);
+ int			find_wing(t_table *table, int seat);
+ 
+ /* === Links === */
+ void		open_links(t_table *table);
+ void		close_links(t_table *table, int porter, int courier);
+ bool		send_slip(int fd, int kind, int fork);
+ int			read_slips(int fd, t_slip *slips, int max);
+ void		hold_slip(const t_slip *slip, int delay);
+ bool		open_porter(t_philo *first, t_philo *last, pthread_t *porter);
+ void		close_porter(t_philo *last, pthread_t porter, bool served);
+ void		take_fork(t_philo *philo, int fork);
+ void		put_fork(t_philo *philo, int fork);
+ 
+ /* === Tables === */
+ void		open_house(t_table *host, int argc, char **argv);
+ void		seat_house(t_table *host);
+ void		open_doors(t_table *host);
+ void		wait_doors(t_table *table);
+ void		close_house(t_table *host);
+ t_table		*house_table(t_table *host, int number);
+ int			house_number(t_philo *philo);
+ void		present_house(t_table *host);
+ long long	count_meals(t_table *host);
+ 
  /* === Utility === */
  long long	get_current_time(void);
+ long long	get_precise_time(void);
+ long long	get_wall_time(void);
  long long	ft_atoi(const char *str);
  int			ft_putstr_fd(int fd, char *str);
  
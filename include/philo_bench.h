@@ -0,0 +1,80 @@
+/**
+ * @file philo_bench.h
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Process launching and measurement shared by the benchmark tools.
+ *
+ * @details
+ * A `t_bench_run` describes one `philo` invocation: its arguments, where
+ * its stdout goes, how many CPUs it may use and how long it may run.
+ * `bench_run` executes it synchronously and fills in the exit status, the
+ * wall time and the CPU time charged to the child.
+ *
+ * @ingroup philosopher_bench
+ */
+
+ #ifndef PHILO_BENCH_H
+ # define PHILO_BENCH_H
+ 
+ # include <stdbool.h>
+ # include <sys/types.h>
+ 
+ /**
+  * @defgroup philosopher_bench Benchmark Harness
+  * @brief Timed, CPU-pinned `philo` runs for the measurement tools.
+  *
+  * @details
+  * Children are pinned with `sched_setaffinity` to the first `cpus` CPUs
+  * the tool itself may use, run in their own process group and are killed
+  * when they outlive their timeout. CPU time comes from `wait4`.
+  *
+  * @{
+  */
+ 
+ # define BENCH_MAX_ARGS	16
+ 
+ /**
+  * @typedef t_bench_run
+  * @brief One timed `philo` execution.
+  *
+  * @details
+  * The first six fields are inputs, cleared by `bench_init`; `argv` is
+  * NULL-terminated and `argv[0]` is the binary. A NULL `out_path` or
+  * `err_path` discards that stream, an `out_fd` other than -1 is used as
+  * stdout instead of `out_path`, and `cpus` of 0 leaves the affinity
+  * untouched. The rest is filled by `bench_run`.
+  */
+ typedef struct s_bench_run
+ {
+	 char		*argv[BENCH_MAX_ARGS + 1];   ///< Binary and arguments
+	 const char	*out_path;                   ///< stdout capture, or NULL
+	 const char	*err_path;                   ///< stderr capture, or NULL
+	 int			out_fd;                      ///< Open stdout, or -1
+	 int			cpus;                        ///< CPUs allowed, 0 for all
+	 int			timeout;                     ///< Watchdog (ms)
+	 int			status;                      ///< Status from `wait4`
+	 bool		killed;                      ///< The watchdog fired
+	 double		wall;                        ///< Wall time (s)
+	 double		cpu;                         ///< User plus system time (s)
+ }				t_bench_run;
+ 
+ /* === Runs === */
+ void		bench_init(t_bench_run *run);
+ int			bench_run(t_bench_run *run);
+ int			bench_cpu_count(void);
+ double		bench_clock(void);
+ 
+ /* === Helpers === */
+ int			parse_int_list(const char *str, int *out, int max, int *len);
+ int			meal_period(int count, int eat, int sleep);
+ int			make_temp(char *path, const char *prefix);
+ 
+ /* === Reports === */
+ char		*read_whole(const char *path);
+ const char	*report_outcome(const char *text);
+ int			report_number(const char *text, const char *key, long long *value);
+ 
+ /** @} */ // end of philosopher_bench
+ 
+ #endif
+ 
\ No newline at end of file
@@ -0,0 +1,171 @@
+/**
+ * @file philo_check.h
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Streaming log validator shared by `philo-check` and `philo-stress`.
+ *
+ * @details
+ * A `t_check` consumes a `philo` log as a stream of events, either parsed
+ * from text lines or read from a binary trace, and verifies the simulation
+ * invariants in constant memory (one `t_seat` per philosopher and one
+ * holder slot per fork). Violations are counted by kind; the first few are
+ * described on a report stream.
+ *
+ * @ingroup philosopher_check
+ */
+
+ #ifndef PHILO_CHECK_H
+ # define PHILO_CHECK_H
+ 
+ # include <stdbool.h>
+ # include <stdio.h>
+ # include "philo_shm.h"
+ # include "philo_trace.h"
+ 
+ /**
+  * @defgroup philosopher_check Log Checker
+  * @brief Invariant checking of `philo` output.
+  *
+  * @details
+  * Checked invariants:
+  * - timestamps never decrease
+  * - a fork is never taken while another philosopher still holds it
+  * - a philosopher eats only with two forks
+  * - meals last `time_to_eat` and naps at least `time_to_sleep`
+  * - nothing is printed after "died" or the end message
+  * - a death is printed no earlier than the starvation deadline and at
+  *   most `death_window` ms after it, and nobody outlives their deadline
+  *
+  * @{
+  */
+ 
+ /* === Violation Kinds === */
+ # define CHECK_FORMAT		0
+ # define CHECK_TIME_ORDER	1
+ # define CHECK_FORK			2
+ # define CHECK_SEQUENCE		3
+ # define CHECK_EAT_TIME		4
+ # define CHECK_SLEEP_TIME	5
+ # define CHECK_AFTER_END	6
+ # define CHECK_DEATH_TIME	7
+ # define CHECK_MISSED_DEATH	8
+ # define CHECK_UNFINISHED	9
+ # define CHECK_KINDS		10
+ 
+ # define CHECK_MESSAGE		160
+ # define CHECK_BUFFER		1048576
+ 
+ /* === Seat States === */
+ # define SEAT_THINKING	0
+ # define SEAT_EATING	1
+ # define SEAT_SLEEPING	2
+ 
+ /**
+  * @typedef t_check_rules
+  * @brief Parameters the log is checked against.
+  *
+  * @details
+  * The first five fields mirror the `philo` arguments; zero means unknown
+  * (a binary trace header fills them in). `tolerance` bounds the accepted
+  * drift of meal and nap durations, `death_window` the delay between the
+  * starvation deadline and the death message. `think_slack` is the extra
+  * time allowed between waking up and thinking; odd tables wait one more
+  * `time_to_eat` there.
+  */
+ typedef struct s_check_rules
+ {
+	 int			philosopher_count;   ///< Number of philosophers
+	 int			time_to_die;         ///< time_to_die in milliseconds
+	 int			time_to_eat;         ///< time_to_eat in milliseconds
+	 int			time_to_sleep;       ///< time_to_sleep in milliseconds
+	 int			must_eat_count;      ///< Meal quota, -1 if none
+	 int			tolerance;           ///< Duration tolerance (ms)
+	 int			death_window;        ///< Allowed death print delay (ms)
+	 int			think_slack;         ///< Extra wake-to-think time (ms)
+	 bool		open_ended;          ///< Accept logs without a final event
+ }				t_check_rules;
+ 
+ /**
+  * @typedef t_seat
+  * @brief What the checker knows about one philosopher.
+  *
+  * @details
+  * The last meal end is bracketed: it happened no earlier than
+  * `meal_end_min` (meal start plus `time_to_eat`) and no later than
+  * `meal_end_max` (the following "is sleeping" line).
+  */
+ typedef struct s_seat
+ {
+	 int			state;          ///< SEAT_THINKING, SEAT_EATING, SEAT_SLEEPING
+	 int			forks;          ///< Forks taken since the last meal ended
+	 long long	since;          ///< When the current state started
+	 long long	meal_end_min;   ///< Earliest possible end of the last meal
+	 long long	meal_end_max;   ///< Latest possible end of the last meal
+	 long		meals;          ///< Meals completed
+ }				t_seat;
+ 
+ /**
+  * @typedef t_check
+  * @brief State of one streaming validation.
+  *
+  * @details
+  * Feed events with `check_event` (or a whole stream with `check_stream`)
+  * and close with `check_finish`. `position` is the line or record number
+  * used in messages.
+  */
+ typedef struct s_check
+ {
+	 t_check_rules	rules;                      ///< Parameters to enforce
+	 t_seat			*seats;                     ///< One seat per philosopher
+	 int				*holders;                   ///< Fork holder id, 0 if free
+	 long long		last_time;                  ///< Latest timestamp seen
+	 long			position;                   ///< Current line or record
+	 bool			binary;                     ///< Input is a binary trace
+	 long long		bytes;                      ///< Input bytes consumed
+	 long			events;                     ///< Events checked
+	 long			meals;                      ///< Meals completed in total
+	 int				death_id;                   ///< Who died, 0 if nobody
+	 long long		death_time;                 ///< When they died
+	 long long		death_delay;                ///< Death print delay (ms)
+	 bool			ended;                      ///< End message seen
+	 long			dropped;                    ///< Shared memory events lost
+	 long			violations[CHECK_KINDS];    ///< Violations per kind
+	 long			total_violations;           ///< Sum of `violations`
+	 FILE			*report;                    ///< Message stream, or NULL
+	 long			max_report;                 ///< Messages to print
+	 char			first[CHECK_MESSAGE];       ///< First violation message
+ }					t_check;
+ 
+ /* === Rules === */
+ void		check_defaults(t_check *check);
+ int			check_start(t_check *check);
+ void		check_event(t_check *check, const t_trace_event *event);
+ void		check_finish(t_check *check);
+ void		check_free(t_check *check);
+ void		check_violation(t_check *check, int kind, const char *message);
+ const char	*check_kind_name(int kind);
+ void		check_take(t_check *check, const t_trace_event *event);
+ void		drop_forks(t_check *check, int id);
+ void		check_death(t_check *check, t_seat *seat,
+				 const t_trace_event *event);
+ void		check_end(t_check *check, const t_trace_event *event);
+ 
+ /* === Streams === */
+ int			check_stream(t_check *check, int fd);
+ int			check_file(t_check *check, const char *path);
+ int			check_header(t_check *check, const t_trace_header *header);
+ size_t		check_chunk(t_check *check, char *buffer, size_t len);
+ void		check_tail(t_check *check, const char *buffer, size_t len);
+ void		check_text_line(t_check *check, const char *line, const char *end);
+ size_t		check_text_chunk(t_check *check, const char *buffer, size_t len);
+ int			check_shm(t_check *check, const char *name);
+ void		follow_stream(t_check *check, const t_shm_stream *stream);
+ 
+ /* === philo-check === */
+ void		print_check_summary(const t_check *check, double seconds);
+ void		print_check_error(int status);
+ 
+ /** @} */ // end of philosopher_check
+ 
+ #endif
+ 
\ No newline at end of file
@@ -0,0 +1,144 @@
+/**
+ * @file philo_graph.h
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Declarations for the `philo-graph` topology benchmark.
+ *
+ * @details
+ * The topology benchmark writes conflict graphs of every kind and size
+ * asked for, runs a saturated dinner on each through `--graph`, and
+ * writes one CSV row per run: throughput, how long forks were waited
+ * for and how evenly the philosophers were served.
+ *
+ * @ingroup philosopher_graph
+ */
+
+ #ifndef PHILO_GRAPH_H
+ # define PHILO_GRAPH_H
+ 
+ # include <limits.h>
+ # include <stdio.h>
+ # include "philo_bench.h"
+ 
+ /**
+  * @defgroup philosopher_graph Topology Benchmark
+  * @brief Fork acquisition versus the shape of the conflict graph.
+  *
+  * @details
+  * Graph kinds, for N philosophers:
+  * - `ring`: the classic table, N forks.
+  * - `grid`: rows by columns, the most square that divides N, each
+  *   philosopher sharing a fork with those above, below and beside.
+  * - `torus`: the grid with its edges wrapped around, in every dimension
+  *   longer than two.
+  * - `regular`: every philosopher shares `degree` forks with others drawn
+  *   at random (pairing model, no fork shared twice by the same pair).
+  * - `star`: philosopher 1 shares a fork with each of the others.
+  *
+  * Forks are numbered in the order the graph lists them, which is the
+  * order philosophers take them in. With a drinking percent, each meal
+  * needs a random share of them instead, taken all at once through the
+  * bitmask table of `--drinking`; 0 takes every fork, one mutex each.
+  *
+  * Hunger tails are over the philosophers: the median, 99th percentile
+  * and largest of each one's longest wait between meals.
+  *
+  * @{
+  */
+ 
+ # define GRAPH_MAX_LIST		64
+ # define GRAPH_KIND_COUNT	5
+ # define GRAPH_PAIR_TRIES	1000
+ # define GRAPH_DRAWS		100
+ 
+ /**
+  * @typedef t_graph_bench
+  * @brief Settings of one topology benchmark.
+  */
+ typedef struct s_graph_bench
+ {
+	 const char		*philo_bin;               ///< Binary under test
+	 FILE			*out;                     ///< CSV or graph destination
+	 int				kinds[GRAPH_MAX_LIST];    ///< Graph kinds, by index
+	 int				kind_len;                 ///< Entries in `kinds`
+	 int				counts[GRAPH_MAX_LIST];   ///< Philosopher counts
+	 int				count_len;                ///< Entries in `counts`
+	 int				degree;                   ///< Degree of `regular` graphs
+	 int				drinks[GRAPH_MAX_LIST];   ///< Drinking percents
+	 int				drink_len;                ///< Entries in `drinks`
+	 int				time_to_eat;              ///< time_to_eat of the runs
+	 int				time_to_sleep;            ///< time_to_sleep of the runs
+	 int				run_for;                  ///< Wall time per run (ms)
+	 int				repeats;                  ///< Runs per point
+	 int				cpus;                     ///< CPUs allowed, 0 for all
+	 int				timeout;                  ///< Extra watchdog (ms)
+	 unsigned int	seed;                     ///< Seed of `regular` graphs
+	 int				print;                    ///< Kind to print, or -1
+ }					t_graph_bench;
+ 
+ /**
+  * @typedef t_graph_point
+  * @brief Measurements of one (kind, count, repeat) run.
+  */
+ typedef struct s_graph_point
+ {
+	 int			kind;         ///< Graph kind, by index
+	 int			count;        ///< Philosophers
+	 int			drinking;     ///< Drinking percent, 0 for every fork
+	 int			repeat;       ///< Repeat index
+	 const char	*outcome;     ///< How the run ended
+	 int			forks;        ///< Forks of the graph
+	 int			degree_max;   ///< Most forks of one philosopher
+	 long		meals;        ///< Meals eaten
+	 long long	runtime;      ///< Dinner length (ms)
+	 double		wait_avg;     ///< Fork wait per meal (us)
+	 double		wait_max;     ///< Longest fork wait (us)
+	 long long	hunger[3];    ///< Hunger median, p99 and max (ms)
+	 long long	contended;    ///< Locks found taken
+	 double		fairness;     ///< Jain's index of the meals
+	 double		cpu;          ///< CPU time of the run (s)
+ }				t_graph_point;
+ 
+ /**
+  * @typedef t_graph_sink
+  * @brief Where the edges of a graph being drawn go.
+  */
+ typedef struct s_graph_sink
+ {
+	 FILE			*out;         ///< Edge list destination
+	 int				*degrees;     ///< Forks of each philosopher so far
+	 t_graph_point	*point;       ///< Receives `forks` and `degree_max`
+ }					t_graph_sink;
+ 
+ /**
+  * @typedef t_regular
+  * @brief A random regular graph being drawn.
+  */
+ typedef struct s_regular
+ {
+	 t_graph_sink		*sink;      ///< Destination, degrees filled by pairs
+	 int					degree;     ///< Points per philosopher
+	 int					*adjacent;  ///< Neighbours, `degree` slots each
+	 int					*points;    ///< Pool of unpaired points
+	 int					left;       ///< Points in the pool
+	 unsigned long long	state;      ///< Generator state
+ }						t_regular;
+ 
+ /* === Graphs === */
+ int			find_graph_kind(const char *name);
+ const char	*graph_kind_name(int kind);
+ int			write_graph(FILE *out, t_graph_bench *bench, t_graph_point *point);
+ void		put_edge(t_graph_sink *sink, int a, int b);
+ int			draw_regular(t_graph_sink *sink, t_graph_bench *bench);
+ int			pair_points(t_regular *draw);
+ 
+ /* === Benchmark === */
+ int			parse_graph_options(t_graph_bench *bench, int argc, char **argv);
+ int			apply_axis_option(t_graph_bench *bench, int opt, char *arg);
+ void		measure_graph(t_graph_bench *bench, t_graph_point *point);
+ int			read_graph_report(t_graph_point *point, const char *path);
+ 
+ /** @} */ // end of philosopher_graph
+ 
+ #endif
+ 
\ No newline at end of file
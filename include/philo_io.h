@@ -0,0 +1,115 @@
+/**
+ * @file philo_io.h
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Declarations for the `philo-io` output sink benchmark.
+ *
+ * @details
+ * The output benchmark runs the same dinners with stdout connected to
+ * each kind of sink a user may give `philo`, and reads back the
+ * `--io-stats` figures: lines per second, how long `print_padlock` is
+ * held and waited for, and the smallest margin to `time_to_die` the
+ * monitor saw.
+ *
+ * @ingroup philosopher_io
+ */
+
+ #ifndef PHILO_IO_H
+ # define PHILO_IO_H
+ 
+ # include <limits.h>
+ # include <stdio.h>
+ # include <sys/types.h>
+ # include "philo_bench.h"
+ 
+ /**
+  * @defgroup philosopher_io Output Benchmark
+  * @brief Cost of printing, per kind of stdout.
+  *
+  * @details
+  * Sinks:
+  * - `null`: `/dev/null`, the baseline every margin is compared with
+  * - `file`: a regular file in `$TMPDIR`
+  * - `pipe`: a pipe drained as fast as possible
+  * - `tty`: a pseudo-terminal drained as fast as possible
+  * - `slow`: a pipe whose reader takes `rate` bytes per second while the
+  *   dinner lasts, so that writes block once the pipe buffer is full
+  *
+  * Every sink can be measured with each `--writer`: `stdio` (`printf`
+  * under the print lock), `write` (64 KiB buffers written synchronously),
+  * `uring` (the same buffers submitted to io_uring) and `splice` (the same
+  * buffers gifted to a pipe with `vmsplice`, or written elsewhere).
+  *
+  * @{
+  */
+ 
+ # define IO_MAX_SCENARIOS	16
+ # define IO_SINKS			5
+ # define IO_WRITERS			4
+ 
+ /**
+  * @typedef t_io
+  * @brief Settings of one output benchmark.
+  */
+ typedef struct s_io
+ {
+	 const char	*philo_bin;                     ///< Binary under test
+	 FILE		*out;                           ///< CSV destination
+	 char		*scenarios[IO_MAX_SCENARIOS];   ///< "N die eat sleep [meals]"
+	 int			scenario_len;                   ///< Entries in `scenarios`
+	 bool		sinks[IO_SINKS];                ///< Sinks to measure
+	 bool		writers[IO_WRITERS];            ///< Writers to measure
+	 int			run_for;                        ///< Wall time per run (ms)
+	 int			rate;                           ///< Slow reader (bytes/s)
+	 int			repeats;                        ///< Runs per sink
+	 int			timeout;                        ///< Extra watchdog (ms)
+ }				t_io;
+ 
+ /**
+  * @typedef t_sink
+  * @brief An open stdout for one run, and the process draining it.
+  */
+ typedef struct s_sink
+ {
+	 int			kind;             ///< Index in the sink names
+	 int			fd;               ///< Write end handed to `philo`
+	 pid_t		drain;            ///< Reader process, or -1
+	 char		path[PATH_MAX];   ///< Temporary file of the `file` sink
+ }				t_sink;
+ 
+ /**
+  * @typedef t_io_point
+  * @brief Measurements of one (scenario, writer, sink, repeat) run.
+  */
+ typedef struct s_io_point
+ {
+	 const char	*scenario;     ///< Scenario arguments
+	 int			sink;          ///< Sink index
+	 int			writer;        ///< Writer index
+	 int			repeat;        ///< Repeat index
+	 const char	*outcome;      ///< How the run ended
+	 long		lines;         ///< Lines written
+	 long long	elapsed;       ///< Dinner length (ms)
+	 double		hold_avg;      ///< Average print lock hold (us)
+	 double		hold_max;      ///< Longest print lock hold (us)
+	 double		wait_avg;      ///< Average print lock wait (us)
+	 double		wait_max;      ///< Longest print lock wait (us)
+	 long long	min_margin;    ///< Smallest margin to time_to_die (ms)
+	 double		cpu;           ///< CPU time of the run (s)
+ }				t_io_point;
+ 
+ /* === Benchmark === */
+ int			parse_io_options(t_io *io, int argc, char **argv);
+ void		measure_sink(t_io *io, t_io_point *point);
+ const char	*sink_name(int kind);
+ const char	*writer_name(int writer);
+ 
+ /* === Sinks === */
+ int			open_sink(t_sink *sink, int kind, t_io *io);
+ void		close_sink(t_sink *sink);
+ pid_t		start_drain(int fd, int other, int rate, int slow_for);
+ 
+ /** @} */ // end of philosopher_io
+ 
+ #endif
+ 
\ No newline at end of file
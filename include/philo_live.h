@@ -0,0 +1,94 @@
+/**
+ * @file philo_live.h
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Live stats page shared by `philo --live` and `philo-top`.
+ *
+ * @details
+ * With `--live=/name`, `philo` keeps one seat per philosopher up to date
+ * in a POSIX shared memory object: what the philosopher is doing, since
+ * when, the forks held, the meals eaten and the last meal. Viewers map the
+ * object read-only; nothing they do reaches the dinner, and the dinner
+ * never waits for them.
+ *
+ * @ingroup philosopher_live
+ */
+
+ #ifndef PHILO_LIVE_H
+ # define PHILO_LIVE_H
+ 
+ # include <stdint.h>
+ # include "philo_trace.h"
+ 
+ /**
+  * @defgroup philosopher_live Live Stats Page
+  * @brief Layout of the `philo --live` shared memory page.
+  *
+  * @details
+  * Each seat is written by its philosopher's thread only, field by field
+  * with relaxed atomic stores and no lock: a viewer may see a seat halfway
+  * through an update, and is expected to redraw soon after anyway. A seat
+  * fills a cache line of its own, so that philosophers never share one.
+  * `version` is stored last when the page is created, `closed` once the
+  * dinner is over, after `closer` and `closed_at`. The object is unlinked when the dinner
+  * ends; viewers already attached keep it.
+  *
+  * @{
+  */
+ 
+ # define LIVE_MAGIC		"PHILOTOP"
+ # define LIVE_VERSION	1
+ # define LIVE_NAME		"/philo-live"
+ # define LIVE_LEFT		1
+ # define LIVE_RIGHT		2
+ 
+ /**
+  * @typedef t_live_seat
+  * @brief What one philosopher is doing right now.
+  *
+  * @details
+  * `state` is the TRACE_* kind of the last action other than taking a
+  * fork (TRACE_THINK, TRACE_EAT, TRACE_SLEEP or TRACE_DIE), 0 before the
+  * first one. Times are in ms since `start_time`.
+  */
+ typedef struct s_live_seat
+ {
+	 uint32_t	state;       ///< TRACE_* kind, 0 before the first action
+	 uint32_t	forks;       ///< LIVE_LEFT and LIVE_RIGHT bits held
+	 uint32_t	meals;       ///< Meals eaten
+	 uint32_t	unused;      ///< Padding
+	 int64_t		since;       ///< When `state` began
+	 int64_t		last_meal;   ///< Last meal, as the monitor judges it
+	 char		pad[32];     ///< Cache line padding
+ }				t_live_seat;
+ 
+ /**
+  * @typedef t_live_page
+  * @brief Whole shared memory object: the run, then one seat each.
+  *
+  * @details
+  * Philosopher `id` sits at `seats[id - 1]`, with fork `id - 1` on the
+  * left and fork `id % seat_count` on the right. `start_time` stays 0
+  * until every guest is seated and the doors open.
+  */
+ typedef struct s_live_page
+ {
+	 char		magic[8];        ///< LIVE_MAGIC, not NUL-terminated
+	 uint32_t	version;         ///< LIVE_VERSION, 0 until ready
+	 uint32_t	seat_count;      ///< Number of philosophers
+	 int32_t		time_to_die;     ///< ms
+	 int32_t		time_to_eat;     ///< ms
+	 int32_t		time_to_sleep;   ///< ms
+	 int32_t		must_eat;        ///< Meal quota, -1 if none
+	 int64_t		start_time;      ///< Wall clock at the start (epoch ms)
+	 uint32_t	closed;          ///< 1 once the dinner is over
+	 int32_t		closer;          ///< Who died, 0 if nobody did
+	 int64_t		closed_at;       ///< When the dinner ended (ms)
+	 char		pad[8];          ///< Cache line padding
+	 t_live_seat	seats[];         ///< One per philosopher
+ }				t_live_page;
+ 
+ /** @} */ // end of philosopher_live
+ 
+ #endif
+ 
\ No newline at end of file
@@ -0,0 +1,92 @@
+/**
+ * @file philo_mix.h
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Declarations for the `philo-mix` heterogeneity benchmark.
+ *
+ * @details
+ * The heterogeneity benchmark runs the same dinner with meals and naps
+ * spread further and further around the command line's, through a
+ * `--scenario` file, and writes one CSV row per run: throughput, how
+ * evenly the philosophers were served, and how close the hungriest came
+ * to starving.
+ *
+ * @ingroup philosopher_mix
+ */
+
+ #ifndef PHILO_MIX_H
+ # define PHILO_MIX_H
+ 
+ # include <limits.h>
+ # include <stdio.h>
+ # include "philo_bench.h"
+ 
+ /**
+  * @defgroup philosopher_mix Heterogeneity Benchmark
+  * @brief Throughput and starvation versus how mixed the timings are.
+  *
+  * @details
+  * With a spread of `s` percent, every philosopher's `time_to_eat` and
+  * `time_to_sleep` are the base ones times a factor drawn uniformly in
+  * [1 - s/100, 1 + s/100], at least 1 ms; `time_to_die` stays shared. The
+  * draws depend only on the seed, the repeat and the philosopher, so every
+  * spread of one repeat stretches the same pattern further.
+  *
+  * A philosopher's duty is the share of the run it could have spent eating
+  * and sleeping: meals times its own meal and nap, over the run time.
+  * Fairness is Jain's index of the duties, 1 when all are equal.
+  *
+  * @{
+  */
+ 
+ # define MIX_MAX_LIST	64
+ 
+ /**
+  * @typedef t_mix
+  * @brief Settings of one heterogeneity benchmark.
+  */
+ typedef struct s_mix
+ {
+	 const char	*philo_bin;                 ///< Binary under test
+	 FILE		*out;                       ///< CSV destination
+	 int			count;                      ///< Philosophers
+	 int			time_to_die;                ///< Shared time_to_die
+	 int			time_to_eat;                ///< Base time_to_eat
+	 int			time_to_sleep;              ///< Base time_to_sleep
+	 int			spreads[MIX_MAX_LIST];      ///< Spreads (percent)
+	 int			spread_len;                 ///< Entries in `spreads`
+	 int			run_for;                    ///< Wall time per run (ms)
+	 int			repeats;                    ///< Runs per spread
+	 int			timeout;                    ///< Extra watchdog (ms)
+	 unsigned int	seed;                   ///< Seed of the draws
+ }				t_mix;
+ 
+ /**
+  * @typedef t_mix_point
+  * @brief Measurements of one (spread, repeat) run.
+  */
+ typedef struct s_mix_point
+ {
+	 int			spread;       ///< Spread (percent)
+	 int			repeat;       ///< Repeat index
+	 const char	*outcome;     ///< How the run ended
+	 int			died;         ///< Who died, or 0
+	 long		meals;        ///< Meals eaten
+	 long long	runtime;      ///< Dinner length (ms)
+	 double		duty_avg;     ///< Average duty
+	 double		duty_min;     ///< Smallest duty
+	 double		fairness;     ///< Jain's index of the duties
+	 long long	slack_min;    ///< Smallest slack to time_to_die (ms)
+	 double		cpu;          ///< CPU time of the run (s)
+ }				t_mix_point;
+ 
+ /* === Benchmark === */
+ int			parse_mix_options(t_mix *mix, int argc, char **argv);
+ void		measure_mix(t_mix *mix, t_mix_point *point);
+ int			mixed_time(t_mix *mix, t_mix_point *point, int draw, int base);
+ int			read_mix_report(t_mix *mix, t_mix_point *point, const char *path);
+ 
+ /** @} */ // end of philosopher_mix
+ 
+ #endif
+ 
\ No newline at end of file
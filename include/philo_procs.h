@@ -0,0 +1,113 @@
+/**
+ * @file philo_procs.h
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Declarations for the `philo-procs` process overhead benchmark.
+ *
+ * @details
+ * The process benchmark runs the same saturated dinner with philosophers
+ * as threads, as processes, split between worker processes, and with
+ * those passing their border forks over sockets, and writes one CSV row
+ * per run:
+ * throughput, fork waits, hunger and CPU time per meal, and how long the
+ * run took to set up and clear away.
+ *
+ * @ingroup philosopher_procs
+ */
+
+ #ifndef PHILO_PROCS_H
+ # define PHILO_PROCS_H
+ 
+ # include <limits.h>
+ # include <stdio.h>
+ # include "philo_bench.h"
+ 
+ /**
+  * @defgroup philosopher_procs Process Benchmark
+  * @brief Threads versus processes for the same dinner.
+  *
+  * @details
+  * Modes:
+  * - `threads`: the default, one thread per philosopher.
+  * - `processes`: `--processes`, one forked process per philosopher, the
+  *   table and forks in shared memory.
+  * - `workers`: `--workers=k` for every k of the `-k` list, the ring split
+  *   into k processes of threads.
+  * - `unix`, `tcp`: the same with `--link=unix|tcp`, for every
+  *   `--link-delay` of the `-L` list too.
+  *
+  * Every run is a `--run-for` dinner nobody can die at, so it ends with
+  * its wall time. The setup time is the wall time of the whole run less
+  * that of the dinner: starting, seating, joining and clearing away.
+  *
+  * @{
+  */
+ 
+ # define PROCS_MAX_LIST		64
+ # define PROCS_MODE_COUNT	5
+ # define PROCS_WORKERS		2
+ # define PROCS_UNIX			3
+ # define PROCS_TCP			4
+ 
+ /**
+  * @typedef t_procs
+  * @brief Settings of one process benchmark.
+  */
+ typedef struct s_procs
+ {
+	 const char	*philo_bin;               ///< Binary under test
+	 FILE		*out;                     ///< CSV destination
+	 int			modes[PROCS_MAX_LIST];    ///< Modes, by index
+	 int			mode_len;                 ///< Entries in `modes`
+	 int			counts[PROCS_MAX_LIST];   ///< Philosopher counts
+	 int			count_len;                ///< Entries in `counts`
+	 int			workers[PROCS_MAX_LIST];  ///< Worker counts
+	 int			worker_len;               ///< Entries in `workers`
+	 int			delays[PROCS_MAX_LIST];   ///< Link delays (us)
+	 int			delay_len;                ///< Entries in `delays`
+	 int			time_to_eat;              ///< time_to_eat of the runs
+	 int			time_to_sleep;            ///< time_to_sleep of the runs
+	 int			run_for;                  ///< Wall time per run (ms)
+	 int			repeats;                  ///< Runs per point
+	 int			cpus;                     ///< CPUs allowed, 0 for all
+	 int			timeout;                  ///< Extra watchdog (ms)
+	 bool		log;                      ///< Log text to /dev/null
+ }				t_procs;
+ 
+ /**
+  * @typedef t_procs_point
+  * @brief Measurements of one (mode, count, workers, delay, repeat) run.
+  */
+ typedef struct s_procs_point
+ {
+	 int			mode;         ///< Mode, by index
+	 int			count;        ///< Philosophers
+	 int			workers;      ///< Worker processes, from `workers` on
+	 int			delay;        ///< Link delay (us), `unix` and `tcp`
+	 int			repeat;       ///< Repeat index
+	 const char	*outcome;     ///< How the run ended
+	 long		meals;        ///< Meals eaten
+	 long long	runtime;      ///< Dinner length (ms)
+	 double		wait_avg;     ///< Fork wait per meal (us)
+	 double		wait_max;     ///< Longest fork wait (us)
+	 long long	hunger_max;   ///< Longest wait between meals (ms)
+	 long long	contended;    ///< Locks found taken
+	 double		wall;         ///< Wall time of the run (s)
+	 double		cpu;          ///< CPU time of the run (s)
+ }				t_procs_point;
+ 
+ /* === Modes === */
+ const char	**procs_mode(int mode);
+ int			find_procs_mode(const char *name);
+ const char	*procs_mode_name(int mode);
+ 
+ /* === Benchmark === */
+ int			parse_procs_options(t_procs *procs, int argc, char **argv);
+ int			apply_axis_option(t_procs *procs, int opt, char *arg);
+ void		measure_procs(t_procs *procs, t_procs_point *point);
+ int			read_procs_report(t_procs_point *point, const char *path);
+ 
+ /** @} */ // end of philosopher_procs
+ 
+ #endif
+ 
\ No newline at end of file
@@ -0,0 +1,93 @@
+/**
+ * @file philo_scale.h
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Declarations for the `philo-scale` scaling study driver.
+ *
+ * @details
+ * The scaling study runs one scenario family over a range of philosopher
+ * counts and CPU sets and writes one CSV row per measurement: meal
+ * throughput against its ideal, CPU time per meal and how late the monitor
+ * reports a death.
+ *
+ * @ingroup philosopher_scale
+ */
+
+ #ifndef PHILO_SCALE_H
+ # define PHILO_SCALE_H
+ 
+ # include <stdio.h>
+ # include "philo_bench.h"
+ 
+ /**
+  * @defgroup philosopher_scale Scaling Study
+  * @brief Throughput, CPU cost and detection latency versus N and cores.
+  *
+  * @details
+  * Every point of the study is two runs pinned to the same CPUs: a
+  * throughput run where nobody should die, and a detection run where
+  * `time_to_die` is shorter than `time_to_eat`, so the first hungry
+  * philosophers starve at a known deadline. Both logs go through the
+  * `philo-check` rules.
+  *
+  * With `-S`, every point is instead one saturation run: no deaths, no
+  * meal or nap time, no output, for a fixed wall time. Its meals per second
+  * are the yardstick for comparing locking strategies.
+  *
+  * @{
+  */
+ 
+ # define SCALE_MAX_LIST	64
+ 
+ /**
+  * @typedef t_scale
+  * @brief Settings of one scaling study.
+  */
+ typedef struct s_scale
+ {
+	 const char	*philo_bin;                   ///< Binary under test
+	 FILE		*out;                         ///< CSV destination
+	 int			counts[SCALE_MAX_LIST];       ///< Philosopher counts
+	 int			count_len;                    ///< Entries in `counts`
+	 int			cpus[SCALE_MAX_LIST];         ///< CPU set sizes
+	 int			cpu_len;                      ///< Entries in `cpus`
+	 int			time_to_die;                  ///< Throughput run time_to_die
+	 int			time_to_eat;                  ///< time_to_eat of both runs
+	 int			time_to_sleep;                ///< time_to_sleep of both runs
+	 int			meals;                        ///< Meals per philosopher
+	 int			starve_after;                 ///< Detection run time_to_die
+	 int			repeats;                      ///< Runs per point
+	 int			timeout;                      ///< Base watchdog (ms)
+	 int			saturate;                     ///< Saturation run (ms), or 0
+ }				t_scale;
+ 
+ /**
+  * @typedef t_point
+  * @brief Measurements of one (N, CPUs, repeat) point.
+  */
+ typedef struct s_point
+ {
+	 int			count;        ///< Philosophers
+	 int			cpus;         ///< CPUs the runs were pinned to
+	 int			repeat;       ///< Repeat index
+	 const char	*outcome;     ///< How the throughput run ended
+	 long		meals;        ///< Meals completed in the throughput run
+	 double		span;         ///< Simulated time covered by its log (s)
+	 double		cpu;          ///< CPU time of the throughput run (s)
+	 double		ideal;        ///< Meals per second with perfect timing, or 0
+	 long		violations;   ///< Rule violations in both logs
+	 long long	detect;       ///< Death print delay (ms), -1 if no death
+ }				t_point;
+ 
+ /* === Study === */
+ int			parse_scale_options(t_scale *scale, int argc, char **argv);
+ void		set_scale_defaults(t_scale *scale);
+ void		measure_point(t_scale *scale, t_point *point);
+ void		set_scale_arguments(t_scale *scale, t_bench_run *run,
+				 char args[5][16], t_point *point);
+ void		measure_saturation(t_scale *scale, t_point *point);
+ 
+ /** @} */ // end of philosopher_scale
+ 
+ #endif
+ 
\ No newline at end of file
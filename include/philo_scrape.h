@@ -0,0 +1,44 @@
+/**
+ * @file philo_scrape.h
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Declarations for the `philo-scrape` metrics client.
+ *
+ * @details
+ * `philo-scrape` stands in for Prometheus: it polls the `--metrics`
+ * socket of a running `philo` and prints every answer.
+ *
+ * @ingroup philosopher_scrape
+ */
+
+ #ifndef PHILO_SCRAPE_H
+ # define PHILO_SCRAPE_H
+ 
+ # include <stdbool.h>
+ 
+ /**
+  * @defgroup philosopher_scrape Metrics Scraper
+  * @brief Client for the `philo --metrics` socket.
+  *
+  * @{
+  */
+ 
+ # define SCRAPE_ATTACH_MS	10000
+ # define SCRAPE_BUFFER		65536
+ 
+ /**
+  * @typedef t_scraper
+  * @brief Settings of the scraper.
+  */
+ typedef struct s_scraper
+ {
+	 const char	*path;       ///< Socket of `philo --metrics`
+	 int			interval;    ///< Time between scrapes (ms)
+	 int			count;       ///< Scrapes to make, 0 until the dinner ends
+	 bool		http;        ///< Send an HTTP GET, print the whole response
+ }				t_scraper;
+ 
+ /** @} */
+ 
+ #endif
+ 
\ No newline at end of file
@@ -0,0 +1,81 @@
+/**
+ * @file philo_shm.h
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Shared-memory event stream shared by `philo` and its tools.
+ *
+ * @details
+ * With `--format=shm`, `philo` publishes its binary trace records into a
+ * ring of slots in a POSIX shared memory object instead of writing to
+ * stdout. Any number of consumers map the object read-only and follow the
+ * ring; the producer never waits for them and makes no system call per
+ * event. A consumer that falls more than SHM_SLOTS events behind finds
+ * its slots overwritten, and counts the events it lost.
+ *
+ * @ingroup philosopher_shm
+ */
+
+ #ifndef PHILO_SHM_H
+ # define PHILO_SHM_H
+ 
+ # include <stdint.h>
+ # include "philo_trace.h"
+ 
+ /**
+  * @defgroup philosopher_shm Shared-Memory Stream
+  * @brief Layout and protocol of `philo --format=shm`.
+  *
+  * @details
+  * Event `n` (from 0) goes to slot `n % SHM_SLOTS`. The producer sets the
+  * slot's `seq` to 0, writes the record, then sets `seq` to `n + 1` and
+  * `head` to `n + 1`, all with release ordering. A consumer expecting
+  * event `n` below `head` reads `seq`, copies the record and reads `seq`
+  * again: if both are `n + 1` the copy is event `n`, otherwise the slot
+  * was reused and events were lost. `version` is stored last when the
+  * stream is created, `closed` once the dinner is over. The object is
+  * unlinked when `philo` exits; consumers already attached keep it.
+  *
+  * @{
+  */
+ 
+ # define SHM_MAGIC		"PHILOSHM"
+ # define SHM_VERSION	1
+ # define SHM_NAME		"/philo"
+ # define SHM_SLOTS		65536
+ 
+ /**
+  * @typedef t_shm_slot
+  * @brief One event of the ring, with its sequence number.
+  */
+ typedef struct s_shm_slot
+ {
+	 uint64_t		seq;     ///< Event number plus one, 0 while written
+	 t_trace_event	event;   ///< The record
+ }					t_shm_slot;
+ 
+ /**
+  * @typedef t_shm_stream
+  * @brief Whole shared memory object.
+  *
+  * @details
+  * The header fills the first 64-byte cache line and `head` the second,
+  * so that consumers polling `head` share no line with slots being
+  * written.
+  */
+ typedef struct s_shm_stream
+ {
+	 char			magic[8];            ///< SHM_MAGIC, not NUL-terminated
+	 uint32_t		version;             ///< SHM_VERSION, 0 until ready
+	 uint32_t		slot_count;          ///< SHM_SLOTS
+	 uint32_t		closed;              ///< 1 once the dinner is over
+	 uint32_t		unused;              ///< Padding
+	 t_trace_header	header;              ///< Run parameters
+	 uint64_t		head;                ///< Events published so far
+	 char			pad_head[56];        ///< Cache line padding
+	 t_shm_slot		slots[SHM_SLOTS];    ///< The ring
+ }					t_shm_stream;
+ 
+ /** @} */ // end of philosopher_shm
+ 
+ #endif
+ 
\ No newline at end of file
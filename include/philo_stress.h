@@ -0,0 +1,148 @@
+/**
+ * @file philo_stress.h
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Declarations for the `philo-stress` deadlock and starvation hunter.
+ *
+ * @details
+ * The stress runner launches the `philo` binary over a grid of philosopher
+ * counts and timings, several runs at a time, and classifies every run:
+ * - `completed`: everybody ate enough and nobody died
+ * - `died-as-expected`: a death happened where the timings predict one
+ * - `died-unexpectedly`: a death happened where the timings predict none
+ * - `hung`: the watchdog had to kill the run
+ * - `log-invalid`: the output is malformed or the process exited abnormally
+ *
+ * Failing runs are shrunk to a smaller configuration that still fails and
+ * written out as a shell reproducer.
+ *
+ * @ingroup philosopher_stress
+ */
+
+ #ifndef PHILO_STRESS_H
+ # define PHILO_STRESS_H
+ 
+ # include <sys/types.h>
+ # include <limits.h>
+ # include <stdbool.h>
+ 
+ /**
+  * @defgroup philosopher_stress Stress Runner
+  * @brief Parallel grid runner that classifies `philo` runs.
+  *
+  * @details
+  * Builds the cartesian product of the requested philosopher counts and
+  * timings, runs it with one watchdog per run and as many concurrent runs
+  * as there are online cores, then reports and reproduces failures.
+  *
+  * @{
+  */
+ 
+ /* === Expectations and Outcomes === */
+ # define EXPECT_LIVE	0
+ # define EXPECT_DIE		1
+ # define EXPECT_EITHER	2
+ 
+ # define OUT_COMPLETED		0
+ # define OUT_DIED_EXPECTED	1
+ # define OUT_DIED_UNEXPECTED	2
+ # define OUT_HUNG			3
+ # define OUT_LOG_INVALID	4
+ # define OUT_COUNT			5
+ 
+ # define STRESS_MAX_LIST	64
+ # define STRESS_REASON		160
+ 
+ /**
+  * @typedef t_case
+  * @brief One point of the stress grid.
+  *
+  * @details
+  * Contains the five `philo` arguments and the outcome predicted for them
+  * by `expect_outcome`.
+  */
+ typedef struct s_case
+ {
+	 int				count;      ///< Number of philosophers
+	 int				die;        ///< time_to_die in milliseconds
+	 int				eat;        ///< time_to_eat in milliseconds
+	 int				sleep;      ///< time_to_sleep in milliseconds
+	 int				meals;      ///< Meals each philosopher must eat
+	 int				expect;     ///< EXPECT_LIVE, EXPECT_DIE or EXPECT_EITHER
+ }					t_case;
+ 
+ /**
+  * @typedef t_run
+  * @brief A single launched (or finished) execution of one grid case.
+  *
+  * @details
+  * Tracks the child process, its watchdog deadline, where its output goes,
+  * and, once reaped, its classification and a human-readable reason.
+  */
+ typedef struct s_run
+ {
+	 t_case			grid_case;               ///< Configuration being run
+	 int				index;                   ///< Position in the grid
+	 pid_t			pid;                     ///< Child process, 0 when idle
+	 long long		deadline;                ///< Watchdog deadline (ms)
+	 bool			killed;                  ///< Watchdog fired
+	 int				outcome;                 ///< One of the OUT_* values
+	 bool			failed;                  ///< Outcome is not acceptable
+	 char			log_path[PATH_MAX];      ///< Captured stdout
+	 char			err_path[PATH_MAX];      ///< Captured stderr
+	 char			reason[STRESS_REASON];   ///< Why the run was classified
+ }					t_run;
+ 
+ /**
+  * @typedef t_stress
+  * @brief Options and accumulated results of a stress session.
+  *
+  * @details
+  * Holds the grid axes parsed from the command line, the runner settings
+  * (binary, concurrency, watchdog, output directory) and per-outcome tallies.
+  */
+ typedef struct s_stress
+ {
+	 const char		*philo_bin;                   ///< Binary under test
+	 const char		*out_dir;                     ///< Logs and reproducers
+	 int				jobs;                         ///< Concurrent runs
+	 int				timeout;                      ///< Base watchdog (ms)
+	 int				guard;                        ///< Expectation margin (ms)
+	 int				tolerance;                    ///< Log check tolerance (ms)
+	 int				shrink_budget;                ///< Runs spent per shrink
+	 int				attempts;                     ///< Retries per candidate
+	 bool			keep_logs;                    ///< Keep passing logs
+	 int				counts[STRESS_MAX_LIST];      ///< Philosopher counts
+	 int				dies[STRESS_MAX_LIST];        ///< time_to_die values
+	 int				eats[STRESS_MAX_LIST];        ///< time_to_eat values
+	 int				sleeps[STRESS_MAX_LIST];      ///< time_to_sleep values
+	 int				axis_len[4];                  ///< Length of each axis
+	 int				meals;                        ///< Meals per philosopher
+	 t_run			*runs;                        ///< One run per grid case
+	 int				run_count;                    ///< Grid size
+	 int				tally[OUT_COUNT];             ///< Runs per outcome
+	 int				failures;                     ///< Runs that failed
+	 int				next_index;                   ///< Next log index to use
+ }					t_stress;
+ 
+ /* === Grid === */
+ int			parse_stress_options(t_stress *stress, int argc, char **argv);
+ int			build_grid(t_stress *stress);
+ int			expect_outcome(const t_case *grid_case, int guard);
+ int			case_period(const t_case *grid_case);
+ const char	*outcome_name(int outcome);
+ 
+ /* === Runner === */
+ int			launch_run(t_stress *stress, t_run *run);
+ void		run_grid(t_stress *stress);
+ void		run_one(t_stress *stress, t_run *run);
+ void		classify_run(t_stress *stress, t_run *run, int status);
+ long long	stress_clock(void);
+ 
+ /* === Reproducers === */
+ void		write_reproducer(t_stress *stress, t_run *run);
+ 
+ /** @} */ // end of philosopher_stress
+ 
+ #endif
+ 
\ No newline at end of file
@@ -0,0 +1,69 @@
+/**
+ * @file philo_top.h
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Declarations for the `philo-top` live viewer.
+ *
+ * @details
+ * `philo-top` attaches read-only to the stats page of a `philo --live`
+ * run and redraws it at a fixed interval: a summary of the whole table,
+ * then one row per philosopher, the hungriest first by default.
+ *
+ * @ingroup philosopher_top
+ */
+
+ #ifndef PHILO_TOP_H
+ # define PHILO_TOP_H
+ 
+ # include <stdbool.h>
+ # include <stddef.h>
+ # include <stdint.h>
+ # include "philo_live.h"
+ 
+ /**
+  * @defgroup philosopher_top Live Viewer
+  * @brief Rendering of the `philo --live` stats page.
+  *
+  * @{
+  */
+ 
+ # define TOP_BY_SLACK	0
+ # define TOP_BY_ID		1
+ # define TOP_BY_MEALS	2
+ 
+ /**
+  * @typedef t_top
+  * @brief Settings of the viewer.
+  */
+ typedef struct s_top
+ {
+	 const char	*name;       ///< Shared memory object, LIVE_NAME by default
+	 int			delay;       ///< Time between frames (ms)
+	 int			frames;      ///< Frames to draw, 0 until the dinner ends
+	 int			sort;        ///< One of the TOP_BY_* orders
+	 int			rows;        ///< Philosophers shown per frame
+	 bool		batch;       ///< Append frames instead of redrawing
+ }				t_top;
+ 
+ /**
+  * @typedef t_top_row
+  * @brief One philosopher, as copied out of the page for a frame.
+  */
+ typedef struct s_top_row
+ {
+	 int			id;          ///< Philosopher ID
+	 t_live_seat	seat;        ///< Copy of the seat
+	 long long	slack;       ///< Margin to `time_to_die` at the frame (ms)
+ }				t_top_row;
+ 
+ t_live_page	*attach_page(const char *name, size_t *size);
+ long long	copy_rows(const t_live_page *page, t_top_row *rows);
+ void		print_summary(const t_live_page *page, const t_top_row *rows,
+				 long long at, const char *name);
+ void		draw_frame(const t_top *top, const t_live_page *page,
+				 t_top_row *rows);
+ 
+ /** @} */ // end of philosopher_top
+ 
+ #endif
+ 
\ No newline at end of file
@@ -0,0 +1,82 @@
+/**
+ * @file philo_trace.h
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Binary trace format shared by `philo` and its tools.
+ *
+ * @details
+ * With `--format=binary`, `philo` writes one `t_trace_header` followed by
+ * a stream of fixed-size `t_trace_event` records instead of text lines.
+ * Records carry the fork index of every "has taken a fork" event, which
+ * the text log cannot express. All fields are in host byte order.
+ *
+ * @ingroup philosopher_trace
+ */
+
+ #ifndef PHILO_TRACE_H
+ # define PHILO_TRACE_H
+ 
+ # include <stdint.h>
+ 
+ /**
+  * @defgroup philosopher_trace Binary Trace
+  * @brief On-disk layout of `philo --format=binary` output.
+  *
+  * @details
+  * A trace is a 40-byte header announcing the run's parameters, then
+  * 16-byte event records in print order.
+  *
+  * @{
+  */
+ 
+ # define TRACE_MAGIC	"PHILOTRC"
+ # define TRACE_VERSION	1
+ 
+ /* === Event Kinds === */
+ # define TRACE_TAKE		1
+ # define TRACE_EAT		2
+ # define TRACE_SLEEP	3
+ # define TRACE_THINK	4
+ # define TRACE_DIE		5
+ # define TRACE_END		6
+ 
+ /**
+  * @typedef t_trace_header
+  * @brief First record of a binary trace.
+  *
+  * @details
+  * Contains the magic string, the format version and the command-line
+  * parameters of the run, so a trace can be checked on its own.
+  */
+ typedef struct s_trace_header
+ {
+	 char		magic[8];            ///< TRACE_MAGIC, not NUL-terminated
+	 uint32_t	version;             ///< TRACE_VERSION
+	 uint32_t	philosopher_count;   ///< Number of philosophers
+	 uint32_t	time_to_die;         ///< time_to_die in milliseconds
+	 uint32_t	time_to_eat;         ///< time_to_eat in milliseconds
+	 uint32_t	time_to_sleep;       ///< time_to_sleep in milliseconds
+	 int32_t		must_eat_count;      ///< Meal quota, -1 if none
+	 int64_t		start_time;          ///< Wall-clock start in milliseconds
+ }				t_trace_header;
+ 
+ /**
+  * @typedef t_trace_event
+  * @brief One logged philosopher action.
+  *
+  * @details
+  * `fork` is the fork index for TRACE_TAKE and -1 for every other kind.
+  * TRACE_END is written once, when every philosopher ate enough.
+  */
+ typedef struct s_trace_event
+ {
+	 uint32_t	time;   ///< Milliseconds since start_time
+	 uint32_t	id;     ///< Philosopher id (1-based)
+	 int32_t		fork;   ///< Fork index, or -1
+	 uint32_t	kind;   ///< One of the TRACE_* kinds
+ }				t_trace_event;
+ 
+ /** @} */ // end of philosopher_trace
+ 
+ #endif
+ 
\ No newline at end of file
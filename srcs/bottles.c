@@ -0,0 +1,131 @@
+/**
+ * @file bottles.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Which bottles a drinking philosopher wants (`--drinking`).
+ *
+ * @details
+ * A philosopher's bottles are its forks: the two of the ring, or those of
+ * its seat with `--graph`, lowest index first. Each session it wants each
+ * of them with the `--drinking` probability, and always one of them at
+ * least. The choice is a hash of the session's draw and the bottle, so it
+ * can be worked out again when the bottles are checked, taken and
+ * returned, without being stored.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+
+ /**
+  * @brief Scramble a draw (splitmix64).
+  *
+  * @param z Value to scramble.
+  * @return A value that looks uniformly random for any change of `z`.
+  *
+  * @ingroup philosopher_core
+  */
+ uint64_t	mix_draw(uint64_t z)
+ {
+	 z += 0x9e3779b97f4a7c15ULL;
+	 z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	 z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+	 return (z ^ (z >> 31));
+ }
+ 
+ /**
+  * @brief Count a philosopher's bottles.
+  *
+  * @param philo Philosopher.
+  * @return Forks of its seat.
+  *
+  * @ingroup philosopher_core
+  */
+ int	count_bottles(t_philo *philo)
+ {
+	 t_table	*table;
+ 
+	 table = philo->table;
+	 if (!table->menu.graph)
+		 return (2);
+	 return (table->fork_start[philo->id] - table->fork_start[philo->id - 1]);
+ }
+ 
+ /**
+  * @brief Find one of a philosopher's bottles.
+  *
+  * @param philo Philosopher.
+  * @param k Which bottle, from 0, lowest fork index first.
+  * @return Its fork index.
+  *
+  * @ingroup philosopher_core
+  */
+ int	bottle_at(t_philo *philo, int k)
+ {
+	 t_table	*table;
+ 
+	 table = philo->table;
+	 if (table->menu.graph)
+		 return (table->fork_list[table->fork_start[philo->id - 1] + k]);
+	 if ((k == 0) == (philo->left_fork < philo->right_fork))
+		 return (philo->left_fork);
+	 return (philo->right_fork);
+ }
+ 
+ /**
+  * @brief Tell whether a philosopher wants one of its bottles this session.
+  *
+  * @param philo Philosopher.
+  * @param k Which bottle, from 0.
+  * @param count Its number of bottles, above zero.
+  * @return Whether bottle `k` is drawn, or is the one it always wants.
+  *
+  * @ingroup philosopher_core
+  */
+ bool	is_wanted(t_philo *philo, int k, int count)
+ {
+	 if (mix_draw(philo->draw) % count == (uint64_t) k)
+		 return (true);
+	 return (mix_draw(philo->draw ^ ((k + 1) * 0xd1b54a32d192ed03ULL)) % 100
+		 < (uint64_t) philo->table->menu.drinking);
+ }
+ 
+ /**
+  * @brief Check, take or return the bottles of a session.
+  *
+  * @details
+  * Called with the cellar's padlock held.
+  *
+  * @param philo Philosopher drinking.
+  * @param mode BOTTLE_CHECK, BOTTLE_TAKE or BOTTLE_RETURN.
+  * @return `false` if checking found a wanted bottle taken.
+  *
+  * @ingroup philosopher_core
+  */
+ bool	tap_bottles(t_philo *philo, int mode)
+ {
+	 uint64_t	*held;
+	 uint64_t	bit;
+	 int			bottle;
+	 int			count;
+	 int			k;
+ 
+	 held = philo->table->cellar.held;
+	 count = count_bottles(philo);
+	 k = -1;
+	 while (++k < count)
+	 {
+		 if (!is_wanted(philo, k, count))
+			 continue ;
+		 bottle = bottle_at(philo, k);
+		 bit = (uint64_t) 1 << (bottle % 64);
+		 if (mode == BOTTLE_CHECK && (held[bottle / 64] & bit))
+			 return (false);
+		 if (mode == BOTTLE_TAKE)
+			 held[bottle / 64] |= bit;
+		 else if (mode == BOTTLE_RETURN)
+			 held[bottle / 64] &= ~bit;
+	 }
+	 return (true);
+ }
+ 
\ No newline at end of file
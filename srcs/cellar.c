@@ -0,0 +1,172 @@
+/**
+ * @file cellar.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief All-or-nothing bottle taking for `--drinking`.
+ *
+ * @details
+ * The cellar is a lock table: one bit per bottle, all behind one mutex.
+ * A philosopher checks every bottle of its session and takes them all in
+ * one go, or waits until some are returned and checks again, so it never
+ * holds a bottle while waiting for another. Returns wake every waiter,
+ * which keeps the table simple at the price of wake-ups that find their
+ * bottles still taken.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+
+ /**
+  * @brief Open the cellar and seed everyone's draws.
+  *
+  * @details
+  * Called once the seats are laid and before any thread starts. The draws
+  * depend on `--seed` and the philosopher only. Bottles are tied to fixed
+  * neighbours, so drinking cannot go with `--seats` (see menu_check.c).
+  *
+  * @param table Pointer to the table.
+  *
+  * @note Exits the program if the cellar cannot be set up.
+  *
+  * @ingroup philosopher_core
+  */
+ void	open_cellar(t_table *table)
+ {
+	 int	i;
+ 
+	 table->cellar.held = NULL;
+	 if (!table->menu.drinking)
+		 return ;
+	 i = -1;
+	 while (++i < table->seat_count)
+		 table->philo[i].draw = mix_draw(((uint64_t) table->menu.seed << 32)
+				 | table->philo[i].id);
+	 table->cellar.held = share_alloc(&table->menu, sizeof(uint64_t)
+			 * (table->fork_count / 64 + 1));
+	 if (table->cellar.held && pthread_mutex_init(&table->cellar.padlock,
+			 padlock_kind(&table->menu)) == 0)
+	 {
+		 if (pthread_cond_init(&table->cellar.returned,
+				 signal_kind(&table->menu)) == 0)
+			 return ;
+		 pthread_mutex_destroy(&table->cellar.padlock);
+	 }
+	 ft_putstr_fd(2, "Error: couldn't open the cellar\n");
+	 share_free(&table->menu, table->cellar.held, sizeof(uint64_t)
+		 * (table->fork_count / 64 + 1));
+	 clean_table(table);
+	 exit(EXIT_FAILURE);
+ }
+ 
+ /**
+  * @brief Close the cellar once every philosopher is joined.
+  *
+  * @param table Pointer to the table.
+  *
+  * @ingroup philosopher_core
+  */
+ void	close_cellar(t_table *table)
+ {
+	 if (!table->cellar.held)
+		 return ;
+	 pthread_cond_destroy(&table->cellar.returned);
+	 pthread_mutex_destroy(&table->cellar.padlock);
+	 share_free(&table->menu, table->cellar.held, sizeof(uint64_t)
+		 * (table->fork_count / 64 + 1));
+	 table->cellar.held = NULL;
+ }
+ 
+ /**
+  * @internal
+  * @brief Wait until the bottles of this session are free and take them.
+  *
+  * @details
+  * A waiter woken with the padlock of a dead process (EOWNERDEAD, with
+  * `--processes`) marks it consistent, as `take_padlock` does, and checks
+  * again.
+  *
+  * @param philo Philosopher about to drink.
+  * @return When the bottles were taken (ms).
+  *
+  * @ingroup philosopher_core
+  */
+ static long long	wait_bottles(t_philo *philo)
+ {
+	 t_cellar	*cellar;
+	 long long	asked;
+	 long long	taken;
+ 
+	 cellar = &philo->table->cellar;
+	 asked = read_stopwatch(philo->table);
+	 take_padlock(philo->table, &cellar->padlock);
+	 while (!tap_bottles(philo, BOTTLE_CHECK))
+		 if (pthread_cond_wait(&cellar->returned, &cellar->padlock)
+			 == EOWNERDEAD)
+			 pthread_mutex_consistent(&cellar->padlock);
+	 tap_bottles(philo, BOTTLE_TAKE);
+	 pthread_mutex_unlock(&cellar->padlock);
+	 taken = get_current_time();
+	 note_forks(philo, asked);
+	 return (taken);
+ }
+ 
+ /**
+  * @brief Take the bottles of this session, all at once, and start drinking.
+  *
+  * @details
+  * Each bottle taken is logged as a fork, when the whole set was, and the
+  * lines go to `print_order` together with the "is eating" one, up to
+  * POUR_BATCH at a time; the wait goes on the tab, as for forks.
+  *
+  * @param philo Philosopher about to drink.
+  * @return When the session started (ms), from the "is eating" line.
+  *
+  * @ingroup philosopher_core
+  */
+ long long	pour_bottles(t_philo *philo)
+ {
+	 t_order		order[POUR_BATCH];
+	 long long	taken;
+	 int			count;
+	 int			n;
+	 int			k;
+ 
+	 taken = wait_bottles(philo);
+	 count = count_bottles(philo);
+	 n = 0;
+	 k = -1;
+	 while (++k < count)
+	 {
+		 if (!is_wanted(philo, k, count))
+			 continue ;
+		 order[n++] = (t_order){TAKE, bottle_at(philo, k), taken};
+		 if (n == POUR_BATCH - 1)
+		 {
+			 print_order(philo, order, n);
+			 n = 0;
+		 }
+	 }
+	 order[n] = (t_order){EAT, -1, taken};
+	 return (print_order(philo, order, n + 1));
+ }
+ 
+ /**
+  * @brief Return the bottles of this session and draw the next one's.
+  *
+  * @param philo Philosopher who just drank.
+  *
+  * @ingroup philosopher_core
+  */
+ void	return_bottles(t_philo *philo)
+ {
+	 t_cellar	*cellar;
+ 
+	 cellar = &philo->table->cellar;
+	 take_padlock(NULL, &cellar->padlock);
+	 tap_bottles(philo, BOTTLE_RETURN);
+	 pthread_cond_broadcast(&cellar->returned);
+	 pthread_mutex_unlock(&cellar->padlock);
+	 philo->draw = mix_draw(philo->draw);
+ }
+ 
\ No newline at end of file
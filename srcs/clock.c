@@ -0,0 +1,121 @@
+/**
+ * @file clock.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief The dinner clock, which `--control` can stop and restart.
+ *
+ * @details
+ * Every timestamp of the dinner comes from `get_current_time`: the log,
+ * meals, naps, the monitor's deadlines and the `--run-for` limit. While
+ * the clock is frozen it keeps returning the time it was frozen at, so no
+ * philosopher gets closer to starving and nobody's nap ends. Thawing it
+ * moves the time lost behind the dinner, which resumes where it stopped.
+ *
+ * The clock is only frozen and thawed by the control thread; readers take
+ * no lock, just two atomic loads.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+
+ /**
+  * @internal
+  * @brief The one dinner clock of the process.
+  *
+  * @return The clock, running at first.
+  *
+  * @ingroup philosopher_core
+  */
+ static t_clock	*dinner_clock(void)
+ {
+	 static t_clock	clock = {0, LLONG_MAX};
+ 
+	 return (&clock);
+ }
+ 
+ /**
+  * @brief Get the current dinner time in milliseconds.
+  *
+  * @details
+  * The time of day from `gettimeofday`, minus the time the clock spent
+  * frozen; while frozen, the time it was frozen at. `ceiling` is read
+  * before `lost`, which `thaw_clock` updates first, so a reader never sees
+  * the time jump ahead by the length of the pause.
+  *
+  * @return Current time in milliseconds.
+  */
+ long long	get_current_time(void)
+ {
+	 struct timeval	timeval;
+	 t_clock			*clock;
+	 long long		ceiling;
+	 long long		now;
+ 
+	 clock = dinner_clock();
+	 ceiling = __atomic_load_n(&clock->ceiling, __ATOMIC_ACQUIRE);
+	 gettimeofday(&timeval, NULL);
+	 now = (timeval.tv_sec * 1000) + (timeval.tv_usec / 1000)
+		 - __atomic_load_n(&clock->lost, __ATOMIC_RELAXED);
+	 if (now > ceiling)
+		 return (ceiling);
+	 return (now);
+ }
+ 
+ /**
+  * @brief Stop the dinner clock at the current time.
+  *
+  * @return The time it stopped at, or was already stopped at.
+  *
+  * @ingroup philosopher_core
+  */
+ long long	freeze_clock(void)
+ {
+	 t_clock		*clock;
+	 long long	now;
+ 
+	 clock = dinner_clock();
+	 if (is_clock_frozen())
+		 return (clock->ceiling);
+	 now = get_current_time();
+	 __atomic_store_n(&clock->ceiling, now, __ATOMIC_RELEASE);
+	 return (now);
+ }
+ 
+ /**
+  * @brief Restart the dinner clock where it stopped.
+  *
+  * @return How long it was stopped (ms), 0 if it was running.
+  *
+  * @ingroup philosopher_core
+  */
+ long long	thaw_clock(void)
+ {
+	 struct timeval	timeval;
+	 t_clock			*clock;
+	 long long		stopped;
+ 
+	 clock = dinner_clock();
+	 if (!is_clock_frozen())
+		 return (0);
+	 gettimeofday(&timeval, NULL);
+	 stopped = (timeval.tv_sec * 1000) + (timeval.tv_usec / 1000)
+		 - clock->lost - clock->ceiling;
+	 __atomic_store_n(&clock->lost, clock->lost + stopped, __ATOMIC_RELAXED);
+	 __atomic_store_n(&clock->ceiling, LLONG_MAX, __ATOMIC_RELEASE);
+	 return (stopped);
+ }
+ 
+ /**
+  * @brief Whether the dinner clock is stopped.
+  *
+  * @return `true` between `freeze_clock` and `thaw_clock`.
+  *
+  * @ingroup philosopher_core
+  */
+ bool	is_clock_frozen(void)
+ {
+	 return (__atomic_load_n(&dinner_clock()->ceiling, __ATOMIC_ACQUIRE)
+		 != LLONG_MAX);
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,123 @@
+/**
+ * @file commands.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief The commands of the `--control` socket.
+ *
+ * @details
+ * - `pause` stops the dinner clock (see clock.c) and `resume` restarts it
+ * - `die`, `eat` or `sleep` followed by a number of ms publishes new
+ *   timings (see timing.c), taken up at the next phase boundary
+ * - `join` followed by an ID seats a new philosopher to the right of that
+ *   one, and `leave` followed by an ID sends that one away (see
+ *   seating.c); both need `--seats`
+ * - `show` prints the timings in force, whether the clock is stopped and
+ *   how many philosophers are seated
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+
+ /**
+  * @internal
+  * @brief Name the state of the dinner clock.
+  *
+  * @return "paused" while it is frozen, "running" otherwise.
+  *
+  * @ingroup philosopher_core
+  */
+ static const char	*clock_name(void)
+ {
+	 if (is_clock_frozen())
+		 return ("paused");
+	 return ("running");
+ }
+ 
+ /**
+  * @internal
+  * @brief Carry out a command of one word.
+  *
+  * @param table Pointer to the shared simulation table.
+  * @param word The command.
+  * @param reply Receives the answer, CONTROL_LINE bytes at most.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	obey_word(t_table *table, const char *word, char *reply)
+ {
+	 t_timing	*timing;
+ 
+	 timing = read_timing(table);
+	 if (is_same(word, "pause"))
+		 snprintf(reply, CONTROL_LINE, "ok paused at %lld\n",
+			 freeze_clock() - __atomic_load_n(&table->start_time,
+				 __ATOMIC_ACQUIRE));
+	 else if (is_same(word, "resume"))
+		 snprintf(reply, CONTROL_LINE, "ok resumed after %lld ms\n",
+			 thaw_clock());
+	 else if (is_same(word, "show"))
+		 snprintf(reply, CONTROL_LINE, "ok die %d eat %d sleep %d %s "
+			 "seated %d\n", timing->time_to_die, timing->time_to_eat,
+			 timing->time_to_sleep, clock_name(),
+			 __atomic_load_n(&table->philosopher_count, __ATOMIC_RELAXED));
+	 else
+		 snprintf(reply, CONTROL_LINE, "error: unknown command\n");
+ }
+ 
+ /**
+  * @internal
+  * @brief Carry out a command followed by a number.
+  *
+  * @param table Pointer to the shared simulation table.
+  * @param word The command.
+  * @param value Its argument.
+  * @param reply Receives the answer, CONTROL_LINE bytes at most.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	obey_pair(t_table *table, const char *word, const char *value,
+	 char *reply)
+ {
+	 long long	number;
+ 
+	 number = -1;
+	 if (is_number(value))
+		 number = ft_atoi(value);
+	 if (is_same(word, "join"))
+		 seat_guest(table, number, reply);
+	 else if (is_same(word, "leave"))
+		 unseat_guest(table, number, reply);
+	 else if (retime(table, word, number) == 0)
+		 snprintf(reply, CONTROL_LINE, "ok\n");
+	 else
+		 snprintf(reply, CONTROL_LINE, "error: unknown command or value\n");
+ }
+ 
+ /**
+  * @brief Carry out one command of the control socket and word its answer.
+  *
+  * @param table Pointer to the shared simulation table.
+  * @param line Command, without its newline.
+  * @param reply Receives the answer, CONTROL_LINE bytes at most, or an
+  * empty string for an empty line.
+  *
+  * @ingroup philosopher_core
+  */
+ void	obey(t_table *table, const char *line, char *reply)
+ {
+	 char	word[16];
+	 char	value[16];
+	 char	extra;
+	 int		words;
+ 
+	 words = sscanf(line, "%15s %15s %c", word, value, &extra);
+	 reply[0] = '\0';
+	 if (words == 1)
+		 obey_word(table, word, reply);
+	 else if (words == 2)
+		 obey_pair(table, word, value, reply);
+	 else if (words > 2)
+		 snprintf(reply, CONTROL_LINE, "error: unknown command\n");
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,139 @@
+/**
+ * @file control.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief The `--control` socket: pause, resume and re-time the dinner.
+ *
+ * @details
+ * A thread of its own accepts one client at a time on a Unix domain
+ * socket and answers every line it sends with one line, starting with
+ * `ok` or `error` (see commands.c). The server stops with the dinner.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #define _GNU_SOURCE
+ #include "../include/philo.h"
+ #include <poll.h>
+ #include <sys/socket.h>
+ 
+ /**
+  * @internal
+  * @brief Answer every complete line received so far.
+  *
+  * @param table Pointer to the shared simulation table.
+  * @param client Connected client.
+  * @param line Bytes received, NUL-terminated.
+  * @param filled Number of bytes received.
+  * @return Number of bytes left, the start of a line yet to be completed.
+  *
+  * @ingroup philosopher_core
+  */
+ static size_t	obey_lines(t_table *table, int client, char *line,
+	 size_t filled)
+ {
+	 char	reply[CONTROL_LINE];
+	 char	*end;
+ 
+	 end = memchr(line, '\n', filled);
+	 while (end)
+	 {
+		 *end = '\0';
+		 obey(table, line, reply);
+		 send_all(client, reply, strlen(reply));
+		 filled -= end + 1 - line;
+		 memmove(line, end + 1, filled + 1);
+		 end = memchr(line, '\n', filled);
+	 }
+	 if (filled < CONTROL_LINE - 1)
+		 return (filled);
+	 send_all(client, "error: line too long\n", 21);
+	 return (0);
+ }
+ 
+ /**
+  * @internal
+  * @brief Serve one client until it leaves or the dinner ends.
+  *
+  * @param table Pointer to the shared simulation table.
+  * @param client Connected client.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	talk(t_table *table, int client)
+ {
+	 char			line[CONTROL_LINE];
+	 struct pollfd	peer;
+	 ssize_t			got;
+	 size_t			filled;
+ 
+	 peer = (struct pollfd){.fd = client, .events = POLLIN};
+	 filled = 0;
+	 while (!__atomic_load_n(&table->end_flag, __ATOMIC_ACQUIRE))
+	 {
+		 if (poll(&peer, 1, CONTROL_POLL_MS) <= 0)
+			 continue ;
+		 got = recv(client, line + filled, CONTROL_LINE - 1 - filled, 0);
+		 if (got <= 0)
+			 return ;
+		 filled += got;
+		 line[filled] = '\0';
+		 filled = obey_lines(table, client, line, filled);
+	 }
+ }
+ 
+ /**
+  * @internal
+  * @brief Routine of the control thread.
+  *
+  * @param arg Pointer to the shared simulation table.
+  * @return Always NULL.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	*serve_control(void *arg)
+ {
+	 t_table			*table;
+	 struct pollfd	listener;
+	 int				client;
+ 
+	 table = (t_table *)arg;
+	 listener = (struct pollfd){.fd = table->control_fd, .events = POLLIN};
+	 while (!__atomic_load_n(&table->end_flag, __ATOMIC_ACQUIRE))
+	 {
+		 if (poll(&listener, 1, CONTROL_POLL_MS) <= 0)
+			 continue ;
+		 client = accept4(table->control_fd, NULL, NULL, SOCK_CLOEXEC);
+		 if (client == -1)
+			 continue ;
+		 talk(table, client);
+		 close(client);
+	 }
+	 return (NULL);
+ }
+ 
+ /**
+  * @brief Listen on the `--control` socket and start obeying it.
+  *
+  * @param table Pointer to the table, rules set.
+  *
+  * @note Exits the program if the socket cannot be set up.
+  *
+  * @ingroup philosopher_core
+  */
+ void	open_control(t_table *table)
+ {
+	 if (!table->menu.control)
+		 return ;
+	 table->control_fd = listen_on(table->menu.control);
+	 if (table->control_fd == -1
+		 || pthread_create(&table->control, NULL, serve_control, table))
+	 {
+		 ft_putstr_fd(2, "Couldn't open the control socket\n");
+		 if (table->control_fd != -1)
+			 close(table->control_fd);
+		 clean_table(table);
+		 exit(EXIT_FAILURE);
+	 }
+ }
+ 
\ No newline at end of file
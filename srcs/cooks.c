@@ -2,11 +2,10 @@
  * @file cooks.c
  * @author Toonsa
  * @date 2025/01/25
- * @brief Utility functions for time and string output.
+ * @brief Utility functions for integer parsing and string output.
  *
  * @details
  * Contains helper functions used throughout the philosopher simulation:
- * - Timestamp acquisition
  * - Safe integer parsing
  * - Error-resilient string output
  * 
@@ -15,23 +14,6 @@
 
  #include "../include/philo.h"
 
- /**
-  * @brief Get the current system time in milliseconds.
-  *
-  * @details
-  * Retrieves the current time of day using `gettimeofday` and returns
-  * the timestamp in milliseconds.
-  * 
-  * @return Current time in milliseconds.
-  */
- long long	get_current_time(void)
- {
-	 struct timeval	timeval;
- 
-	 gettimeofday(&timeval, NULL);
-	 return ((timeval.tv_sec * 1000) + (timeval.tv_usec / 1000));
- }
- 
  /**
   * @internal
   * @brief Check whether adding a digit would overflow `INT_MAX`.
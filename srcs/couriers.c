@@ -0,0 +1,79 @@
+/**
+ * @file couriers.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Taking the forks of the ring, by message across a `--link`.
+ *
+ * @details
+ * With `--link`, the last philosopher of a wing never touches the lock
+ * of its right fork, which belongs to the next wing: it sends an ask to
+ * that wing's porter (see porters.c) and waits for the grant, then sends
+ * the fork back without waiting for anything, so that its return is in
+ * flight while it sleeps and thinks. Every other fork is a lock of its
+ * own, as without `--link`.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+
+ /**
+  * @internal
+  * @brief Find the link a fork is asked for on.
+  *
+  * @param philo Philosopher using the fork.
+  * @param fork Fork index.
+  * @return The philosopher's end of the link, or -1 for a fork at hand.
+  *
+  * @ingroup philosopher_core
+  */
+ static int	find_link(t_philo *philo, int fork)
+ {
+	 if (!philo->table->links || fork != philo->right_fork)
+		 return (-1);
+	 return (philo->table->links[2 * fork + 1]);
+ }
+ 
+ /**
+  * @brief Take one fork of the ring.
+  *
+  * @details
+  * If the link is broken, the wing across it is gone, and the fork with
+  * it is nobody else's: it is taken as granted.
+  *
+  * @param philo Philosopher taking it.
+  * @param fork Fork index.
+  *
+  * @ingroup philosopher_core
+  */
+ void	take_fork(t_philo *philo, int fork)
+ {
+	 t_slip	grant;
+	 int		fd;
+ 
+	 fd = find_link(philo, fork);
+	 if (fd < 0)
+		 take_padlock(philo->table, &philo->table->fork_padlock[fork]);
+	 else if (send_slip(fd, SLIP_ASK, fork) && read_slips(fd, &grant, 1))
+		 hold_slip(&grant, philo->table->menu.link_delay);
+ }
+ 
+ /**
+  * @brief Put back one fork of the ring.
+  *
+  * @param philo Philosopher who took it.
+  * @param fork Fork index.
+  *
+  * @ingroup philosopher_core
+  */
+ void	put_fork(t_philo *philo, int fork)
+ {
+	 int	fd;
+ 
+	 fd = find_link(philo, fork);
+	 if (fd < 0)
+		 pthread_mutex_unlock(&philo->table->fork_padlock[fork]);
+	 else
+		 send_slip(fd, SLIP_RETURN, fork);
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,135 @@
+/**
+ * @file courtesy.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief How philosophers with timings of their own make way for others.
+ *
+ * @details
+ * Once a `--scenario` gives philosophers different timings, the parity
+ * rule and the fixed stagger no longer keep everybody fed: a short
+ * `time_to_die` next to a long meal starves. So, only then, a philosopher
+ * about to take its forks first lets a neighbour who is closer to
+ * starving, and would starve during its meal, eat before it; and the
+ * stagger waits for the longest meal around, not one's own. Neighbours
+ * are those of the first seating, which `--scenario` keeps fixed.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+
+ /**
+  * @internal
+  * @brief Get one of a philosopher's neighbours.
+  *
+  * @param philo Philosopher.
+  * @param side -1 for the one on its left, 1 for the one on its right.
+  * @return The neighbour.
+  *
+  * @ingroup philosopher_core
+  */
+ static t_philo	*neighbour(t_philo *philo, int side)
+ {
+	 int	count;
+ 
+	 count = philo->table->philosopher_count;
+	 return (&philo->table->philo[(philo->id - 1 + count + side) % count]);
+ }
+ 
+ /**
+  * @brief Get how long a philosopher can still wait for its forks.
+  *
+  * @details
+  * A meal only counts once finished, so this is its slack to its own
+  * `time_to_die` minus its own meal. Philosophers making way around a
+  * re-linked ring weigh it too (see ushers.c).
+  *
+  * @param philo Philosopher, read without a lock.
+  * @param now Current dinner time (ms).
+  * @return The time left before it must sit down (ms).
+  *
+  * @ingroup philosopher_core
+  */
+ long long	urgency(t_philo *philo, long long now)
+ {
+	 t_timing	timing;
+ 
+	 own_timing(philo, &timing);
+	 return (timing.time_to_die - timing.time_to_eat
+		 - (now - __atomic_load_n(&philo->last_meal, __ATOMIC_RELAXED)));
+ }
+ 
+ /**
+  * @brief Wait while a neighbour needs the forks more.
+  *
+  * @details
+  * Waits, holding no fork, while a neighbour must sit down sooner than
+  * the philosopher, and before its meal would be over. Both times shrink
+  * together, so this only lasts until that neighbour has eaten, or the
+  * dinner ends; and of two neighbours only the one with more time waits.
+  * Does nothing without `--scenario`.
+  *
+  * @param philo Philosopher about to take its forks.
+  * @param time_to_eat Length of its meal (ms).
+  *
+  * @ingroup philosopher_core
+  */
+ void	wait_turn(t_philo *philo, int time_to_eat)
+ {
+	 long long	now;
+	 long long	mine;
+	 long long	theirs;
+ 
+	 if (!philo->table->menu.scenario)
+		 return ;
+	 while (!is_dinner_over(philo, false))
+	 {
+		 now = get_current_time();
+		 mine = urgency(philo, now);
+		 theirs = urgency(neighbour(philo, -1), now);
+		 if (urgency(neighbour(philo, 1), now) < theirs)
+			 theirs = urgency(neighbour(philo, 1), now);
+		 if (theirs >= mine || theirs >= time_to_eat)
+			 return ;
+		 usleep(YIELD_NAP);
+	 }
+ }
+ 
+ /**
+  * @brief Get how long a philosopher's stagger should wait.
+  *
+  * @details
+  * Without `--scenario` this is its own meal, as every meal is the same.
+  * With one, it is the longest meal among it and its neighbours, but never
+  * more than half the time it can wait before its own meal must start,
+  * so that the stagger cannot starve it.
+  *
+  * @param philo Philosopher.
+  * @param time_to_eat Length of its own meal (ms).
+  * @return How long to wait (ms).
+  *
+  * @ingroup philosopher_core
+  */
+ int	meal_around(t_philo *philo, int time_to_eat)
+ {
+	 t_timing	timing;
+	 long long	spare;
+	 int			longest;
+ 
+	 if (!philo->table->menu.scenario)
+		 return (time_to_eat);
+	 longest = time_to_eat;
+	 own_timing(neighbour(philo, -1), &timing);
+	 if (timing.time_to_eat > longest)
+		 longest = timing.time_to_eat;
+	 own_timing(neighbour(philo, 1), &timing);
+	 if (timing.time_to_eat > longest)
+		 longest = timing.time_to_eat;
+	 spare = urgency(philo, get_current_time()) / 2;
+	 if (spare < longest)
+		 longest = spare;
+	 if (longest < 0)
+		 longest = 0;
+	 return (longest);
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,64 @@
+/**
+ * @file cutlery.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Taking and putting back the forks of a `--graph` seat.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+
+ /**
+  * @brief Take every fork of a philosopher's seat, and start the meal.
+  *
+  * @details
+  * The forks are taken one after the other in increasing index, the
+  * global order that keeps any graph free of deadlock, each logged when
+  * taken. The wait for all of them goes on the tab, as for two. A
+  * philosopher sharing no fork eats right away.
+  *
+  * @param philo Pointer to the philosopher about to eat.
+  * @return When the meal started (ms), from the "is eating" line.
+  *
+  * @ingroup philosopher_core
+  */
+ long long	seize_forks(t_philo *philo)
+ {
+	 t_table		*table;
+	 long long	asked;
+	 long long	taken;
+	 int			i;
+ 
+	 table = philo->table;
+	 asked = read_stopwatch(table);
+	 taken = get_current_time();
+	 i = table->fork_start[philo->id - 1] - 1;
+	 while (++i < table->fork_start[philo->id])
+	 {
+		 take_padlock(table, &table->fork_padlock[table->fork_list[i]]);
+		 taken = get_current_time();
+		 print_order(philo, &(t_order){TAKE, table->fork_list[i], taken}, 1);
+	 }
+	 note_forks(philo, asked);
+	 return (print_order(philo, &(t_order){EAT, -1, taken}, 1));
+ }
+ 
+ /**
+  * @brief Put back every fork of a philosopher's seat.
+  *
+  * @param philo Pointer to the philosopher who just ate.
+  *
+  * @ingroup philosopher_core
+  */
+ void	release_forks(t_philo *philo)
+ {
+	 t_table	*table;
+	 int		i;
+ 
+	 table = philo->table;
+	 i = table->fork_start[philo->id];
+	 while (--i >= table->fork_start[philo->id - 1])
+		 pthread_mutex_unlock(&table->fork_padlock[table->fork_list[i]]);
+ }
+ 
\ No newline at end of file
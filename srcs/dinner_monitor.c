@@ -14,52 +14,45 @@
 
  #include "../include/philo.h"
 
- /**
-  * @brief Free allocated memory for philosophers and forks.
-  *
-  * @details
-  * Releases the memory allocated for the philosopher array
-  * and the fork mutex array.
-  *
-  * @param table Pointer to the shared simulation table.
-  *
-  * @ingroup philosopher_core
-  */
- void	clean_table(t_table *table)
- {
-	 free (table->philo);
-	 free (table->fork_padlock);
- }
- 
  /**
   * @internal
-  * @brief Destroy all mutexes initialized for the simulation.
+  * @brief Put a table away: its bottles, mutexes and memory.
   *
   * @details
-  * Destroys fork mutexes as well as the print, eat, and end control mutexes.
+  * Destroys fork mutexes as well as the print, pass, eat, and end control
+  * mutexes, then frees the table's dynamic memory.
   *
   * @param table Pointer to the shared simulation table.
   *
   * @ingroup philosopher_core
   */
- static void	unset_rules(t_table *table)
+ static void	clear_table(t_table *table)
  {
 	 int	i;
  
+	 close_cellar(table);
 	 i = -1;
-	 while (++i < table->philosopher_count)
+	 while (++i < table->fork_count)
 		 pthread_mutex_destroy(&table->fork_padlock[i]);
 	 pthread_mutex_destroy(&table->print_padlock);
+	 pthread_mutex_destroy(&table->pass_padlock);
 	 pthread_mutex_destroy(&table->eat_padlock);
 	 pthread_mutex_destroy(&table->end_padlock);
+	 clean_table(table);
  }
  
  /**
   * @brief Gracefully ends the simulation and cleans up.
   *
   * @details
-  * Waits for all philosopher threads to finish, destroys all
-  * synchronization primitives, and frees dynamic memory.
+  * Waits for the control server, which may still be seating a guest, then
+  * for every philosopher thread or process ever started. A `--tables`
+  * annex stops there, and its host goes on once every annex has: it waits
+  * for the sampler and the metrics server, sends the output still held by
+  * the dumbwaiter, prints the summaries of a quiet dinner and the
+  * `--report` JSON, presents the bill of a `--run-for` dinner, destroys
+  * all synchronization primitives, and frees dynamic memory, annexes
+  * first.
   *
   * @param table Pointer to the shared simulation table.
   *
@@ -69,11 +62,23 @@
  {
 	 int	i;
  
+	 stop_server(&table->control_fd, table->control, table->menu.control);
 	 i = -1;
-	 while (++i < table->philosopher_count)
-		 pthread_join(table->philo[i].thread, NULL);
-	 unset_rules(table);
-	 clean_table(table);
+	 while (++i < table->seat_count)
+		 if (table->philo[i].seat != SEAT_EMPTY)
+			 wait_guest(&table->philo[i]);
+	 if (table->host != table)
+		 return ;
+	 close_house(table);
+	 stop_sampler(table);
+	 stop_server(&table->metrics_fd, table->metrics, table->menu.metrics);
+	 remove_dumbwaiter(table);
+	 close_shm_stream(table);
+	 close_live_page(table);
+	 present_house(table);
+	 i = table->menu.tables + 1;
+	 while (--i > 0)
+		 clear_table(house_table(table, i));
  }
  
  /**
@@ -81,8 +86,10 @@
   * @brief Check if a philosopher died or has eaten enough.
   *
   * @details
-  * Verifies whether a philosopher has passed their time-to-die,
-  * or has reached the meal requirement. If so, the simulation ends.
+  * Verifies whether a philosopher has passed their own time-to-die,
+  * or has reached the meal requirement. If so, the simulation ends through
+  * `last_call`, which stops the log before the closing message. Empty
+  * seats and philosophers who left are skipped.
   *
   * @param philo Pointer to the philosopher being monitored.
   * @return `true` if simulation must end, `false` otherwise.
@@ -91,11 +98,14 @@
   */
  static bool	is_someone_dead_or_full(t_philo *philo)
  {
-	 pthread_mutex_lock(&philo->table->eat_padlock);
-	 if (get_current_time() - philo->last_meal >= philo->table->time_to_die)
+	 if (__atomic_load_n(&philo->seat, __ATOMIC_ACQUIRE) != SEAT_TAKEN)
+		 return (false);
+	 take_padlock(NULL, &philo->table->eat_padlock);
+	 if (is_measured(&philo->table->menu))
+		 note_margin(philo);
+	 if (get_current_time() - philo->last_meal >= own_time_to_die(philo))
 	 {
-		 print_action(philo, DIE);
-		 is_dinner_over(philo, true);
+		 last_call(philo, DIE);
 		 pthread_mutex_unlock(&philo->table->eat_padlock);
 		 return (true);
 	 }
@@ -105,8 +115,7 @@
 		 philo->table->is_full++;
 		 if (philo->table->is_full >= philo->table->philosopher_count)
 		 {
-			 is_dinner_over(philo, true);
-			 print_action(philo, END);
+			 last_call(philo, END);
 			 pthread_mutex_unlock(&philo->table->eat_padlock);
 			 return (true);
 		 }
@@ -115,12 +124,28 @@
 	 return (false);
  }
  
+ /**
+  * @internal
+  * @brief Check whether a `--run-for` dinner has used up its wall time.
+  *
+  * @param table Pointer to the shared simulation table.
+  * @return `true` if the time limit is set and reached.
+  *
+  * @ingroup philosopher_core
+  */
+ static bool	is_closing_time(t_table *table)
+ {
+	 return (table->menu.run_for
+		 && get_current_time() - table->start_time >= table->menu.run_for);
+ }
+ 
  /**
   * @brief Monitor philosopher states and end dinner when appropriate.
   *
   * @details
   * Continuously checks if any philosopher has died or if all have eaten
-  * enough. Ends the simulation accordingly and performs cleanup.
+  * enough, and with `--run-for` whether the time limit is reached. Ends
+  * the simulation accordingly and performs cleanup.
   *
   * @param table Pointer to the shared simulation table.
   *
@@ -131,16 +156,23 @@
 	 int	i;
 	 int	continue_flag;
  
+	 wait_doors(table);
 	 continue_flag = 1;
 	 while (continue_flag)
 	 {
 		 i = -1;
 		 table->is_full = 0;
-		 while (++i < table->philosopher_count)
+		 while (++i < table->seat_count)
 		 {
 			 if (continue_flag && is_someone_dead_or_full(&table->philo[i]))
 				 continue_flag = 0;
 		 }
+		 if (continue_flag && is_closing_time(table))
+		 {
+			 is_dinner_over(&table->philo[0], true);
+			 continue_flag = 0;
+		 }
+		 __atomic_add_fetch(&table->ledger.passes, 1, __ATOMIC_RELAXED);
 		 usleep(10);
 	 }
 	 end_dinner(table);
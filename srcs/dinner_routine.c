@@ -16,58 +16,152 @@
 
  /**
   * @internal
-  * @brief Execute the eating phase of a philosopher's routine.
+  * @brief Record a finished meal and put the forks back.
   *
   * @details
-  * Locks both forks (with deadlock avoidance ordering), prints actions,
-  * updates last meal time, increments meal count, and then unlocks the forks.
+  * The meal count and last meal are stored atomically as well as under
+  * `eat_padlock`, so that the `--metrics` server may read them without
+  * the lock.
   *
-  * @param philo Pointer to the philosopher executing this phase.
+  * @param philo Pointer to the philosopher who just ate.
   *
   * @ingroup philosopher_core
   */
- static void	dinner_time(t_philo *philo)
+ static void	clear_plates(t_philo *philo)
  {
-	 if (philo->id % 2 == 0)
+	 note_hunger(philo);
+	 take_padlock(NULL, &philo->table->eat_padlock);
+	 __atomic_store_n(&philo->meal_count, philo->meal_count + 1,
+		 __ATOMIC_RELAXED);
+	 __atomic_store_n(&philo->last_meal, get_current_time(), __ATOMIC_RELAXED);
+	 pthread_mutex_unlock(&philo->table->eat_padlock);
+	 if (philo->table->menu.drinking)
+		 return_bottles(philo);
+	 else if (philo->table->menu.graph)
+		 release_forks(philo);
+	 else
 	 {
-		 pthread_mutex_lock(&philo->table->fork_padlock[philo->left_fork]);
-		 pthread_mutex_lock(&philo->table->fork_padlock[philo->right_fork]);
+		 put_fork(philo, philo->right_fork);
+		 put_fork(philo, philo->left_fork);
+		 stand_up(philo);
 	 }
-	 else
+ }
+ 
+ /**
+  * @internal
+  * @brief Take both forks of the ring, and start the meal.
+  *
+  * @details
+  * Even philosophers take their left fork first and odd ones their right
+  * one, which breaks the circular wait of a fixed ring. Once the ring may
+  * be re-linked (`--seats`) neighbours no longer alternate, so forks are
+  * taken lowest index first instead. A fork across the border of two
+  * `--link`ed wings is asked for by message (see couriers.c). The two
+  * forks and the meal are
+  * printed in one go, stamped when each fork was taken, and the wait for
+  * the forks goes on the philosopher's tab when it is measured.
+  *
+  * @param philo Pointer to the philosopher about to eat.
+  * @return When the meal started (ms): that of the second fork, unless the
+  * line had to be logged later to keep the log in order.
+  *
+  * @ingroup philosopher_core
+  */
+ static long long	take_forks(t_philo *philo)
+ {
+	 int			first;
+	 int			second;
+	 t_order		order[3];
+	 long long	asked;
+ 
+	 first = philo->right_fork;
+	 second = philo->left_fork;
+	 if ((philo->table->menu.seats && philo->left_fork < philo->right_fork)
+		 || (!philo->table->menu.seats && philo->id % 2 == 0))
 	 {
-		 pthread_mutex_lock(&philo->table->fork_padlock[philo->right_fork]);
-		 pthread_mutex_lock(&philo->table->fork_padlock[philo->left_fork]);
+		 first = philo->left_fork;
+		 second = philo->right_fork;
 	 }
-	 print_action(philo, TAKE);
-	 print_action(philo, TAKE);
-	 print_action(philo, EAT);
-	 advance_time(philo, philo->table->time_to_eat);
-	 pthread_mutex_lock(&philo->table->eat_padlock);
-	 philo->meal_count++;
-	 philo->last_meal = get_current_time();
-	 pthread_mutex_unlock(&philo->table->eat_padlock);
-	 pthread_mutex_unlock(&philo->table->fork_padlock[philo->right_fork]);
-	 pthread_mutex_unlock(&philo->table->fork_padlock[philo->left_fork]);
+	 asked = read_stopwatch(philo->table);
+	 take_fork(philo, first);
+	 order[0] = (t_order){TAKE, first, get_current_time()};
+	 take_fork(philo, second);
+	 order[1] = (t_order){TAKE, second, get_current_time()};
+	 note_forks(philo, asked);
+	 order[2] = (t_order){EAT, -1, order[1].when};
+	 return (print_order(philo, order, 3));
  }
  
  /**
   * @internal
-  * @brief Handles the edge case where there's only one philosopher.
+  * @brief Execute the eating phase of a philosopher's routine.
   *
   * @details
-  * The lone philosopher picks up a fork, waits until `time_to_die`,
-  * and is then declared dead.
+  * Takes the two forks of the ring, every fork of the seat with
+  * `--graph` (see cutlery.c), or this session's bottles with `--drinking`
+  * (see cellar.c), eats, updates last meal time, increments meal count,
+  * and then puts them back. The meal is timed from the
+  * "is eating" line's time. With `--scenario`, a hungrier neighbour may go
+  * first (see courtesy.c); with `--seats`, one who is dining too, and the
+  * ring may be re-linked meanwhile (see ushers.c).
   *
-  * @param table Pointer to the table structure.
+  * @param philo Pointer to the philosopher executing this phase.
+  * @param time_to_eat Length of the meal (ms).
+  *
+  * @ingroup philosopher_core
+  */
+ static void	dinner_time(t_philo *philo, int time_to_eat)
+ {
+	 long long	served;
+ 
+	 if (!sit_down(philo, time_to_eat))
+		 return ;
+	 wait_turn(philo, time_to_eat);
+	 if (philo->table->menu.drinking)
+		 served = pour_bottles(philo);
+	 else if (philo->table->menu.graph)
+		 served = seize_forks(philo);
+	 else
+		 served = take_forks(philo);
+	 advance_time(philo, served + time_to_eat - get_current_time());
+	 clear_plates(philo);
+ }
+ 
+ /**
+  * @internal
+  * @brief Wait for the doors to open, then handle the edge case where
+  * there's only one philosopher, or stagger the even ones.
+  *
+  * @details
+  * The lone philosopher picks up a fork, waits until its `time_to_die`,
+  * and is then declared dead. Nobody can join it, as it never reaches a
+  * phase boundary. A graph of one philosopher has no fork at all.
+  * Otherwise even philosophers wait for the longest meal around, except
+  * with `--seats`, where ids come and go and their parity says nothing of
+  * who sits next to whom.
+  *
+  * @param philo Pointer to the philosopher starting its routine.
+  * @param timing Receives its timings.
+  * @return `false` if it was alone, and is now dead.
   *
   * @ingroup philosopher_core
   */
- static void	lone_philosopher(t_table *table)
+ static bool	come_in(t_philo *philo, t_timing *timing)
  {
-	 print_action(&table->philo[0], TAKE);
-	 advance_time(&table->philo[0], table->time_to_die);
-	 print_action(&table->philo[0], DIE);
-	 is_dinner_over(&table->philo[0], true);
+	 wait_doors(philo->table);
+	 if (!philo->table->menu.graph
+		 && __atomic_load_n(&philo->table->philosopher_count,
+			 __ATOMIC_RELAXED) == 1)
+	 {
+		 print_fork(philo, philo->left_fork);
+		 advance_time(philo, own_time_to_die(philo));
+		 last_call(philo, DIE);
+		 return (false);
+	 }
+	 own_timing(philo, timing);
+	 if (philo->id % 2 == 0 && !philo->table->menu.seats)
+		 advance_time(philo, meal_around(philo, timing->time_to_eat) / 2);
+	 return (true);
  }
  
  /**
@@ -76,7 +170,13 @@
   * @details
   * Simulates the life of a philosopher through an infinite loop of:
   * thinking, picking up forks, eating, sleeping. Handles the case
-  * of even/odd IDs and philosopher count for timing offset.
+  * of even/odd IDs and philosopher count for timing offset, which wait for
+  * the longest meal around; the odd count's wait is left out with
+  * `--graph`, whose cycles need not follow the count, and both waits with
+  * `--seats`, whose count and ids change under everybody. The timings
+  * are read again before thinking and before sleeping, where a pause of
+  * `--control` also holds the philosopher, and where one who left the
+  * table (`--seats`) gets up.
   *
   * @note Terminates early if only one philosopher exists, or
   * if the dinner has ended (`is_dinner_over` returns true).
@@ -88,26 +188,26 @@
   */
  void	*dinner_routine(void *arg)
  {
-	 t_philo	*philo;
+	 t_philo		*philo;
+	 t_timing	timing;
  
 	 philo = (t_philo *)arg;
-	 if (philo->id % 2 == 0)
-		 advance_time(philo, philo->table->time_to_eat / 2);
+	 if (!come_in(philo, &timing))
+		 return (0);
 	 while (true)
 	 {
-		 if (philo->table->philosopher_count == 1)
-		 {
-			 lone_philosopher(philo->table);
-			 return (0);
-		 }
-		 if (is_dinner_over(philo, false))
+		 if (!next_phase(philo, &timing))
 			 return (0);
 		 print_action(philo, THINK);
-		 dinner_time(philo);
+		 dinner_time(philo, timing.time_to_eat);
+		 if (!next_phase(philo, &timing))
+			 return (0);
 		 print_action(philo, SLEEP);
-		 advance_time(philo, philo->table->time_to_sleep);
-		 if (philo->table->philosopher_count % 2 != 0)
-			 advance_time(philo, philo->table->time_to_eat);
+		 advance_time(philo, timing.time_to_sleep);
+		 if (__atomic_load_n(&philo->table->philosopher_count,
+				 __ATOMIC_RELAXED) % 2 != 0 && !philo->table->menu.graph
+			 && !philo->table->menu.seats)
+			 advance_time(philo, meal_around(philo, timing.time_to_eat));
 	 }
 	 return (0);
  }
@@ -0,0 +1,72 @@
+/**
+ * @file doors.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Starting the dinner clock once everybody is seated.
+ *
+ * @details
+ * The scenario, the cellar, the tables, the streams, the sockets and the
+ * links take their time to set up, and so does forking a process per
+ * philosopher or wing; none of it is dinner. So the philosophers, the
+ * monitors and the sampler wait at the doors once started, and the start
+ * time and every first meal are stamped only when all of them are there,
+ * just before the doors open, so that the setup does not count against
+ * `time_to_die`. The servers already running read the start atomically.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+
+ /**
+  * @brief Stamp the start of the dinner at every table of the house.
+  *
+  * @details
+  * Every seat gets its first meal at the start, empty ones included,
+  * and the `--live` page its wall clock start. The trace header goes out
+  * before anybody may log.
+  *
+  * @param host Pointer to the host table, everybody seated.
+  *
+  * @ingroup philosopher_core
+  */
+ void	open_doors(t_table *host)
+ {
+	 t_table		*table;
+	 long long	now;
+	 int			number;
+	 int			i;
+ 
+	 now = get_current_time();
+	 number = 0;
+	 while (++number <= host->menu.tables)
+	 {
+		 table = house_table(host, number);
+		 __atomic_store_n(&table->start_time, now, __ATOMIC_RELEASE);
+		 table->start_wall = get_wall_time();
+		 i = -1;
+		 while (++i < table->seat_count)
+			 __atomic_store_n(&table->philo[i].last_meal, now,
+				 __ATOMIC_RELAXED);
+	 }
+	 if (host->live)
+		 __atomic_store_n(&host->live->start_time, host->start_wall,
+			 __ATOMIC_RELEASE);
+	 print_trace_header(host);
+	 __atomic_store_n(&host->doors_open, 1, __ATOMIC_RELEASE);
+ }
+ 
+ /**
+  * @brief Wait for the doors to open, or the dinner to end first.
+  *
+  * @param table Pointer to the simulation table of the caller.
+  *
+  * @ingroup philosopher_core
+  */
+ void	wait_doors(t_table *table)
+ {
+	 while (!__atomic_load_n(&table->host->doors_open, __ATOMIC_ACQUIRE)
+		 && !__atomic_load_n(&table->end_flag, __ATOMIC_ACQUIRE))
+		 usleep(DOORS_NAP);
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,182 @@
+/**
+ * @file dumbwaiter.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Buffered log output for the `--writer` backends.
+ *
+ * @details
+ * With `--writer=write`, `uring` or `splice`, log lines and trace records
+ * are loaded into large trays instead of going through stdio, and a tray
+ * only goes down to stdout once it is full or the dinner is over:
+ * - `write` sends it with `write`, while the loading thread waits
+ * - `uring` submits it to io_uring and carries on loading the next tray,
+ *   falling back to `write` if io_uring cannot be set up
+ * - `splice` gifts its pages to the stdout pipe, falling back to `write`
+ *   if stdout is not a pipe
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+
+ /**
+  * @internal
+  * @brief Write a whole buffer, retrying after signals and short writes.
+  *
+  * @param fd The file descriptor to write to.
+  * @param data Bytes to write.
+  * @param size Number of bytes.
+  *
+  * @note Exits the program on fatal write errors.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	write_fully(int fd, const char *data, size_t size)
+ {
+	 ssize_t	written;
+ 
+	 while (size > 0)
+	 {
+		 written = write(fd, data, size);
+		 if (written == -1)
+		 {
+			 if (errno == EINTR)
+				 continue ;
+			 exit(EXIT_FAILURE);
+		 }
+		 data += written;
+		 size -= written;
+	 }
+ }
+ 
+ /**
+  * @brief Allocate the trays and prepare the selected writer.
+  *
+  * @details
+  * Trays are page aligned, as registered buffers should be. Must be called
+  * before anything is logged, the binary trace header included.
+  *
+  * @param table Pointer to the configured table.
+  *
+  * @note Exits the program if the trays cannot be allocated.
+  *
+  * @ingroup philosopher_core
+  */
+ void	install_dumbwaiter(t_table *table)
+ {
+	 t_dumbwaiter	*dumbwaiter;
+ 
+	 dumbwaiter = &table->dumbwaiter;
+	 memset(dumbwaiter, 0, sizeof(*dumbwaiter));
+	 dumbwaiter->ring.fd = -1;
+	 if (table->menu.writer == WRITER_STDIO)
+		 return ;
+	 dumbwaiter->trays = aligned_alloc(4096, TRAY_COUNT * TRAY_SIZE);
+	 if (!dumbwaiter->trays)
+	 {
+		 ft_putstr_fd(2, "Couldn't get the trays\n");
+		 clean_table(table);
+		 exit(EXIT_FAILURE);
+	 }
+	 if (table->menu.writer == WRITER_URING
+		 && open_ring(&dumbwaiter->ring, dumbwaiter->trays) == -1)
+		 ft_putstr_fd(2, "philo: io_uring unavailable, using write()\n");
+	 if (table->menu.writer == WRITER_SPLICE
+		 && open_pipe_sink(dumbwaiter) == -1)
+		 ft_putstr_fd(2, "philo: stdout is not a pipe, using write()\n");
+ }
+ 
+ /**
+  * @brief Send the loading tray down, and on the last call all the others.
+  *
+  * @details
+  * Without a ring the tray is spliced or written on the spot. With one it
+  * becomes busy and is submitted as soon as the previous chain is done; the call
+  * only waits when no tray is left to load. The last call waits until every
+  * tray has come back.
+  *
+  * @param dumbwaiter Dumbwaiter to send.
+  * @param last Whether the dinner is over.
+  *
+  * @ingroup philosopher_core
+  */
+ void	send_tray(t_dumbwaiter *dumbwaiter, bool last)
+ {
+	 int	keep;
+ 
+	 if (dumbwaiter->piped)
+	 {
+		 splice_tray(dumbwaiter);
+		 return ;
+	 }
+	 if (dumbwaiter->ring.fd == -1)
+	 {
+		 write_fully(STDOUT_FILENO, dumbwaiter->trays, dumbwaiter->filled);
+		 dumbwaiter->filled = 0;
+		 return ;
+	 }
+	 if (dumbwaiter->filled > 0)
+		 queue_tray(dumbwaiter);
+	 keep = TRAY_COUNT - 1;
+	 if (last)
+		 keep = 0;
+	 collect_trays(dumbwaiter, TRAY_COUNT);
+	 submit_trays(dumbwaiter);
+	 while (dumbwaiter->busy > keep)
+	 {
+		 collect_trays(dumbwaiter, keep);
+		 submit_trays(dumbwaiter);
+	 }
+ }
+ 
+ /**
+  * @brief Output one log line or trace record.
+  *
+  * @details
+  * Goes to stdio with the default writer, otherwise into the loading
+  * tray, which is sent first if the dish does not fit. Called under
+  * `pass_padlock`.
+  *
+  * @param table Pointer to the shared simulation table.
+  * @param dish Bytes to output, at most TRAY_SIZE.
+  * @param size Number of bytes.
+  *
+  * @ingroup philosopher_core
+  */
+ void	serve_dish(t_table *table, const void *dish, size_t size)
+ {
+	 t_dumbwaiter	*dumbwaiter;
+ 
+	 if (table->menu.writer == WRITER_STDIO)
+	 {
+		 fwrite(dish, 1, size, stdout);
+		 return ;
+	 }
+	 dumbwaiter = &table->dumbwaiter;
+	 if (dumbwaiter->filled + size > TRAY_SIZE)
+		 send_tray(dumbwaiter, false);
+	 memcpy(dumbwaiter->trays + dumbwaiter->loading * TRAY_SIZE
+		 + dumbwaiter->filled, dish, size);
+	 dumbwaiter->filled += size;
+ }
+ 
+ /**
+  * @brief Send the remaining output and release the trays and the ring.
+  *
+  * @details
+  * Called once every philosopher thread is joined.
+  *
+  * @param table Pointer to the shared simulation table.
+  *
+  * @ingroup philosopher_core
+  */
+ void	remove_dumbwaiter(t_table *table)
+ {
+	 if (!table->dumbwaiter.trays)
+		 return ;
+	 send_tray(&table->dumbwaiter, true);
+	 close_ring(&table->dumbwaiter.ring);
+	 free(table->dumbwaiter.trays);
+	 table->dumbwaiter.trays = NULL;
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,216 @@
+/**
+ * @file graph.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Conflict graphs other than the ring (`--graph`).
+ *
+ * @details
+ * A graph file lists the forks, one line per fork naming the two
+ * philosophers who share it:
+ * @code
+ * # a 2x2 grid
+ * 1 2
+ * 1 3
+ * 2 4
+ * 3 4
+ * @endcode
+ * Blank lines and lines starting with `#` are skipped. Forks are numbered
+ * in file order, and each philosopher's forks are kept in one array, seat
+ * by seat (compressed sparse rows): those of seat `i` run from
+ * `fork_start[i]` to `fork_start[i + 1]`, in increasing order. Taking
+ * them in that order is the same global order for everyone, so no cycle
+ * of waits can form, whatever the graph.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+
+ /**
+  * @internal
+  * @brief Read one line of the graph file.
+  *
+  * @param table Pointer to the table.
+  * @param line One line of the file.
+  * @param ends Receives the two seats (from 0) sharing the fork.
+  * @return 1 for a fork, 0 for a line to skip, -1 after printing the line
+  * if it is malformed, names nobody at the table or the same philosopher
+  * twice.
+  *
+  * @ingroup philosopher_core
+  */
+ static int	read_edge(t_table *table, char *line, int ends[2])
+ {
+	 char	word[2][16];
+	 char	extra;
+	 int		found;
+ 
+	 found = sscanf(line, " %15s %15s %c", word[0], word[1], &extra);
+	 if (found <= 0 || word[0][0] == '#')
+		 return (0);
+	 ends[0] = -1;
+	 ends[1] = -1;
+	 if (found == 2 && is_number(word[0]) && is_number(word[1])
+		 && strlen(word[0]) <= 10 && strlen(word[1]) <= 10)
+	 {
+		 ends[0] = ft_atoi(word[0]) - 1;
+		 ends[1] = ft_atoi(word[1]) - 1;
+	 }
+	 if (ends[0] >= 0 && ends[1] >= 0 && ends[0] != ends[1]
+		 && ends[0] < table->philosopher_count
+		 && ends[1] < table->philosopher_count)
+		 return (1);
+	 ft_putstr_fd(2, "Error: bad graph line: ");
+	 ft_putstr_fd(2, line);
+	 return (-1);
+ }
+ 
+ /**
+  * @internal
+  * @brief Read the whole file, counting forks or filing them.
+  *
+  * @details
+  * The first pass counts each seat's forks into `fork_start[i + 1]`; the
+  * second, once those are turned into starting points, files each fork
+  * at its seats' next free slot, which leaves `fork_start[i]` on the start
+  * of seat `i + 1`.
+  *
+  * @param table Pointer to the table.
+  * @param file Graph file, read from the start.
+  * @return `false` on a bad line, or if the file cannot be rewound, with
+  * the error printed.
+  *
+  * @ingroup philosopher_core
+  */
+ static bool	read_edges(t_table *table, FILE *file)
+ {
+	 char	line[GRAPH_LINE];
+	 int		ends[2];
+	 int		*row;
+	 int		found;
+ 
+	 table->fork_count = 0;
+	 found = -(fseek(file, 0, SEEK_SET) != 0);
+	 if (found < 0)
+		 ft_putstr_fd(2, "Error: couldn't rewind the graph\n");
+	 while (found >= 0 && fgets(line, sizeof(line), file))
+	 {
+		 found = read_edge(table, line, ends);
+		 row = table->fork_start;
+		 if (found > 0 && !table->fork_list && ++table->fork_count)
+		 {
+			 row[ends[0] + 1]++;
+			 row[ends[1] + 1]++;
+		 }
+		 else if (found > 0)
+		 {
+			 table->fork_list[row[ends[0]]++] = table->fork_count;
+			 table->fork_list[row[ends[1]]++] = table->fork_count++;
+		 }
+	 }
+	 return (found >= 0);
+ }
+ 
+ /**
+  * @internal
+  * @brief Build the rows of forks from the file.
+  *
+  * @param table Pointer to the table, `fork_start` zeroed.
+  * @param file Graph file.
+  * @return `false` on a bad line, a file that changed between the passes
+  * or a failed allocation, with the error printed.
+  *
+  * @ingroup philosopher_core
+  */
+ static bool	build_rows(t_table *table, FILE *file)
+ {
+	 int	forks;
+	 int	i;
+ 
+	 if (!read_edges(table, file))
+		 return (false);
+	 forks = table->fork_count;
+	 i = 0;
+	 while (++i <= table->seat_count)
+		 table->fork_start[i] += table->fork_start[i - 1];
+	 table->fork_list = malloc(sizeof(int) * (2 * forks + 1));
+	 if (!table->fork_list || !read_edges(table, file)
+		 || table->fork_count != forks)
+	 {
+		 ft_putstr_fd(2, "Error: couldn't read the graph twice\n");
+		 return (false);
+	 }
+	 while (--i > 0)
+		 table->fork_start[i] = table->fork_start[i - 1];
+	 table->fork_start[0] = 0;
+	 return (true);
+ }
+ 
+ /**
+  * @brief Load the `--graph` file, or settle on the ring.
+  *
+  * @details
+  * Called once the seats are allocated and before the forks are. Without
+  * a graph, there is one fork per seat. With one, there is one per line
+  * of the file, and neighbours are fixed, so it cannot go with `--seats`,
+  * nor with `--scenario`, whose courtesy looks at ring neighbours (see
+  * menu_check.c).
+  *
+  * @param table Pointer to the table.
+  *
+  * @note Exits the program if the file cannot be read or has a bad line.
+  *
+  * @ingroup philosopher_core
+  */
+ void	load_graph(t_table *table)
+ {
+	 FILE	*file;
+	 bool	ok;
+ 
+	 table->fork_count = table->seat_count;
+	 table->fork_start = NULL;
+	 table->fork_list = NULL;
+	 if (!table->menu.graph)
+		 return ;
+	 file = NULL;
+	 table->fork_start = calloc(table->seat_count + 1, sizeof(int));
+	 if (table->fork_start)
+		 file = fopen(table->menu.graph, "r");
+	 if (!file)
+		 ft_putstr_fd(2, "Error: couldn't read the graph\n");
+	 ok = (file && build_rows(table, file));
+	 if (file)
+		 fclose(file);
+	 if (ok)
+		 return ;
+	 clean_table(table);
+	 exit(EXIT_FAILURE);
+ }
+ 
+ /**
+  * @brief Point a seat's fork indexes at its first and last fork.
+  *
+  * @details
+  * Only the live page still looks at them with `--graph`, to tell the
+  * first fork held from the others. A seat sharing no fork gets -1.
+  *
+  * @param table Pointer to the table, graph loaded.
+  * @param philo Seat being laid.
+  *
+  * @ingroup philosopher_core
+  */
+ void	lay_forks(t_table *table, t_philo *philo)
+ {
+	 int	first;
+	 int	last;
+ 
+	 first = table->fork_start[philo->id - 1];
+	 last = table->fork_start[philo->id] - 1;
+	 philo->left_fork = -1;
+	 philo->right_fork = -1;
+	 if (first > last)
+		 return ;
+	 philo->left_fork = table->fork_list[first];
+	 philo->right_fork = table->fork_list[last];
+ }
+ 
\ No newline at end of file
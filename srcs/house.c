@@ -0,0 +1,196 @@
+/**
+ * @file house.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Several independent tables in one process (`--tables`).
+ *
+ * @details
+ * Every table seats the philosophers of the command line, with forks,
+ * flags, timings and a monitor of its own: nothing of one dinner is
+ * shared with another but the output. The first table is the host; the
+ * others, its annexes, log through its print locks, dumbwaiter and
+ * ledger, and write their reports into its `--report` stream. In the
+ * log, table `k` numbers its philosophers after those of table `k - 1`.
+ *
+ * The CPUs this process may run on are dealt out in contiguous slices,
+ * one per table, and each table's threads run on its slice only; with
+ * fewer CPUs than tables, tables take turns over them. Each annex is
+ * seated and watched by a thread of its own, and ends on its own; the
+ * host, watched by the main thread, waits for all of them before closing
+ * the house.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #define _GNU_SOURCE
+ #include "../include/philo.h"
+ #include <sched.h>
+ 
+ /**
+  * @internal
+  * @brief Set up one annex like the host, with the same arguments.
+  *
+  * @param host Pointer to the host table, set up.
+  * @param number Number of the annex, from 2.
+  * @param argc Argument count, options skipped.
+  * @param argv Argument vector, options skipped.
+  *
+  * @note Exits the program if the annex cannot be set up.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	set_annex(t_table *host, int number, int argc, char **argv)
+ {
+	 t_table	*annex;
+ 
+	 annex = house_table(host, number);
+	 annex->menu = host->menu;
+	 set_table(annex, argc, argv);
+	 annex->host = host;
+	 annex->number = number;
+	 annex->report = host->report;
+	 welcome_philosophers(annex);
+	 load_scenario(annex);
+	 open_cellar(annex);
+	 set_rules(annex);
+ }
+ 
+ /**
+  * @brief Set up the annexes of a `--tables` dinner.
+  *
+  * @details
+  * Called once the host is set up. Only the log and the reports are
+  * shared, so the options that serve one dinner live (`--live`,
+  * `--metrics`, `--control`, `--samples`), `--seats`, the binary
+  * traces, whose header describes one table, are refused (see
+  * menu_check.c). So is `--writer=splice`: a tray is refilled on the
+  * belief that the seven gifted after it overflow the pipe, which the
+  * small trays every annex hands over at its last call do not.
+  *
+  * @param host Pointer to the host table.
+  * @param argc Argument count, options skipped.
+  * @param argv Argument vector, options skipped.
+  *
+  * @note Exits the program if an annex cannot be set up.
+  *
+  * @ingroup philosopher_core
+  */
+ void	open_house(t_table *host, int argc, char **argv)
+ {
+	 int	number;
+ 
+	 if (host->menu.tables == 1)
+		 return ;
+	 host->annex = calloc(host->menu.tables - 1, sizeof(t_table));
+	 if (!host->annex)
+	 {
+		 ft_putstr_fd(2, "Error: couldn't open the tables\n");
+		 clean_table(host);
+		 exit(EXIT_FAILURE);
+	 }
+	 number = 1;
+	 while (++number <= host->menu.tables)
+		 set_annex(host, number, argc, argv);
+ }
+ 
+ /**
+  * @internal
+  * @brief Find the CPUs a table runs on.
+  *
+  * @details
+  * Of the `count` CPUs the calling thread may use, in order, table `t` of
+  * `k` gets those from `(t - 1) * count / k` up to `t * count / k`, or
+  * with fewer CPUs than tables, CPU `(t - 1) % count`.
+  *
+  * @param table Pointer to the table.
+  * @param slice Receives its CPUs.
+  * @return `false` if the affinity mask could not be read.
+  *
+  * @ingroup philosopher_core
+  */
+ static bool	cut_slice(t_table *table, cpu_set_t *slice)
+ {
+	 cpu_set_t	allowed;
+	 int			range[2];
+	 int			count;
+	 int			cpu;
+	 int			s;
+ 
+	 if (sched_getaffinity(0, sizeof(allowed), &allowed) == -1)
+		 return (false);
+	 count = CPU_COUNT(&allowed);
+	 range[0] = (table->number - 1) % count;
+	 range[1] = range[0] + 1;
+	 if (count >= table->menu.tables)
+	 {
+		 range[0] = (table->number - 1) * count / table->menu.tables;
+		 range[1] = table->number * count / table->menu.tables;
+	 }
+	 CPU_ZERO(slice);
+	 s = 0;
+	 cpu = -1;
+	 while (++cpu < CPU_SETSIZE)
+		 if (CPU_ISSET(cpu, &allowed) && s++ >= range[0] && s <= range[1])
+			 CPU_SET(cpu, slice);
+	 return (true);
+ }
+ 
+ /**
+  * @internal
+  * @brief Seat an annex and watch it until its dinner is over.
+  *
+  * @details
+  * The philosophers' threads inherit the CPUs of this one.
+  *
+  * @param arg Pointer to the annex.
+  * @return Always NULL.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	*watch_table(void *arg)
+ {
+	 seat_philosophers_at_the_table(arg);
+	 dinner_monitor(arg);
+	 return (NULL);
+ }
+ 
+ /**
+  * @brief Start the annexes, each on its own CPUs, and move the main
+  * thread onto the host's.
+  *
+  * @details
+  * Called before the host's philosophers are seated, so that they inherit
+  * the host's CPUs. The host's slice is cut last, while the main thread
+  * may still run anywhere. Does nothing with a single table.
+  *
+  * @param host Pointer to the host table, annexes set up.
+  *
+  * @note Exits the program if an annex cannot be started.
+  *
+  * @ingroup philosopher_core
+  */
+ void	seat_house(t_table *host)
+ {
+	 pthread_attr_t	attr;
+	 cpu_set_t		slice;
+	 t_table			*table;
+	 int				number;
+ 
+	 number = host->menu.tables + 1;
+	 while (--number > 1)
+	 {
+		 table = house_table(host, number);
+		 pthread_attr_init(&attr);
+		 if (cut_slice(table, &slice))
+			 pthread_attr_setaffinity_np(&attr, sizeof(slice), &slice);
+		 if (pthread_create(&table->monitor, &attr, watch_table, table))
+		 {
+			 ft_putstr_fd(2, "Couldn't open the tables\n");
+			 exit(EXIT_FAILURE);
+		 }
+		 pthread_attr_destroy(&attr);
+	 }
+	 if (host->menu.tables > 1 && cut_slice(host, &slice))
+		 pthread_setaffinity_np(pthread_self(), sizeof(slice), &slice);
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,135 @@
+/**
+ * @file house_bill.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Closing a `--tables` dinner and presenting it whole.
+ *
+ * @details
+ * The host presents every table once all of them are over: one summary
+ * line per table with the quiet formats, in table order, and with
+ * several tables, a `--report` that is a JSON array of the tables'
+ * reports. The bill adds up the meals of the whole house, and breaks
+ * them down by table after its headline line.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+
+ /**
+  * @brief Find a table of the house.
+  *
+  * @param host Pointer to the host table.
+  * @param number Table number, from 1 for the host.
+  * @return Pointer to the table.
+  *
+  * @ingroup philosopher_core
+  */
+ t_table	*house_table(t_table *host, int number)
+ {
+	 if (number == 1)
+		 return (host);
+	 return (&host->annex[number - 2]);
+ }
+ 
+ /**
+  * @brief Number a philosopher across the house.
+  *
+  * @details
+  * Each table numbers its seats from 1; the house goes on from one table
+  * to the next, so the log, the summary and the report all name a
+  * philosopher of table n by its id plus the seats of the tables before.
+  *
+  * @param philo Philosopher to number.
+  * @return Its number in the house, its id with a single table.
+  *
+  * @ingroup philosopher_core
+  */
+ int	house_number(t_philo *philo)
+ {
+	 return (philo->id + (philo->table->number - 1)
+		 * philo->table->seat_count);
+ }
+ 
+ /**
+  * @brief Wait for every annex to be over.
+  *
+  * @details
+  * Called by the host once its own philosophers are joined; each annex
+  * joins its philosophers before its monitor thread ends.
+  *
+  * @param host Pointer to the host table.
+  *
+  * @ingroup philosopher_core
+  */
+ void	close_house(t_table *host)
+ {
+	 int	number;
+ 
+	 number = 1;
+	 while (++number <= host->menu.tables)
+		 pthread_join(house_table(host, number)->monitor, NULL);
+ }
+ 
+ /**
+  * @brief Add up the meals eaten at one table.
+  *
+  * @details
+  * Philosophers who left count too. Called once their threads are joined.
+  *
+  * @param table Pointer to the table.
+  * @return The meals of its philosophers.
+  *
+  * @ingroup philosopher_core
+  */
+ long long	count_meals(t_table *table)
+ {
+	 long long	meals;
+	 int			i;
+ 
+	 meals = 0;
+	 i = -1;
+	 while (++i < table->seat_count)
+		 meals += table->philo[i].meal_count;
+	 return (meals);
+ }
+ 
+ /**
+  * @brief Present every table of the house, then the bill.
+  *
+  * @details
+  * Prints the summaries of a quiet dinner, writes and closes the
+  * `--report` stream, presents the bill, and with `--run-for` and several
+  * tables, the meals of each table on stderr.
+  *
+  * @param host Pointer to the host table, every table over.
+  *
+  * @ingroup philosopher_core
+  */
+ void	present_house(t_table *host)
+ {
+	 int	number;
+ 
+	 if (host->report && host->menu.tables > 1)
+		 fprintf(host->report, "[\n");
+	 number = 0;
+	 while (++number <= host->menu.tables)
+	 {
+		 if (host->report && number > 1)
+			 fprintf(host->report, ",\n");
+		 present_summary(house_table(host, number));
+		 present_report(house_table(host, number));
+	 }
+	 if (host->report && host->menu.tables > 1)
+		 fprintf(host->report, "]\n");
+	 if (host->report)
+		 fclose(host->report);
+	 host->report = NULL;
+	 present_bill(host);
+	 number = 0;
+	 while (host->menu.run_for && host->menu.tables > 1
+		 && ++number <= host->menu.tables)
+		 fprintf(stderr, "philo: table %d, %lld meals\n", number,
+			 count_meals(house_table(host, number)));
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,173 @@
+/**
+ * @file journal.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Formatting of the dinner's log as text lines or a binary trace.
+ *
+ * @details
+ * Everything here writes to stdout, or to the shared memory stream with
+ * `--format=shm`, and expects the caller to serialize
+ * calls (under `pass_padlock`, or before and after the threads run).
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+
+ /**
+  * @brief Map an action string to its binary trace kind.
+  *
+  * @details
+  * Also gives the states of the `--live` page.
+  *
+  * @param action One of the action macros (TAKE, EAT, ...).
+  * @return The matching TRACE_* kind.
+  *
+  * @ingroup philosopher_core
+  */
+ uint32_t	trace_kind(const char *action)
+ {
+	 if (action[0] == 'h')
+		 return (TRACE_TAKE);
+	 if (action[0] == 'd')
+		 return (TRACE_DIE);
+	 if (action[0] == 'e')
+		 return (TRACE_END);
+	 if (action[3] == 'e')
+		 return (TRACE_EAT);
+	 if (action[3] == 's')
+		 return (TRACE_SLEEP);
+	 return (TRACE_THINK);
+ }
+ 
+ /**
+  * @internal
+  * @brief Append one binary trace record to stdout or the shared stream.
+  *
+  * @param philo Philosopher the event belongs to.
+  * @param time Milliseconds since the simulation started.
+  * @param action Action macro being logged.
+  * @param fork Fork index for TAKE events, -1 otherwise.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	print_trace_event(t_philo *philo, long long time,
+		 const char *action, int fork)
+ {
+	 t_trace_event	event;
+ 
+	 event.time = (uint32_t) time;
+	 event.id = (uint32_t) philo->id;
+	 event.fork = fork;
+	 event.kind = trace_kind(action);
+	 if (philo->table->stream)
+		 publish_event(philo->table->stream, &event);
+	 else
+		 serve_dish(philo->table, &event, sizeof(event));
+ }
+ 
+ /**
+  * @brief Write the binary trace header, or open the shared memory stream.
+  *
+  * @details
+  * Must be called once before any philosopher thread starts so that the
+  * header precedes every event record. With `--format=shm` the header goes
+  * into the new stream instead. Does nothing for text output.
+  *
+  * @param table Pointer to the configured table.
+  *
+  * @ingroup philosopher_core
+  */
+ void	print_trace_header(t_table *table)
+ {
+	 t_trace_header	header;
+ 
+	 if (table->menu.format != FORMAT_BINARY
+		 && table->menu.format != FORMAT_SHM)
+		 return ;
+	 memset(&header, 0, sizeof(header));
+	 memcpy(header.magic, TRACE_MAGIC, sizeof(header.magic));
+	 header.version = TRACE_VERSION;
+	 header.philosopher_count = table->philosopher_count;
+	 header.time_to_die = table->time_to_die;
+	 header.time_to_eat = table->time_to_eat;
+	 header.time_to_sleep = table->time_to_sleep;
+	 header.must_eat_count = table->must_eat_count;
+	 header.start_time = table->start_time;
+	 if (table->menu.format == FORMAT_SHM)
+		 open_shm_stream(table, &header);
+	 else
+		 serve_dish(table, &header, sizeof(header));
+ }
+ 
+ /**
+  * @brief Write one action as a text line or a binary trace record.
+  *
+  * @details
+  * Text lines go through `printf` with the default writer and are
+  * otherwise formatted here and loaded into the dumbwaiter. The time
+  * logged is the event's, not the print's; an event stamped before the
+  * previous line is logged at that line's time, so that the log never
+  * goes back in time. With `--tables`, times are since the host table's
+  * start and table `k` numbers its philosophers after those of `k - 1`.
+  *
+  * @param philo Pointer to the philosopher who is performing the action.
+  * @param action String representing the action being performed.
+  * @param fork Fork index for TAKE events, -1 otherwise.
+  * @param when Time of the event (`get_current_time`).
+  * @return The time logged, as a `get_current_time` value.
+  *
+  * @ingroup philosopher_core
+  */
+ long long	write_action(t_philo *philo, const char *action, int fork,
+		 long long when)
+ {
+	 t_table		*host;
+	 long long	time;
+	 char		line[64];
+	 int			size;
+	 int			id;
+ 
+	 host = philo->table->host;
+	 if (is_measured(&host->menu))
+		 note_lag(host, when);
+	 time = when - host->start_time;
+	 if (time < host->last_stamp)
+		 time = host->last_stamp;
+	 host->last_stamp = time;
+	 id = house_number(philo);
+	 if (host->menu.format == FORMAT_BINARY || host->menu.format == FORMAT_SHM)
+		 print_trace_event(philo, time, action, fork);
+	 else if (host->menu.writer == WRITER_STDIO)
+		 printf("%lld %d %s\n", time, id, action);
+	 else
+	 {
+		 size = snprintf(line, sizeof(line), "%lld %d %s\n", time, id, action);
+		 serve_dish(host, line, size);
+	 }
+	 return (host->start_time + time);
+ }
+ 
+ /**
+  * @brief Write the closing message of a dinner where everybody ate enough.
+  *
+  * @details
+  * Emits END_MSG as a text line, or a TRACE_END record in a binary trace.
+  * Called under `pass_padlock`, once the end flag is set.
+  *
+  * @param philo Philosopher whose quota completed the dinner.
+  *
+  * @ingroup philosopher_core
+  */
+ void	write_end_message(t_philo *philo)
+ {
+	 t_table	*host;
+ 
+	 host = philo->table->host;
+	 if (host->menu.format == FORMAT_BINARY || host->menu.format == FORMAT_SHM)
+		 print_trace_event(philo, get_current_time() - host->start_time, END,
+			 -1);
+	 else
+		 serve_dish(host, END_MSG "\n", sizeof(END_MSG));
+ }
+ 
\ No newline at end of file
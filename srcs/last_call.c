@@ -0,0 +1,135 @@
+/**
+ * @file last_call.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief The priority lane for the messages that end the dinner.
+ *
+ * @details
+ * "died" and the end message must come out fast, and last. Philosophers
+ * queue for `print_padlock`, then write under `pass_padlock`, which only
+ * the head of the queue and the closing message ever ask for. The end
+ * flag is set first, which closes the normal lane: philosophers stop
+ * queueing, and whoever gets `print_padlock` from then on finds the
+ * dinner over and writes nothing. The closing message skips the queue
+ * and waits at most for the line being written, then comes out after
+ * every line written so far, and is flushed to stdout on the spot instead
+ * of waiting for a tray to fill up.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+
+ /**
+  * @internal
+  * @brief End the dinner, unless somebody already did, and note how.
+  *
+  * @param philo Philosopher who died, or whose quota completed the dinner.
+  * @param action DIE or END.
+  * @return `true` if this call set the end flag.
+  *
+  * @ingroup philosopher_core
+  */
+ static bool	close_the_kitchen(t_philo *philo, const char *action)
+ {
+	 t_table	*table;
+	 bool	first;
+ 
+	 table = philo->table;
+	 take_padlock(NULL, &table->end_padlock);
+	 first = !table->end_flag;
+	 if (first)
+	 {
+		 table->closer = philo;
+		 __atomic_store_n(&table->closing, action, __ATOMIC_RELEASE);
+		 table->closed_at = get_current_time();
+		 table->closed_wall = get_wall_time();
+	 }
+	 __atomic_store_n(&table->end_flag, 1, __ATOMIC_RELEASE);
+	 pthread_mutex_unlock(&table->end_padlock);
+	 return (first);
+ }
+ 
+ /**
+  * @internal
+  * @brief Push everything logged so far out to stdout.
+  *
+  * @details
+  * Called under `pass_padlock`, once nothing else can be logged.
+  *
+  * @param table Pointer to the shared simulation table.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	flush_log(t_table *table)
+ {
+	 if (table->menu.writer == WRITER_STDIO)
+		 fflush(stdout);
+	 else if (table->dumbwaiter.trays)
+		 send_tray(&table->dumbwaiter, true);
+ }
+ 
+ /**
+  * @brief End the dinner and print its closing message through the fast
+  * lane.
+  *
+  * @details
+  * Only the first caller prints, and is remembered for the summary: a
+  * death and a full table, or the monitor and a lone philosopher, cannot
+  * both close the dinner. With `--tables`, only the caller's table closes,
+  * and the message goes through its host's log. With `--io-stats`
+  * the time from the call to the flushed message is recorded, and how much
+  * of it was spent waiting for the line being written.
+  *
+  * @param philo Philosopher who died, or whose quota completed the dinner.
+  * @param action DIE, or END for the end message.
+  *
+  * @ingroup philosopher_core
+  */
+ void	last_call(t_philo *philo, const char *action)
+ {
+	 t_table		*table;
+	 long long	called;
+	 long long	locked;
+ 
+	 table = philo->table;
+	 called = read_stopwatch(table);
+	 if (!close_the_kitchen(philo, action) || is_quiet(&table->menu))
+		 return ;
+	 table = table->host;
+	 take_padlock(NULL, &table->pass_padlock);
+	 locked = read_stopwatch(table);
+	 if (action[0] == 'e')
+		 write_end_message(philo);
+	 else
+		 write_action(philo, action, -1, get_current_time());
+	 flush_log(table);
+	 if (is_measured(&table->menu))
+	 {
+		 keep_ledger(table, called, locked, 1);
+		 table->ledger.last_call_wait = locked - called;
+		 table->ledger.last_call = get_precise_time() - called;
+	 }
+	 pthread_mutex_unlock(&table->pass_padlock);
+ }
+ 
+ /**
+  * @brief Report the closing message's latency on stderr.
+  *
+  * @details
+  * Part of the `--io-stats` report, printed only when a death or the end
+  * message closed the dinner.
+  *
+  * @param table Pointer to the shared simulation table.
+  *
+  * @ingroup philosopher_core
+  */
+ void	present_last_call(t_table *table)
+ {
+	 if (!table->menu.io_stats || !table->ledger.last_call)
+		 return ;
+	 fprintf(stderr, "philo: last call flushed %.2f us after detection, "
+		 "%.2f us of it waiting for the line being written\n",
+		 table->ledger.last_call / 1e3, table->ledger.last_call_wait / 1e3);
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,167 @@
+/**
+ * @file ledger.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Measurements of a dinner for the benchmark options.
+ *
+ * @details
+ * Keeps the ledger of `--io-stats` and `--report` (print lock wait and hold times, the
+ * monitor's smallest margin to `time_to_die`, how late lines are
+ * printed after their event) and prints it, together with
+ * the meal throughput of a `--run-for` dinner, once the threads are done.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+
+ /**
+  * @brief Record one use of `print_padlock` in the `--io-stats` ledger.
+  *
+  * @details
+  * Called with the lock still held, right after printing. The wait runs
+  * from asking for the lock to getting it; the hold from getting it to
+  * now, so it covers the formatting and the write.
+  *
+  * @param table Pointer to the shared simulation table.
+  * @param asked When the lock was requested (`get_precise_time`).
+  * @param locked When the lock was obtained.
+  * @param lines Number of lines actually written.
+  *
+  * @ingroup philosopher_core
+  */
+ void	keep_ledger(t_table *table, long long asked, long long locked,
+		 int lines)
+ {
+	 long long	held;
+	 long long	waited;
+ 
+	 held = get_precise_time() - locked;
+	 waited = locked - asked;
+	 table->ledger.lines += lines;
+	 table->ledger.uses++;
+	 table->ledger.hold_total += held;
+	 table->ledger.wait_total += waited;
+	 if (held > table->ledger.hold_max)
+		 table->ledger.hold_max = held;
+	 if (waited > table->ledger.wait_max)
+		 table->ledger.wait_max = waited;
+ }
+ 
+ /**
+  * @brief Record how close a philosopher is to starving.
+  *
+  * @details
+  * Called by the monitor under `eat_padlock` each time it looks at a
+  * philosopher. The smallest margin seen ends up in the ledger.
+  *
+  * @param philo Philosopher being monitored.
+  *
+  * @ingroup philosopher_core
+  */
+ void	note_margin(t_philo *philo)
+ {
+	 long long	margin;
+ 
+	 margin = own_time_to_die(philo) - (get_current_time() - philo->last_meal);
+	 if (margin < philo->table->ledger.min_margin)
+		 philo->table->ledger.min_margin = margin;
+ }
+ 
+ /**
+  * @brief Record how long after its event a line is being written.
+  *
+  * @details
+  * Called under `pass_padlock`, with the time the event was stamped. This
+  * is how far the log's timestamps would lag if they were read at print
+  * time, mostly the wait for `print_padlock` and the second fork.
+  *
+  * @param table Pointer to the shared simulation table.
+  * @param when Time of the event (`get_current_time`).
+  *
+  * @ingroup philosopher_core
+  */
+ void	note_lag(t_table *table, long long when)
+ {
+	 long long	lag;
+ 
+	 lag = get_current_time() - when;
+	 table->ledger.lag_total += lag;
+	 if (lag > table->ledger.lag_max)
+		 table->ledger.lag_max = lag;
+ }
+ 
+ /**
+  * @brief Lock a fork or the print lock, counting it if it was taken.
+  *
+  * @details
+  * A `trylock` first: only a lock found taken costs the atomic increment
+  * of the contention count, read live by the `--samples` thread. With
+  * `--processes`, a lock whose holder died is made consistent and kept.
+  * The table's other locks come here too, with no table so they are not
+  * counted: locked plainly, one whose holder died would be unrecoverable.
+  *
+  * @param table Pointer to the shared simulation table, NULL not to count.
+  * @param padlock Mutex to lock.
+  *
+  * @ingroup philosopher_core
+  */
+ void	take_padlock(t_table *table, pthread_mutex_t *padlock)
+ {
+	 int	taken;
+ 
+	 taken = pthread_mutex_trylock(padlock);
+	 if (taken == EBUSY)
+	 {
+		 if (table)
+			 __atomic_add_fetch(&table->ledger.contended, 1, __ATOMIC_RELAXED);
+		 taken = pthread_mutex_lock(padlock);
+	 }
+	 if (taken == EOWNERDEAD)
+		 pthread_mutex_consistent(padlock);
+ }
+ 
+ /**
+  * @brief Report the benchmark figures of the dinner on stderr.
+  *
+  * @details
+  * With `--run-for`, sums every philosopher's meals once their threads are
+  * joined, at every `--tables` table, and divides by the wall time since
+  * the start, giving the saturation benchmark's headline number. With
+  * `--io-stats`, prints the lines written, the average and longest print
+  * lock hold and wait, the smallest margin to `time_to_die`, how long
+  * after their event lines were printed, and the latency of the closing
+  * message.
+  *
+  * @param table Pointer to the shared simulation table.
+  *
+  * @ingroup philosopher_core
+  */
+ void	present_bill(t_table *table)
+ {
+	 long long	meals;
+	 long long	elapsed;
+	 int			number;
+ 
+	 elapsed = get_current_time() - table->start_time + 1;
+	 meals = 0;
+	 number = 0;
+	 while (++number <= table->menu.tables)
+		 meals += count_meals(house_table(table, number));
+	 if (table->menu.run_for)
+		 fprintf(stderr, "philo: %lld meals in %lld ms, %.0f meals/s\n",
+			 meals, elapsed, meals * 1000.0 / elapsed);
+	 if (table->menu.io_stats)
+		 fprintf(stderr, "philo: io %lld lines in %lld ms, lock held %.2f us "
+			 "avg %.2f us max, waited %.2f us avg %.2f us max, min margin "
+			 "%lld ms, printed %.3f ms avg %lld ms max after the event\n",
+			 table->ledger.lines, elapsed,
+			 average(table->ledger.hold_total / 1e3, table->ledger.uses),
+			 table->ledger.hold_max / 1e3,
+			 average(table->ledger.wait_total / 1e3, table->ledger.uses),
+			 table->ledger.wait_max / 1e3, table->ledger.min_margin,
+			 average(table->ledger.lag_total, table->ledger.lines),
+			 table->ledger.lag_max);
+	 present_last_call(table);
+ }
+ 
\ No newline at end of file
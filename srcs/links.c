@@ -0,0 +1,194 @@
+/**
+ * @file links.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Sockets between the wings of a `--workers` ring (`--link`).
+ *
+ * @details
+ * With `--link=unix` or `--link=tcp`, every fork on the border of two
+ * wings gets a socket pair: a Unix domain socket pair, or a TCP
+ * connection on the loopback as a stand-in for a network. One end is
+ * kept by the porter of the wing the fork belongs to, the one where it
+ * is its first philosopher's left fork; the other by the worker of the
+ * wing before, whose last philosopher uses it as its right fork. Both
+ * are made by the main process before any worker is forked, and every
+ * process closes the ends that are not its own, so that hanging up a
+ * link is seen on the other side.
+ *
+ * What goes over a link is a stream of `t_slip`s, written whole and read
+ * as many at a time as have arrived. Only the border forks go this way:
+ * the seats, the log, `eat_padlock` and the monitor's reads stay in
+ * shared memory, as with `--workers` alone.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+ #include <netinet/in.h>
+ #include <netinet/tcp.h>
+ #include <sys/socket.h>
+
+ /**
+  * @internal
+  * @brief Connect a socket pair for one border fork.
+  *
+  * @details
+  * A Unix domain pair, or over TCP: listens on an ephemeral port of the
+  * loopback, connects to it and accepts, then turns Nagle's algorithm off
+  * on both ends, so that slips are sent as soon as written.
+  *
+  * @param link LINK_UNIX or LINK_TCP.
+  * @param ends Receives the porter's end, then the other one.
+  * @return 0 on success, -1 on failure.
+  *
+  * @ingroup philosopher_core
+  */
+ static int	pair_ends(int link, int ends[2])
+ {
+	 struct sockaddr_in	address;
+	 socklen_t			size;
+	 int					listener;
+	 int					on;
+ 
+	 if (link == LINK_UNIX)
+		 return (socketpair(AF_UNIX, SOCK_STREAM, 0, ends));
+	 address = (struct sockaddr_in){.sin_family = AF_INET,
+		 .sin_addr.s_addr = htonl(INADDR_LOOPBACK)};
+	 size = sizeof(address);
+	 on = 1;
+	 listener = socket(AF_INET, SOCK_STREAM, 0);
+	 ends[1] = socket(AF_INET, SOCK_STREAM, 0);
+	 ends[0] = -1;
+	 if (listener >= 0 && ends[1] >= 0
+		 && bind(listener, (struct sockaddr *)&address, size) == 0
+		 && listen(listener, 1) == 0
+		 && getsockname(listener, (struct sockaddr *)&address, &size) == 0
+		 && connect(ends[1], (struct sockaddr *)&address, size) == 0)
+		 ends[0] = accept(listener, NULL, NULL);
+	 close(listener);
+	 setsockopt(ends[0], IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+	 setsockopt(ends[1], IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+	 return (-(ends[0] < 0));
+ }
+ 
+ /**
+  * @brief Connect the border forks of a `--link` dinner.
+  *
+  * @details
+  * `links` gets two entries per fork, -1 but for those on a border: the
+  * porter's end at `2 * fork`, the other one right after.
+  *
+  * @param table Pointer to the shared simulation table, forks laid.
+  *
+  * @note Exits the program if a link cannot be made. The options it
+  * needs are checked with the others (see menu_check.c).
+  *
+  * @ingroup philosopher_core
+  */
+ void	open_links(t_table *table)
+ {
+	 int	*ends;
+	 int	seat;
+ 
+	 if (!table->menu.link)
+		 return ;
+	 table->links = malloc(sizeof(int) * 2 * table->fork_count);
+	 seat = -1;
+	 while (table->links && ++seat < table->philosopher_count)
+	 {
+		 ends = &table->links[2 * table->philo[seat].right_fork];
+		 ends[0] = -1;
+		 ends[1] = -1;
+		 if (find_wing(table, seat) != find_wing(table,
+				 (seat + 1) % table->philosopher_count)
+			 && pair_ends(table->menu.link, ends) == -1)
+			 break ;
+	 }
+	 if (table->links && seat == table->philosopher_count)
+		 return ;
+	 ft_putstr_fd(2, "Error: couldn't link the wings\n");
+	 clean_table(table);
+	 exit(EXIT_FAILURE);
+ }
+ 
+ /**
+  * @brief Close every link end a process does not use.
+  *
+  * @param table Pointer to the shared simulation table.
+  * @param porter End kept for the wing's porter, or -1.
+  * @param courier End kept for the wing's last philosopher, or -1.
+  *
+  * @ingroup philosopher_core
+  */
+ void	close_links(t_table *table, int porter, int courier)
+ {
+	 int	i;
+ 
+	 i = -1;
+	 while (table->links && ++i < 2 * table->fork_count)
+	 {
+		 if (table->links[i] >= 0 && table->links[i] != porter
+			 && table->links[i] != courier)
+		 {
+			 close(table->links[i]);
+			 table->links[i] = -1;
+		 }
+	 }
+ }
+ 
+ /**
+  * @brief Send one slip, stamped now.
+  *
+  * @param fd Link end.
+  * @param kind One of the SLIP_* messages.
+  * @param fork Fork it is about.
+  * @return `false` if the link is broken.
+  *
+  * @ingroup philosopher_core
+  */
+ bool	send_slip(int fd, int kind, int fork)
+ {
+	 t_slip	slip;
+ 
+	 slip = (t_slip){kind, fork, get_precise_time()};
+	 return (send(fd, &slip, sizeof(slip), MSG_NOSIGNAL)
+		 == (ssize_t) sizeof(slip));
+ }
+ 
+ /**
+  * @brief Read every slip that has arrived, waiting for one at least.
+  *
+  * @details
+  * A slip cut in two by the stream is read to its end. A read interrupted
+  * by a signal is tried again rather than taken for a hang-up.
+  *
+  * @param fd Link end.
+  * @param slips Room for `max` slips.
+  * @param max Most slips to read.
+  * @return Slips read, 0 once the link is hung up or broken.
+  *
+  * @ingroup philosopher_core
+  */
+ int	read_slips(int fd, t_slip *slips, int max)
+ {
+	 ssize_t	got;
+	 ssize_t	more;
+ 
+	 got = recv(fd, slips, sizeof(t_slip) * max, 0);
+	 while (got == -1 && errno == EINTR)
+		 got = recv(fd, slips, sizeof(t_slip) * max, 0);
+	 while (got > 0 && got % sizeof(t_slip) != 0)
+	 {
+		 more = recv(fd, (char *) slips + got,
+				 sizeof(t_slip) - got % sizeof(t_slip), 0);
+		 if (more == -1 && errno == EINTR)
+			 continue ;
+		 if (more <= 0)
+			 return (0);
+		 got += more;
+	 }
+	 if (got <= 0)
+		 return (0);
+	 return (got / sizeof(t_slip));
+ }
+ 
\ No newline at end of file
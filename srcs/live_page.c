@@ -0,0 +1,185 @@
+/**
+ * @file live_page.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief The `--live` stats page in shared memory.
+ *
+ * @details
+ * The page is created and populated before the dinner, so that keeping a
+ * seat up to date only stores to memory the philosopher's thread alone
+ * writes: no lock, no system call, no cache line shared with another
+ * philosopher. See philo_live.h for what viewers such as `philo-top` may
+ * rely on.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+ #include <fcntl.h>
+ #include <sys/mman.h>
+
+ /**
+  * @internal
+  * @brief Create the shared memory object afresh and map it populated.
+  *
+  * @param table Pointer to the configured table.
+  * @return The mapping, or MAP_FAILED.
+  *
+  * @ingroup philosopher_core
+  */
+ static t_live_page	*map_page(t_table *table)
+ {
+	 t_live_page	*live;
+	 size_t		size;
+	 int			fd;
+ 
+	 size = sizeof(t_live_page)
+		 + table->seat_count * sizeof(t_live_seat);
+	 shm_unlink(table->menu.live);
+	 fd = shm_open(table->menu.live, O_CREAT | O_EXCL | O_RDWR, 0644);
+	 live = MAP_FAILED;
+	 if (fd != -1 && ftruncate(fd, size) == 0)
+		 live = mmap(NULL, size, PROT_READ | PROT_WRITE,
+				 MAP_SHARED | MAP_POPULATE, fd, 0);
+	 if (fd != -1)
+		 close(fd);
+	 return (live);
+ }
+ 
+ /**
+  * @brief Create the `--live` stats page and describe the run in it.
+  *
+  * @details
+  * A leftover object of the same name is replaced. Must be called once
+  * the philosophers are welcomed, before any of their threads starts.
+  *
+  * @param table Pointer to the table, philosophers welcomed.
+  *
+  * @note Exits the program if the object cannot be created or mapped.
+  *
+  * @ingroup philosopher_core
+  */
+ void	open_live_page(t_table *table)
+ {
+	 t_live_page	*live;
+ 
+	 if (!table->menu.live)
+		 return ;
+	 live = map_page(table);
+	 if (live == MAP_FAILED)
+	 {
+		 ft_putstr_fd(2, "Couldn't open the live stats page\n");
+		 shm_unlink(table->menu.live);
+		 clean_table(table);
+		 exit(EXIT_FAILURE);
+	 }
+	 *live = (t_live_page){.seat_count = table->seat_count,
+		 .time_to_die = table->time_to_die, .time_to_eat = table->time_to_eat,
+		 .time_to_sleep = table->time_to_sleep,
+		 .must_eat = table->must_eat_count, .start_time = table->start_time};
+	 memcpy(live->magic, LIVE_MAGIC, sizeof(live->magic));
+	 __atomic_store_n(&live->version, LIVE_VERSION, __ATOMIC_RELEASE);
+	 table->live = live;
+ }
+ 
+ /**
+  * @internal
+  * @brief Show a new state on a seat.
+  *
+  * @details
+  * Sleeping or thinking means both forks are back on the table.
+  *
+  * @param seat Seat to update.
+  * @param kind TRACE_* kind of the action, not TRACE_TAKE.
+  * @param since When the action happened (ms since the start).
+  *
+  * @ingroup philosopher_core
+  */
+ static void	set_state(t_live_seat *seat, uint32_t kind, long long since)
+ {
+	 if (kind == TRACE_SLEEP || kind == TRACE_THINK)
+		 __atomic_store_n(&seat->forks, 0, __ATOMIC_RELAXED);
+	 __atomic_store_n(&seat->since, since, __ATOMIC_RELAXED);
+	 __atomic_store_n(&seat->state, kind, __ATOMIC_RELAXED);
+ }
+ 
+ /**
+  * @brief Count a philosopher's actions, and bring the seat up to date.
+  *
+  * @details
+  * Called by the philosopher's own thread for every action, logged or
+  * not. Adds them to `events`; the rest only happens with `--live`, and
+  * stops with the dinner, so that the page keeps the state it ended in.
+  * Taking a fork marks it held. The meals and
+  * last meal are copied as they stand, so they catch up with a meal when
+  * its nap starts.
+  *
+  * @param philo Philosopher performing the actions.
+  * @param order Actions, as handed to `print_order`.
+  * @param count Number of actions.
+  *
+  * @ingroup philosopher_core
+  */
+ void	tally_actions(t_philo *philo, t_order *order, int count)
+ {
+	 t_live_seat	*seat;
+	 uint32_t	kind;
+	 int			i;
+ 
+	 philo->events += count;
+	 if (!philo->table->live
+		 || __atomic_load_n(&philo->table->end_flag, __ATOMIC_ACQUIRE))
+		 return ;
+	 seat = &philo->table->live->seats[philo->id - 1];
+	 i = -1;
+	 while (++i < count)
+	 {
+		 kind = trace_kind(order[i].action);
+		 if (kind == TRACE_TAKE)
+			 __atomic_store_n(&seat->forks, seat->forks | (LIVE_LEFT
+					 << (order[i].fork != philo->left_fork)), __ATOMIC_RELAXED);
+		 else
+			 set_state(seat, kind, order[i].when - philo->table->start_time);
+	 }
+	 __atomic_store_n(&seat->meals, philo->meal_count, __ATOMIC_RELAXED);
+	 __atomic_store_n(&seat->last_meal, philo->last_meal
+		 - philo->table->start_time, __ATOMIC_RELAXED);
+ }
+ 
+ /**
+  * @brief Mark the page closed, unmap it and remove its name.
+  *
+  * @details
+  * Called once every philosopher thread is joined. The seat of a
+  * philosopher who died shows TRACE_DIE from then on.
+  *
+  * @param table Pointer to the shared simulation table.
+  *
+  * @ingroup philosopher_core
+  */
+ void	close_live_page(t_table *table)
+ {
+	 long long	closed_at;
+ 
+	 if (!table->live)
+		 return ;
+	 closed_at = get_current_time() - table->start_time;
+	 if (table->closing)
+		 closed_at = table->closed_at - table->start_time;
+	 if (table->closing && trace_kind(table->closing) == TRACE_DIE)
+	 {
+		 __atomic_store_n(&table->live->seats[table->closer->id - 1].forks, 0,
+			 __ATOMIC_RELAXED);
+		 set_state(&table->live->seats[table->closer->id - 1], TRACE_DIE,
+			 closed_at);
+		 __atomic_store_n(&table->live->closer, table->closer->id,
+			 __ATOMIC_RELAXED);
+	 }
+	 __atomic_store_n(&table->live->closed_at, closed_at, __ATOMIC_RELAXED);
+	 __atomic_store_n(&table->live->closed, 1, __ATOMIC_RELEASE);
+	 munmap(table->live, sizeof(t_live_page)
+		 + table->seat_count * sizeof(t_live_seat));
+	 shm_unlink(table->menu.live);
+	 table->live = NULL;
+ }
+ 
\ No newline at end of file
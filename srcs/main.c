@@ -6,7 +6,7 @@
  *
  * @details
  * This file contains the `main` function which sets up the simulation:
- * - Parses arguments
+ * - Parses options and arguments
  * - Initializes the table and rules
  * - Starts philosopher threads
  * - Launches the dinner monitor
@@ -20,8 +20,11 @@
   * @brief Launch the Dining Philosophers simulation.
   *
   * @details
-  * Initializes the simulation environment, spawns philosopher threads,
-  * and starts the monitor loop that watches for termination conditions.
+  * Reads the leading options, then hands the remaining arguments to the
+  * validation and setup steps as if the options were not there. Lays the
+  * table on the stack, or in shared memory for `--processes`. Initializes
+  * the simulation environment, spawns philosopher threads, and starts the
+  * monitor loop that watches for termination conditions.
   *
   * @param argc Argument count from command line.
   * @param argv Argument vector containing configuration parameters.
@@ -31,14 +34,29 @@
   */
  int	main(int argc, char **argv)
  {
-	 t_table	table;
+	 t_table	room;
+	 t_table	*table;
+	 int		skip;
  
-	 receive_guests(argc, argv);
-	 set_table(&table, argc, argv);
-	 welcome_philosophers(&table);
-	 set_rules(&table);
-	 seat_philosophers_at_the_table(&table);
-	 dinner_monitor(&table);
+	 skip = read_menu(&room.menu, argc, argv) - 1;
+	 receive_guests(&room.menu, argc - skip, argv + skip);
+	 table = book_room(&room);
+	 set_table(table, argc - skip, argv + skip);
+	 open_reports(table);
+	 welcome_philosophers(table);
+	 load_scenario(table);
+	 open_cellar(table);
+	 open_house(table, argc - skip, argv + skip);
+	 open_live_page(table);
+	 install_dumbwaiter(table);
+	 set_rules(table);
+	 open_metrics(table);
+	 open_control(table);
+	 open_links(table);
+	 seat_house(table);
+	 seat_philosophers_at_the_table(table);
+	 open_doors(table);
+	 dinner_monitor(table);
 	 return (EXIT_SUCCESS);
  }
  
\ No newline at end of file
@@ -0,0 +1,167 @@
+/**
+ * @file menu.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Parses the optional `--name=value` switches of the simulation.
+ *
+ * @details
+ * Options are accepted only before the positional arguments, so the classic
+ * `./philo N die eat sleep [meals]` invocation is left untouched. Each
+ * option fills a field of the table's `t_menu`.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+
+ /**
+  * @internal
+  * @brief Reject an unknown option or value and exit.
+  *
+  * @param arg The offending argument.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	order_off_menu(char *arg)
+ {
+	 ft_putstr_fd(2, "Unknown option: ");
+	 ft_putstr_fd(2, arg);
+	 ft_putstr_fd(2, "\n");
+	 show_menu(2);
+	 exit(EXIT_FAILURE);
+ }
+ 
+ /**
+  * @internal
+  * @brief Translate an option value into its position in a list of names.
+  *
+  * @details
+  * The lists follow the order of the matching macros, so that `--format`
+  * values map to FORMAT_*, `--writer` values to WRITER_* and
+  * `--sample-format` values to SAMPLE_*.
+  *
+  * @param arg Whole option, reported if the value is unknown.
+  * @param value Text after the `=`.
+  * @param names NULL-terminated accepted values.
+  * @return Index of `value` in `names`.
+  *
+  * @ingroup philosopher_core
+  */
+ static int	choose(char *arg, const char *value, const char **names)
+ {
+	 int	i;
+ 
+	 i = 0;
+	 while (names[i] && !is_same(value, names[i]))
+		 i++;
+	 if (!names[i])
+		 order_off_menu(arg);
+	 return (i);
+ }
+ 
+ /**
+  * @internal
+  * @brief Apply one of the options that report on the dinner or steer it.
+  *
+  * @details
+  * These are `--report`, `--samples` and its settings, `--metrics`, and
+  * `--control`.
+  *
+  * @param menu Menu to fill.
+  * @param arg Option, `--name=value`.
+  * @return `false` if `arg` is not one of them.
+  *
+  * @note Exits the program on unknown values.
+  *
+  * @ingroup philosopher_core
+  */
+ static bool	read_service(t_menu *menu, char *arg)
+ {
+	 const char	*value;
+ 
+	 if (is_option(arg, "report", &value) && value[0])
+		 menu->report = value;
+	 else if (is_option(arg, "metrics", &value) && value[0])
+		 menu->metrics = value;
+	 else if (is_option(arg, "control", &value) && value[0])
+		 menu->control = value;
+	 else if (is_option(arg, "samples", &value) && value[0])
+		 menu->samples = value;
+	 else if (is_option(arg, "sample-every", &value) && is_number(value)
+		 && ft_atoi(value) > 0)
+		 menu->sample_every = ft_atoi(value);
+	 else if (is_option(arg, "sample-format", &value))
+		 menu->sample_format = choose(arg, value,
+				 (const char *[]){"csv", "ndjson", NULL});
+	 else
+		 return (false);
+	 return (true);
+ }
+ 
+ /**
+  * @internal
+  * @brief Apply one option to the menu.
+  *
+  * @param menu Menu to fill.
+  * @param arg Option, `--name=value` or a bare `--flag`.
+  *
+  * @note Exits the program on unknown options or values.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	read_option(t_menu *menu, char *arg)
+ {
+	 const char	*value;
+ 
+	 if (is_option(arg, "format", &value))
+		 menu->format = choose(arg, value,
+				 (const char *[]){"text", "binary", "none", "shm", "summary",
+				 "json", NULL});
+	 else if (is_option(arg, "writer", &value))
+		 menu->writer = choose(arg, value,
+				 (const char *[]){"stdio", "write", "uring", "splice", NULL});
+	 else if (is_option(arg, "run-for", &value) && is_number(value)
+		 && ft_atoi(value) > 0)
+		 menu->run_for = ft_atoi(value);
+	 else if (is_option(arg, "shm-name", &value) && value[0])
+		 menu->shm_name = value;
+	 else if (is_option(arg, "live", &value) && value[0] == '/')
+		 menu->live = value;
+	 else if (is_same(arg, "--io-stats"))
+		 menu->io_stats = true;
+	 else if (!read_service(menu, arg) && !read_shape(menu, arg))
+		 order_off_menu(arg);
+ }
+ 
+ /**
+  * @brief Parse leading options into the menu.
+  *
+  * @details
+  * Sets defaults first (text through stdio, no time limit, no statistics,
+  * SHM_NAME for the shared memory stream, CSV samples every SAMPLE_EVERY
+  * ms, one table), then consumes every argument
+  * starting with `--`, either `--name=value` or a bare `--flag`.
+  * Unknown options or values terminate the program with the option list.
+  *
+  * @param menu Menu to fill.
+  * @param argc Argument count.
+  * @param argv Argument vector.
+  * @return Index of the first positional argument in `argv`.
+  *
+  * @ingroup philosopher_core
+  */
+ int	read_menu(t_menu *menu, int argc, char **argv)
+ {
+	 int	i;
+ 
+	 memset(menu, 0, sizeof(*menu));
+	 menu->shm_name = SHM_NAME;
+	 menu->sample_every = SAMPLE_EVERY;
+	 menu->seed = DRINK_SEED;
+	 menu->tables = 1;
+	 i = 1;
+	 while (i < argc && argv[i][0] == '-' && argv[i][1] == '-')
+		 read_option(menu, argv[i++]);
+	 return (i);
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,108 @@
+/**
+ * @file menu_card.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief The option list shown on usage errors.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+
+ /**
+  * @internal
+  * @brief Print the options that change where and how the log goes.
+  *
+  * @param fd File descriptor to write to.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	show_output(int fd)
+ {
+	 ft_putstr_fd(fd, "  --format=text|binary|none|shm|summary|json\n"
+		 "                             log lines, binary trace, nothing, "
+		 "shared memory,\n"
+		 "                             or one closing line or JSON record\n");
+	 ft_putstr_fd(fd, "  --shm-name=/name           shared memory object "
+		 "(default " SHM_NAME ")\n");
+	 ft_putstr_fd(fd, "  --live=/name               keep live stats in shared "
+		 "memory for philo-top\n");
+	 ft_putstr_fd(fd, "  --writer=stdio|write|uring|splice\n"
+		 "                             printf, buffered write(), io_uring or "
+		 "vmsplice\n");
+ }
+ 
+ /**
+  * @internal
+  * @brief Print the options that shape the dinner.
+  *
+  * @param fd File descriptor to write to.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	show_shapes(int fd)
+ {
+	 ft_putstr_fd(fd, "  --scenario=path            give some philosophers "
+		 "timings of their own\n");
+	 ft_putstr_fd(fd, "  --graph=path               share forks along the "
+		 "edges of a graph file\n");
+	 ft_putstr_fd(fd, "  --drinking=pct             take a random pct of the "
+		 "forks, all at once\n");
+	 ft_putstr_fd(fd, "  --seed=n                   seed of the --drinking "
+		 "draws\n");
+	 ft_putstr_fd(fd, "  --tables=k                 k dinners at once, "
+		 "on their own CPUs\n");
+	 ft_putstr_fd(fd, "  --processes                one process per "
+		 "philosopher, forks in shared memory\n");
+	 ft_putstr_fd(fd, "  --workers=k                split the ring between k "
+		 "processes of threads\n");
+	 ft_putstr_fd(fd, "  --link=unix|tcp            pass the border forks "
+		 "between workers by message\n");
+	 ft_putstr_fd(fd, "  --link-delay=us            delay every message on "
+		 "the link by us\n");
+ }
+ 
+ /**
+  * @internal
+  * @brief Print the options that time the dinner or measure it.
+  *
+  * @param fd File descriptor to write to.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	show_measures(int fd)
+ {
+	 ft_putstr_fd(fd, "  --run-for=ms               end the dinner after ms "
+		 "of wall time\n");
+	 ft_putstr_fd(fd, "  --io-stats                 report print lock timings "
+		 "on stderr\n");
+	 ft_putstr_fd(fd, "  --report=path|fd           write a JSON report of the "
+		 "dinner when it ends\n");
+	 ft_putstr_fd(fd, "  --metrics=socket           serve Prometheus metrics on "
+		 "a Unix socket\n");
+	 ft_putstr_fd(fd, "  --control=socket           pause, resume and re-time "
+		 "the dinner live\n");
+	 ft_putstr_fd(fd, "  --seats=n                  room for n philosophers, "
+		 "to join with --control\n");
+	 ft_putstr_fd(fd, "  --samples=path|fd          append a snapshot of the "
+		 "counters every interval\n");
+	 ft_putstr_fd(fd, "  --sample-every=ms          sampling interval "
+		 "(default " TO_STRING(SAMPLE_EVERY) ")\n");
+	 ft_putstr_fd(fd, "  --sample-format=csv|ndjson snapshot lines\n");
+ }
+ 
+ /**
+  * @brief Print the list of supported options.
+  *
+  * @param fd File descriptor to write to.
+  *
+  * @ingroup philosopher_core
+  */
+ void	show_menu(int fd)
+ {
+	 ft_putstr_fd(fd, "Options (before the arguments):\n");
+	 show_output(fd);
+	 show_shapes(fd);
+	 show_measures(fd);
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,148 @@
+/**
+ * @file menu_check.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Options that do not go together.
+ *
+ * @details
+ * Every combination is checked once, as soon as the arguments are read,
+ * each with its own message; the setup steps then only report their own
+ * failures.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+
+ /**
+  * @internal
+  * @brief Refuse two options given together.
+  *
+  * @param bad Whether they were.
+  * @param option The first one, or the whole complaint.
+  * @param other The one it does not go with, or NULL after a complaint.
+  *
+  * @note Exits the program if `bad`.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	refuse(bool bad, char *option, char *other)
+ {
+	 if (!bad)
+		 return ;
+	 ft_putstr_fd(2, "Error: ");
+	 ft_putstr_fd(2, option);
+	 if (other)
+	 {
+		 ft_putstr_fd(2, " does not go with ");
+		 ft_putstr_fd(2, other);
+	 }
+	 ft_putstr_fd(2, "\n");
+	 exit(EXIT_FAILURE);
+ }
+ 
+ /**
+  * @internal
+  * @brief Refuse what does not go with several tables (`--tables`).
+  *
+  * @details
+  * The live page, the servers, the samples, the seats, the splice writer
+  * and the binary streams all belong to a single table (see house.c).
+  *
+  * @param menu Options read by `read_menu`.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	check_tables(const t_menu *menu)
+ {
+	 bool	house;
+ 
+	 house = menu->tables > 1;
+	 refuse(house && menu->live, "--tables", "--live");
+	 refuse(house && menu->metrics, "--tables", "--metrics");
+	 refuse(house && menu->control, "--tables", "--control");
+	 refuse(house && menu->samples, "--tables", "--samples");
+	 refuse(house && menu->seats, "--tables", "--seats");
+	 refuse(house && menu->writer == WRITER_SPLICE, "--tables",
+		 "--writer=splice");
+	 refuse(house && menu->format == FORMAT_BINARY, "--tables",
+		 "--format=binary");
+	 refuse(house && menu->format == FORMAT_SHM, "--tables", "--format=shm");
+ }
+ 
+ /**
+  * @internal
+  * @brief Refuse what does not go with philosophers in processes of their
+  * own (`--processes`, `--workers`).
+  *
+  * @details
+  * Only the table is shared between them: the threads that serve the
+  * dinner, the writers and the binary streams stay in the main process.
+  *
+  * @param menu Options read by `read_menu`.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	check_rooms(const t_menu *menu)
+ {
+	 char	*rooms;
+ 
+	 if (!menu->processes)
+		 return ;
+	 rooms = "--processes";
+	 if (menu->workers)
+		 rooms = "--workers";
+	 refuse(menu->seats, rooms, "--seats");
+	 refuse(menu->control, rooms, "--control");
+	 refuse(menu->metrics, rooms, "--metrics");
+	 refuse(menu->tables > 1, rooms, "--tables");
+	 refuse(menu->writer != WRITER_STDIO, rooms, "--writer");
+	 refuse(menu->format == FORMAT_BINARY, rooms, "--format=binary");
+	 refuse(menu->format == FORMAT_SHM, rooms, "--format=shm");
+ }
+ 
+ /**
+  * @internal
+  * @brief Refuse what does not go with `--link`.
+  *
+  * @details
+  * Only border forks of the ring go by message, between two wings or
+  * more that each have a philosopher.
+  *
+  * @param menu Options read by `read_menu`.
+  * @param philosophers Number of philosophers.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	check_link(const t_menu *menu, int philosophers)
+ {
+	 if (!menu->link)
+		 return ;
+	 refuse(menu->graph, "--link", "--graph");
+	 refuse(menu->drinking, "--link", "--drinking");
+	 refuse(menu->workers < 2, "--link needs 2 --workers or more", NULL);
+	 refuse(menu->workers > philosophers,
+		 "--link needs no more --workers than philosophers", NULL);
+ }
+ 
+ /**
+  * @brief Refuse the options that do not go together.
+  *
+  * @param menu Options read by `read_menu`.
+  * @param philosophers Number of philosophers, checked.
+  *
+  * @note Exits the program on the first bad combination.
+  *
+  * @ingroup philosopher_core
+  */
+ void	check_menu(const t_menu *menu, int philosophers)
+ {
+	 refuse(menu->scenario && menu->seats, "--scenario", "--seats");
+	 refuse(menu->graph && menu->seats, "--graph", "--seats");
+	 refuse(menu->graph && menu->scenario, "--graph", "--scenario");
+	 refuse(menu->drinking && menu->seats, "--drinking", "--seats");
+	 check_tables(menu);
+	 check_rooms(menu);
+	 check_link(menu, philosophers);
+ }
+ 
\ No newline at end of file
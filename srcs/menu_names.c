@@ -0,0 +1,83 @@
+/**
+ * @file menu_names.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Names of the menu's choices, as the reports spell them.
+ *
+ * @details
+ * The names are those `read_menu` accepts. A value out of range, which
+ * the menu never holds, is named "unknown" rather than read past the
+ * end of the list.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+
+ /**
+  * @brief Spell a flag as JSON.
+  *
+  * @param value Flag.
+  * @return "true" or "false".
+  *
+  * @ingroup philosopher_core
+  */
+ const char	*bool_name(bool value)
+ {
+	 if (value)
+		 return ("true");
+	 return ("false");
+ }
+ 
+ /**
+  * @brief Name a `--format`.
+  *
+  * @param format One of the FORMAT_* output modes.
+  * @return Its name.
+  *
+  * @ingroup philosopher_core
+  */
+ const char	*format_name(int format)
+ {
+	 static const char	*names[] = {"text", "binary", "none", "shm",
+		 "summary", "json"};
+ 
+	 if (format < FORMAT_TEXT || format > FORMAT_JSON)
+		 return ("unknown");
+	 return (names[format]);
+ }
+ 
+ /**
+  * @brief Name a `--writer`.
+  *
+  * @param writer One of the WRITER_* backends.
+  * @return Its name.
+  *
+  * @ingroup philosopher_core
+  */
+ const char	*writer_name(int writer)
+ {
+	 static const char	*names[] = {"stdio", "write", "uring", "splice"};
+ 
+	 if (writer < WRITER_STDIO || writer > WRITER_SPLICE)
+		 return ("unknown");
+	 return (names[writer]);
+ }
+ 
+ /**
+  * @brief Name a `--link`.
+  *
+  * @param link One of the LINK_* transports.
+  * @return Its name, "none" without `--link`.
+  *
+  * @ingroup philosopher_core
+  */
+ const char	*link_name(int link)
+ {
+	 static const char	*names[] = {"none", "unix", "tcp"};
+ 
+	 if (link < LINK_NONE || link > LINK_TCP)
+		 return ("unknown");
+	 return (names[link]);
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,88 @@
+/**
+ * @file menu_shape.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Options that change the shape of the dinner.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+
+ /**
+  * @internal
+  * @brief Apply `--processes`, `--workers=k` or the `--link` options.
+  *
+  * @details
+  * `--workers` puts the philosophers in k processes, `--processes` in one
+  * each unless `--workers` is given too. `--link=unix|tcp` sends the forks
+  * between workers over sockets, `--link-delay=us` delays every message
+  * by up to a second.
+  *
+  * @param menu Menu to fill.
+  * @param arg Option.
+  * @return `false` if `arg` is none of them, or has a bad value.
+  *
+  * @ingroup philosopher_core
+  */
+ static bool	read_rooms(t_menu *menu, const char *arg)
+ {
+	 const char	*value;
+ 
+	 if (is_same(arg, "--processes"))
+		 menu->processes = true;
+	 else if (is_option(arg, "workers", &value) && is_number(value)
+		 && ft_atoi(value) > 0 && ft_atoi(value) <= MAX_PHILO)
+	 {
+		 menu->processes = true;
+		 menu->workers = ft_atoi(value);
+	 }
+	 else if (is_option(arg, "link", &value)
+		 && (is_same(value, "unix") || is_same(value, "tcp")))
+		 menu->link = LINK_UNIX + is_same(value, "tcp");
+	 else if (is_option(arg, "link-delay", &value) && is_number(value)
+		 && ft_atoi(value) <= 1000000)
+		 menu->link_delay = ft_atoi(value);
+	 else
+		 return (false);
+	 return (true);
+ }
+ 
+ /**
+  * @brief Apply one of the options that change who shares what.
+  *
+  * @details
+  * These are `--seats`, `--scenario`, `--graph`, `--drinking`, the
+  * `--seed` of its draws, `--tables`, `--processes`, `--workers` and `--link`.
+  *
+  * @param menu Menu to fill.
+  * @param arg Option, `--name=value`.
+  * @return `false` if `arg` is not one of them, or has a bad value.
+  *
+  * @ingroup philosopher_core
+  */
+ bool	read_shape(t_menu *menu, const char *arg)
+ {
+	 const char	*value;
+ 
+	 if (is_option(arg, "seats", &value) && is_number(value)
+		 && ft_atoi(value) > 0 && ft_atoi(value) <= MAX_PHILO)
+		 menu->seats = ft_atoi(value);
+	 else if (is_option(arg, "scenario", &value) && value[0])
+		 menu->scenario = value;
+	 else if (is_option(arg, "graph", &value) && value[0])
+		 menu->graph = value;
+	 else if (is_option(arg, "drinking", &value) && is_number(value)
+		 && ft_atoi(value) > 0 && ft_atoi(value) <= 100)
+		 menu->drinking = ft_atoi(value);
+	 else if (is_option(arg, "seed", &value) && is_number(value)
+		 && strlen(value) <= 10 && ft_atoi(value) <= UINT_MAX)
+		 menu->seed = ft_atoi(value);
+	 else if (is_option(arg, "tables", &value) && is_number(value)
+		 && ft_atoi(value) > 0 && ft_atoi(value) <= HOUSE_MAX)
+		 menu->tables = ft_atoi(value);
+	 else if (!read_rooms(menu, arg))
+		 return (false);
+	 return (true);
+ }
+ 
\ No newline at end of file
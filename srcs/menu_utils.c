@@ -0,0 +1,98 @@
+/**
+ * @file menu_utils.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Tests used while reading and applying the command-line options.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+
+ /**
+  * @brief Match `--name=` at the start of an argument.
+  *
+  * @param arg Command-line argument.
+  * @param name Option name without dashes.
+  * @param value Receives the text after `=` on success.
+  * @return `true` if `arg` is the option `name`.
+  *
+  * @ingroup philosopher_core
+  */
+ bool	is_option(const char *arg, const char *name, const char **value)
+ {
+	 arg += 2;
+	 while (*name && *arg == *name)
+	 {
+		 arg++;
+		 name++;
+	 }
+	 if (*name || *arg != '=')
+		 return (false);
+	 *value = arg + 1;
+	 return (true);
+ }
+ 
+ /**
+  * @brief Compare two strings for equality.
+  *
+  * @param a First string.
+  * @param b Second string.
+  * @return `true` if both strings are identical.
+  *
+  * @ingroup philosopher_core
+  */
+ bool	is_same(const char *a, const char *b)
+ {
+	 while (*a && *a == *b)
+	 {
+		 a++;
+		 b++;
+	 }
+	 return (*a == *b);
+ }
+ 
+ /**
+  * @brief Check that a string is a non-empty run of digits.
+  *
+  * @param str String to check.
+  * @return `true` if `str` only holds digits.
+  *
+  * @ingroup philosopher_core
+  */
+ bool	is_number(const char *str)
+ {
+	 if (!*str)
+		 return (false);
+	 while (*str >= '0' && *str <= '9')
+		 str++;
+	 return (*str == '\0');
+ }
+ 
+ /**
+  * @brief Tell whether the selected format logs no event at all.
+  *
+  * @param menu Options of the run.
+  * @return `true` for `--format=none`, `summary` and `json`.
+  *
+  * @ingroup philosopher_core
+  */
+ bool	is_quiet(const t_menu *menu)
+ {
+	 return (menu->format == FORMAT_NONE || menu->format == FORMAT_SUMMARY
+		 || menu->format == FORMAT_JSON);
+ }
+ 
+ /**
+  * @brief Tell whether print locks, fork waits and naps are to be timed.
+  *
+  * @param menu Options of the run.
+  * @return `true` with `--io-stats` or `--report`.
+  *
+  * @ingroup philosopher_core
+  */
+ bool	is_measured(const t_menu *menu)
+ {
+	 return (menu->io_stats || menu->report);
+ }
+ 
\ No newline at end of file
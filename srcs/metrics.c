@@ -0,0 +1,120 @@
+/**
+ * @file metrics.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief The `--metrics` server on a Unix domain socket.
+ *
+ * @details
+ * A thread of its own accepts connections one at a time and answers each
+ * with the current metrics (see metrics_text.c), then closes it. A client
+ * that sends an HTTP `GET` within METRICS_WAIT_MS gets an HTTP/1.0
+ * response, as Prometheus or `curl --unix-socket` expect; one that sends
+ * nothing, or shuts down its writing side, gets the bare text. The server
+ * stops with the dinner.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #define _GNU_SOURCE
+ #include "../include/philo.h"
+ #include <poll.h>
+ #include <sys/socket.h>
+ 
+ /**
+  * @internal
+  * @brief Answer one scrape.
+  *
+  * @param table Pointer to the shared simulation table.
+  * @param client Accepted connection.
+  * @param last Previous scrape, for the rates.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	answer_scrape(t_table *table, int client, t_scrape *last)
+ {
+	 char			request[512];
+	 char			text[METRICS_SIZE];
+	 char			header[128];
+	 struct pollfd	peer;
+	 size_t			size;
+ 
+	 peer = (struct pollfd){.fd = client, .events = POLLIN};
+	 memset(request, 0, sizeof(request));
+	 if (poll(&peer, 1, METRICS_WAIT_MS) > 0)
+		 recv(client, request, sizeof(request) - 1, MSG_DONTWAIT);
+	 size = write_metrics(table, text, sizeof(text), last);
+	 if (!strncmp(request, "GET ", 4))
+	 {
+		 snprintf(header, sizeof(header), "HTTP/1.0 200 OK\r\nContent-Type: "
+			 "text/plain; version=0.0.4\r\nContent-Length: %zu\r\n\r\n", size);
+		 send_all(client, header, strlen(header));
+	 }
+	 send_all(client, text, size);
+ }
+ 
+ /**
+  * @internal
+  * @brief Routine of the metrics server thread.
+  *
+  * @details
+  * Polls the listening socket every METRICS_POLL_MS at most, so that it
+  * notices the end of the dinner.
+  *
+  * @param arg Pointer to the shared simulation table.
+  * @return Always NULL.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	*serve_metrics(void *arg)
+ {
+	 t_table			*table;
+	 struct pollfd	listener;
+	 t_scrape		last;
+	 int				client;
+ 
+	 table = (t_table *)arg;
+	 memset(&last, 0, sizeof(last));
+	 last.at = __atomic_load_n(&table->start_time, __ATOMIC_ACQUIRE);
+	 listener = (struct pollfd){.fd = table->metrics_fd, .events = POLLIN};
+	 while (!__atomic_load_n(&table->end_flag, __ATOMIC_ACQUIRE))
+	 {
+		 if (poll(&listener, 1, METRICS_POLL_MS) <= 0)
+			 continue ;
+		 client = accept4(table->metrics_fd, NULL, NULL, SOCK_CLOEXEC);
+		 if (client == -1)
+			 continue ;
+		 answer_scrape(table, client, &last);
+		 close(client);
+	 }
+	 return (NULL);
+ }
+ 
+ /**
+  * @brief Listen on the `--metrics` socket and start serving it.
+  *
+  * @details
+  * Called before the philosophers are seated; the figures read before that
+  * are all zero.
+  *
+  * @param table Pointer to the table, rules set.
+  *
+  * @note Exits the program if the socket cannot be set up.
+  *
+  * @ingroup philosopher_core
+  */
+ void	open_metrics(t_table *table)
+ {
+	 if (!table->menu.metrics)
+		 return ;
+	 table->metrics_fd = listen_on(table->menu.metrics);
+	 if (table->metrics_fd == -1
+		 || pthread_create(&table->metrics, NULL, serve_metrics, table))
+	 {
+		 ft_putstr_fd(2, "Couldn't serve the metrics\n");
+		 if (table->metrics_fd != -1)
+			 close(table->metrics_fd);
+		 clean_table(table);
+		 exit(EXIT_FAILURE);
+	 }
+ }
+ 
\ No newline at end of file
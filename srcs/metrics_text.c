@@ -0,0 +1,161 @@
+/**
+ * @file metrics_text.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief The Prometheus text exposition served by `--metrics`.
+ *
+ * @details
+ * Every figure is read without a lock: the meal counts and last meals are
+ * stored atomically by their philosophers, and the ledger's counters are
+ * atomic. A scrape costs the dinner nothing but the cache misses of
+ * reading, and the rates are worked out from the previous scrape.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+
+ /**
+  * @internal
+  * @brief Read the current figures of the dinner.
+  *
+  * @param table Pointer to the shared simulation table.
+  * @param scrape Receives the figures.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	read_figures(t_table *table, t_scrape *scrape)
+ {
+	 long long	slack;
+	 int			i;
+ 
+	 scrape->at = get_current_time();
+	 scrape->meals = 0;
+	 scrape->slack_min = LLONG_MAX;
+	 i = -1;
+	 while (++i < table->seat_count)
+	 {
+		 scrape->meals += __atomic_load_n(&table->philo[i].meal_count,
+				 __ATOMIC_RELAXED);
+		 slack = __atomic_load_n(&table->philo[i].last_meal, __ATOMIC_RELAXED);
+		 slack = own_time_to_die(&table->philo[i]) - (scrape->at - slack);
+		 if (slack < scrape->slack_min && __atomic_load_n(&table->philo[i].seat,
+				 __ATOMIC_RELAXED) == SEAT_TAKEN)
+			 scrape->slack_min = slack;
+	 }
+	 scrape->passes = __atomic_load_n(&table->ledger.passes, __ATOMIC_RELAXED);
+	 scrape->contended = __atomic_load_n(&table->ledger.contended,
+			 __ATOMIC_RELAXED);
+	 scrape->queue = __atomic_load_n(&table->ledger.queue, __ATOMIC_RELAXED);
+	 scrape->seated = __atomic_load_n(&table->philosopher_count,
+			 __ATOMIC_RELAXED);
+ }
+ 
+ /**
+  * @internal
+  * @brief Append one metric, with its HELP and TYPE lines.
+  *
+  * @param text Text so far; receives the metric, truncated to `size`.
+  * @param size Size of `text`.
+  * @param about Name, type and help text of the metric.
+  * @param value Its value.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	add_metric(char *text, size_t size, const char **about,
+		 double value)
+ {
+	 size_t	used;
+ 
+	 used = strlen(text);
+	 snprintf(text + used, size - used, "# HELP %s %s\n# TYPE %s %s\n"
+		 "%s %.15g\n", about[0], about[2], about[0], about[1], about[0], value);
+ }
+ 
+ /**
+  * @internal
+  * @brief Append the counters.
+  *
+  * @param text Text so far.
+  * @param size Size of `text`.
+  * @param now Figures of this scrape.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	add_counters(char *text, size_t size, t_scrape *now)
+ {
+	 add_metric(text, size, (const char *[]){"philo_meals_total", "counter",
+		 "Meals eaten since the start."}, now->meals);
+	 add_metric(text, size, (const char *[]){"philo_deaths_total", "counter",
+		 "Philosophers who died."}, now->deaths);
+	 add_metric(text, size, (const char *[]){"philo_monitor_passes_total",
+		 "counter", "Passes of the monitor over the table."}, now->passes);
+	 add_metric(text, size, (const char *[]){"philo_lock_contended_total",
+		 "counter", "Fork and print locks found taken."}, now->contended);
+ }
+ 
+ /**
+  * @internal
+  * @brief Append the gauges, rates since the previous scrape included.
+  *
+  * @param text Text so far.
+  * @param size Size of `text`.
+  * @param now Figures of this scrape.
+  * @param last Figures of the previous scrape.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	add_gauges(char *text, size_t size, t_scrape *now, t_scrape *last)
+ {
+	 double	seconds;
+ 
+	 seconds = (now->at - last->at) / 1e3;
+	 if (seconds <= 0)
+		 seconds = 1e-3;
+	 add_metric(text, size, (const char *[]){"philo_meals_per_second",
+		 "gauge", "Meals per second since the previous scrape."},
+		 (now->meals - last->meals) / seconds);
+	 add_metric(text, size, (const char *[]){"philo_monitor_passes_per_second",
+		 "gauge", "Monitor passes per second since the previous scrape."},
+		 (now->passes - last->passes) / seconds);
+	 add_metric(text, size, (const char *[]){"philo_slack_min_ms", "gauge",
+		 "Smallest margin to time_to_die right now."}, now->slack_min);
+	 add_metric(text, size, (const char *[]){"philo_print_queue", "gauge",
+		 "Threads asking for or holding the print lock."}, now->queue);
+	 add_metric(text, size, (const char *[]){"philo_seated", "gauge",
+		 "Philosophers at the table."}, now->seated);
+ }
+ 
+ /**
+  * @brief Write the metrics of the dinner in Prometheus text format.
+  *
+  * @details
+  * Rates cover the time since `last`, which then becomes this scrape.
+  *
+  * @param table Pointer to the shared simulation table.
+  * @param text Buffer to write to.
+  * @param size Size of `text`; what does not fit is dropped.
+  * @param last Previous scrape, or the start of the dinner.
+  * @return Length of the text.
+  *
+  * @ingroup philosopher_core
+  */
+ size_t	write_metrics(t_table *table, char *text, size_t size, t_scrape *last)
+ {
+	 t_scrape	now;
+	 const char	*closing;
+ 
+	 read_figures(table, &now);
+	 closing = __atomic_load_n(&table->closing, __ATOMIC_ACQUIRE);
+	 now.deaths = closing && trace_kind(closing) == TRACE_DIE;
+	 text[0] = '\0';
+	 add_counters(text, size, &now);
+	 add_gauges(text, size, &now, last);
+	 add_metric(text, size, (const char *[]){"philo_uptime_seconds", "gauge",
+		 "Time since the dinner started."},
+		 (now.at - __atomic_load_n(&table->start_time, __ATOMIC_ACQUIRE))
+		 / 1e3);
+	 *last = now;
+	 return (strlen(text));
+ }
+ 
\ No newline at end of file
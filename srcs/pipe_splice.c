@@ -0,0 +1,82 @@
+/**
+ * @file pipe_splice.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Zero-copy tray output into a pipe for `--writer=splice`.
+ *
+ * @details
+ * `vmsplice` with SPLICE_F_GIFT hands the tray's pages to the pipe instead
+ * of copying them into it, so the only copy left is the reader's. The pipe
+ * then refers to the tray itself, which must not be loaded again before
+ * the reader is done with it. The pipe is sized to half the trays, and
+ * trays are loaded in turn, so a tray comes back only after TRAY_COUNT - 1
+ * others have been spliced behind it, more than the pipe can hold: by
+ * then the reader has taken all of its pages.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #define _GNU_SOURCE
+ #include "../include/philo.h"
+ #include <fcntl.h>
+ #include <sys/stat.h>
+ #include <sys/uio.h>
+ 
+ /**
+  * @brief Check that stdout is a pipe, and size it for splicing.
+  *
+  * @param dumbwaiter Dumbwaiter whose `piped` flag is set on success.
+  * @return 0 if the trays can be spliced, -1 if stdout is not a pipe or
+  * cannot be resized.
+  *
+  * @ingroup philosopher_core
+  */
+ int	open_pipe_sink(t_dumbwaiter *dumbwaiter)
+ {
+	 struct stat	status;
+ 
+	 if (fstat(STDOUT_FILENO, &status) == -1 || !S_ISFIFO(status.st_mode))
+		 return (-1);
+	 if (fcntl(STDOUT_FILENO, F_SETPIPE_SZ, SPLICE_PIPE_SIZE) == -1
+		 && fcntl(STDOUT_FILENO, F_GETPIPE_SZ) > SPLICE_PIPE_SIZE)
+		 return (-1);
+	 dumbwaiter->piped = true;
+	 return (0);
+ }
+ 
+ /**
+  * @brief Splice the loading tray into the pipe, and load the next one.
+  *
+  * @details
+  * Blocks like `write` while the pipe is full.
+  *
+  * @param dumbwaiter Dumbwaiter with `piped` set.
+  *
+  * @note Exits the program if the pipe refuses the pages.
+  *
+  * @ingroup philosopher_core
+  */
+ void	splice_tray(t_dumbwaiter *dumbwaiter)
+ {
+	 struct iovec	iov;
+	 ssize_t			sent;
+ 
+	 iov.iov_base = dumbwaiter->trays + dumbwaiter->loading * TRAY_SIZE;
+	 iov.iov_len = dumbwaiter->filled;
+	 while (iov.iov_len > 0)
+	 {
+		 sent = vmsplice(STDOUT_FILENO, &iov, 1, SPLICE_F_GIFT);
+		 if (sent == -1 && errno == EINTR)
+			 continue ;
+		 if (sent == -1)
+		 {
+			 ft_putstr_fd(2, "Error: couldn't splice the log\n");
+			 exit(EXIT_FAILURE);
+		 }
+		 iov.iov_base = (char *)iov.iov_base + sent;
+		 iov.iov_len -= sent;
+	 }
+	 dumbwaiter->loading = (dumbwaiter->loading + 1) % TRAY_COUNT;
+	 dumbwaiter->filled = 0;
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,171 @@
+/**
+ * @file porters.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Porters keeping the border forks of a `--link` dinner.
+ *
+ * @details
+ * Each worker of a `--link` dinner runs a porter thread for the border
+ * fork its wing keeps, its first philosopher's left fork. The porter
+ * takes the fork's lock on behalf of the philosopher across the border
+ * when it is asked for, grants it, and unlocks it when it comes back,
+ * so that the fork is taken in the same order as any other and the
+ * ring stays free of deadlock.
+ *
+ * Slips are batched: the porter reads every slip that has arrived in one
+ * call, often the return of one meal with the ask for the next, and acts
+ * on them in order, granting an ask as soon as the fork is taken. Each
+ * slip is held until `--link-delay` after it was sent before it is acted
+ * on, which puts the latency of the link on every slip, in both
+ * directions, without adding up over slips in flight together.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+
+ /**
+  * @brief Hold a slip until it would have crossed the link.
+  *
+  * @param slip Slip received.
+  * @param delay `--link-delay` (us), 0 for none.
+  *
+  * @ingroup philosopher_core
+  */
+ void	hold_slip(const t_slip *slip, int delay)
+ {
+	 struct timespec	due;
+	 long long		at;
+ 
+	 if (delay <= 0)
+		 return ;
+	 at = slip->sent + delay * 1000LL;
+	 due = (struct timespec){at / 1000000000LL, at % 1000000000LL};
+	 clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &due, NULL);
+ }
+ 
+ /**
+  * @internal
+  * @brief Act on one slip about the fork a porter keeps.
+  *
+  * @details
+  * A return unlocks the fork; an ask takes it, as any philosopher would,
+  * and grants it across the border.
+  *
+  * @param first First philosopher of the wing, whose left fork is kept.
+  * @param slip Slip received.
+  * @return Whether the fork is granted across the border afterwards.
+  *
+  * @ingroup philosopher_core
+  */
+ static bool	serve_slip(t_philo *first, const t_slip *slip)
+ {
+	 pthread_mutex_t	*fork;
+ 
+	 fork = &first->table->fork_padlock[first->left_fork];
+	 hold_slip(slip, first->table->menu.link_delay);
+	 if (slip->kind == SLIP_RETURN)
+	 {
+		 pthread_mutex_unlock(fork);
+		 return (false);
+	 }
+	 take_padlock(first->table, fork);
+	 send_slip(first->table->links[2 * first->left_fork], SLIP_GRANT,
+		 first->left_fork);
+	 return (true);
+ }
+ 
+ /**
+  * @internal
+  * @brief Keep a border fork until the link is hung up.
+  *
+  * @details
+  * A fork still granted when the link breaks is unlocked: the wing that
+  * had it is gone.
+  *
+  * @param arg First philosopher of the wing (`t_philo *`).
+  * @return NULL.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	*serve_border(void *arg)
+ {
+	 t_philo	*first;
+	 t_slip	slips[SLIP_BATCH];
+	 bool	granted;
+	 int		count;
+	 int		i;
+ 
+	 first = arg;
+	 granted = false;
+	 count = read_slips(first->table->links[2 * first->left_fork], slips,
+			 SLIP_BATCH);
+	 while (count > 0)
+	 {
+		 i = -1;
+		 while (++i < count)
+			 granted = serve_slip(first, &slips[i]);
+		 count = read_slips(first->table->links[2 * first->left_fork], slips,
+				 SLIP_BATCH);
+	 }
+	 if (granted)
+		 pthread_mutex_unlock(&first->table->fork_padlock[first->left_fork]);
+	 return (NULL);
+ }
+ 
+ /**
+  * @brief Start the porter of a wing, in its worker process.
+  *
+  * @details
+  * Closes every link end but the wing's two first: its porter's, and
+  * that of its last philosopher.
+  *
+  * @param first First philosopher of the wing.
+  * @param last Last philosopher of the wing.
+  * @param porter Receives the porter thread.
+  * @return `true` if a porter was started, `false` without `--link` or if
+  * it could not be.
+  *
+  * @ingroup philosopher_core
+  */
+ bool	open_porter(t_philo *first, t_philo *last, pthread_t *porter)
+ {
+	 t_table	*table;
+ 
+	 table = first->table;
+	 if (!table->links)
+		 return (false);
+	 close_links(table, table->links[2 * first->left_fork],
+		 table->links[2 * last->right_fork + 1]);
+	 if (pthread_create(porter, NULL, serve_border, first) == 0)
+		 return (true);
+	 ft_putstr_fd(2, "Couldn't seat the porter\n");
+	 return (false);
+ }
+ 
+ /**
+  * @brief Hang up a wing's link, then wait for its porter.
+  *
+  * @details
+  * Called once the wing's philosophers are done: the next wing's porter
+  * sees the hang-up, and this wing's porter ends once the wing before
+  * hangs up too.
+  *
+  * @param last Last philosopher of the wing.
+  * @param porter Porter thread from `open_porter`.
+  * @param served Whether `open_porter` started it.
+  *
+  * @ingroup philosopher_core
+  */
+ void	close_porter(t_philo *last, pthread_t porter, bool served)
+ {
+	 t_table	*table;
+ 
+	 table = last->table;
+	 if (!table->links)
+		 return ;
+	 close(table->links[2 * last->right_fork + 1]);
+	 if (served)
+		 pthread_join(porter, NULL);
+ }
+ 
\ No newline at end of file
@@ -24,10 +24,12 @@
   *
   * @param value The parsed integer value.
   * @param i The index of the argument being checked (1-based).
+  * @param menu Selected options; `--run-for` also accepts zero
+  * `time_to_eat` and `time_to_sleep`.
   *
   * @ingroup philosopher_core
   */
- static void	check_value(long long value, int i)
+ static void	check_value(long long value, int i, t_menu *menu)
  {
 	 if (value == -1)
 	 {
@@ -37,7 +39,7 @@
 	 if ((i == 1) && (value <= 0 || value > MAX_PHILO))
 	 {
 		 ft_putstr_fd(2, "Error: <number_of_philosophers> ");
-		 ft_putstr_fd(2, "must be between 1 and 200\n");
+		 ft_putstr_fd(2, "must be between 1 and " TO_STRING(MAX_PHILO) "\n");
 		 exit(EXIT_FAILURE);
 	 }
 	 if ((i == 5) && (value <= 0))
@@ -46,10 +48,11 @@
 		 ft_putstr_fd(2, "must be an integer greater than 0\n");
 		 exit(EXIT_FAILURE);
 	 }
+	 if (menu->run_for && (i == 3 || i == 4) && value == 0)
+		 return ;
 	 if ((i > 1 && i < 5) && (value < 1))
 	 {
-		 ft_putstr_fd(2, "Error: ");
-		 ft_putstr_fd(2, "<time_to_die> <time_to_eat> <time_to_sleep> ");
+		 ft_putstr_fd(2, "Error: <time_to_die> <time_to_eat> <time_to_sleep> ");
 		 ft_putstr_fd(2, "must be integers greater than 0\n");
 		 exit(EXIT_FAILURE);
 	 }
@@ -87,10 +90,11 @@
   *
   * @param argc Number of arguments.
   * @param argv Argument array.
+  * @param menu Selected options.
   *
   * @ingroup philosopher_core
   */
- static void	validate_arguments(int argc, char **argv)
+ static void	validate_arguments(int argc, char **argv, t_menu *menu)
  {
 	 int			i;
 	 long long	value;
@@ -100,7 +104,7 @@
 	 {
 		 check_syntax(argv[i]);
 		 value = ft_atoi(argv[i]);
-		 check_value(value, i);
+		 check_value(value, i, menu);
 		 i++;
 	 }
  }
@@ -122,6 +126,7 @@
 		 ft_putstr_fd(2, "./philo <number_of_philosophers> ");
 		 ft_putstr_fd(2, "<time_to_die> <time_to_eat> <time_to_sleep>\n");
 		 ft_putstr_fd(2, " (Opt : <nbr_of_times_each_philosopher_must_eat>)\n");
+		 show_menu(2);
 		 exit(EXIT_FAILURE);
 	 }
  }
@@ -131,16 +136,19 @@
   *
   * @details
   * Ensures proper argument count, numeric format, and range constraints
-  * for each required and optional parameter.
+  * for each required and optional parameter, then that the options go
+  * together (see menu_check.c).
   *
+  * @param menu Options read by `read_menu`.
   * @param argc Number of command-line arguments.
   * @param argv Array of argument strings.
   *
   * @ingroup philosopher_core
   */
- void	receive_guests(int argc, char **argv)
+ void	receive_guests(t_menu *menu, int argc, char **argv)
  {
 	 validate_argument_count(argc);
-	 validate_arguments(argc, argv);
+	 validate_arguments(argc, argv, menu);
+	 check_menu(menu, ft_atoi(argv[1]));
  }
  
\ No newline at end of file
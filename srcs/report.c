@@ -0,0 +1,218 @@
+/**
+ * @file report.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief The `--report` JSON written when the dinner ends.
+ *
+ * @details
+ * `--report=path` writes the report to a file, `--report=fd` to a
+ * descriptor inherited from the caller (`./3` for a file named 3). It is
+ * one JSON object, with one philosopher per line:
+ * - `config`: the arguments and the options that change the dinner
+ * - `start_ms`, `end_ms` (wall clock, ms since the epoch) and
+ *   `runtime_ms` (dinner clock, without `--control` pauses)
+ * - `outcome` and `died`, as with `--format=json`
+ * - `philosophers`: meals, last meal, longest hunger and smallest slack
+ *   to `time_to_die`, fork waits and how far naps overran
+ * - `contended_locks`: fork and print lock acquisitions that had to wait
+ * - `print_lock`: the `--io-stats` print lock figures
+ * - `monitor_min_margin_ms`, and the CPU time and context switches of
+ *   the process (`cpu`) and of its reaped children (`children_cpu`)
+ *
+ * Times are in ms since the start unless their name says otherwise. The
+ * stream is opened before the dinner, together with that of `--samples`,
+ * so a bad path fails straight away.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+
+ /**
+  * @brief Open the `--report` and `--samples` destinations that were given.
+  *
+  * @details
+  * Both take a path, truncated, or the number of an open descriptor.
+  *
+  * @param table Pointer to the configured table.
+  *
+  * @note Exits the program if a path or descriptor cannot be opened.
+  *
+  * @ingroup philosopher_core
+  */
+ void	open_reports(t_table *table)
+ {
+	 const char	*where[2];
+	 FILE		**stream[2];
+	 int			i;
+ 
+	 where[0] = table->menu.report;
+	 where[1] = table->menu.samples;
+	 stream[0] = &table->report;
+	 stream[1] = &table->samples;
+	 i = -1;
+	 while (++i < 2)
+	 {
+		 if (where[i] && is_number(where[i]))
+			 *stream[i] = fdopen(ft_atoi(where[i]), "w");
+		 else if (where[i])
+			 *stream[i] = fopen(where[i], "w");
+		 if (where[i] && !*stream[i])
+		 {
+			 ft_putstr_fd(2, "Couldn't open the report or samples\n");
+			 exit(EXIT_FAILURE);
+		 }
+	 }
+ }
+ 
+ /**
+  * @internal
+  * @brief Write the `config` member.
+  *
+  * @param table Pointer to the shared simulation table.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	print_rules(t_table *table)
+ {
+	 fprintf(table->report, "{\"config\":{\"philosophers\":%d,"
+		 "\"time_to_die_ms\":%d,\"time_to_eat_ms\":%d,"
+		 "\"time_to_sleep_ms\":%d,\"must_eat\":", table->philosopher_count,
+		 table->time_to_die, table->time_to_eat, table->time_to_sleep);
+	 if (table->must_eat_count < 0)
+		 fprintf(table->report, "null");
+	 else
+		 fprintf(table->report, "%d", table->must_eat_count);
+	 fprintf(table->report, ",\"run_for_ms\":%d,\"format\":\"%s\","
+		 "\"writer\":\"%s\",\"scenario\":%s,\"forks\":%d,\"graph\":%s,",
+		 table->menu.run_for, format_name(table->menu.format),
+		 writer_name(table->menu.writer),
+		 bool_name(table->menu.scenario != NULL), table->fork_count,
+		 bool_name(table->menu.graph != NULL));
+	 fprintf(table->report, "\"drinking_pct\":%d,\"seed\":%u,\"table\":%d,"
+		 "\"tables\":%d,\"processes\":%s,\"workers\":%d,\"link\":\"%s\","
+		 "\"link_delay_us\":%d},\n", table->menu.drinking, table->menu.seed,
+		 table->number, table->menu.tables, bool_name(table->menu.processes),
+		 table->menu.workers, link_name(table->menu.link),
+		 table->menu.link_delay);
+ }
+ 
+ /**
+  * @internal
+  * @brief Write one philosopher's line of the `philosophers` array.
+  *
+  * @details
+  * The stretch since the last meal counts as hunger too, up to `end`.
+  * Fork waits and naps are in us. Empty seats are skipped; for
+  * philosophers who left, hunger stops at their last meal.
+  *
+  * @param table Pointer to the shared simulation table.
+  * @param philo Philosopher to write.
+  * @param end When the dinner ended (ms).
+  * @param after Whether it follows another philosopher.
+  * @return Whether a philosopher has been written so far.
+  *
+  * @ingroup philosopher_core
+  */
+ static bool	print_tab(t_table *table, t_philo *philo, long long end,
+	 bool after)
+ {
+	 t_tab		*tab;
+	 long long	hunger;
+ 
+	 if (philo->seat == SEAT_EMPTY)
+		 return (after);
+	 if (philo->seat == SEAT_LEFT)
+		 end = philo->last_meal;
+	 tab = &philo->tab;
+	 hunger = end - philo->last_meal;
+	 if (tab->hunger_max > hunger)
+		 hunger = tab->hunger_max;
+	 if (after)
+		 fprintf(table->report, ",\n");
+	 fprintf(table->report, "{\"id\":%d,\"meals\":%d,\"last_meal_ms\":%lld,"
+		 "\"hunger_max_ms\":%lld,\"slack_min_ms\":%lld,", house_number(philo),
+		 philo->meal_count, philo->last_meal - table->start_time, hunger,
+		 own_time_to_die(philo) - hunger);
+	 fprintf(table->report, "\"fork_wait_avg_us\":%.2f,"
+		 "\"fork_wait_max_us\":%.2f,\"naps\":%lld,\"oversleep_avg_us\":%.2f,"
+		 "\"oversleep_max_us\":%.2f}", average(tab->fork_wait / 1e3,
+			 tab->meals_timed), tab->fork_wait_max / 1e3, tab->naps,
+		 average(tab->oversleep / 1e3, tab->naps), tab->oversleep_max / 1e3);
+	 return (true);
+ }
+ 
+ /**
+  * @internal
+  * @brief Close `philosophers`, and write the lock, monitor margin and
+  * resource usage members.
+  *
+  * @param table Pointer to the shared simulation table.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	print_ledger(t_table *table)
+ {
+	 t_ledger	*ledger;
+ 
+	 ledger = &table->ledger;
+	 fprintf(table->report, "\n],\n\"contended_locks\":%lld,\"reseats\":"
+		 "{\"count\":%lld,\"avg_us\":%.2f,\"max_us\":%.2f},", ledger->contended,
+		 ledger->reseats, average(ledger->reseat_total / 1e3, ledger->reseats),
+		 ledger->reseat_max / 1e3);
+	 fprintf(table->report, "\"print_lock\":{\"uses\":%lld,\"lines\":%lld,"
+		 "\"hold_avg_us\":%.2f,\"hold_max_us\":%.2f,\"wait_avg_us\":%.2f,"
+		 "\"wait_max_us\":%.2f},\n\"monitor_min_margin_ms\":", ledger->uses,
+		 ledger->lines, average(ledger->hold_total / 1e3, ledger->uses),
+		 ledger->hold_max / 1e3, average(ledger->wait_total / 1e3, ledger->uses),
+		 ledger->wait_max / 1e3);
+	 if (ledger->min_margin == LLONG_MAX)
+		 fprintf(table->report, "null");
+	 else
+		 fprintf(table->report, "%lld", ledger->min_margin);
+	 print_usage(table->report);
+ }
+ 
+ /**
+  * @brief Write the `--report` JSON of one table.
+  *
+  * @details
+  * Called once every philosopher thread is joined, by `present_house`,
+  * which closes the stream. The dinner ended when it was closed by a death
+  * or the quotas, otherwise now; `start_ms` and `end_ms` are read from the
+  * wall clock then, so they take in a `--control` pause as `runtime_ms`
+  * does not.
+  *
+  * @param table Pointer to the shared simulation table.
+  *
+  * @ingroup philosopher_core
+  */
+ void	present_report(t_table *table)
+ {
+	 long long	end;
+	 long long	wall;
+	 bool		after;
+	 int			i;
+ 
+	 if (!table->report)
+		 return ;
+	 end = get_current_time();
+	 wall = get_wall_time();
+	 if (table->closing)
+	 {
+		 end = table->closed_at;
+		 wall = table->closed_wall;
+	 }
+	 print_rules(table);
+	 fprintf(table->report, "\"start_ms\":%lld,\"end_ms\":%lld,"
+		 "\"runtime_ms\":%lld,", table->start_wall, wall,
+		 end - table->start_time);
+	 print_outcome(table->report, table);
+	 fprintf(table->report, ",\n\"philosophers\":[\n");
+	 i = -1;
+	 after = false;
+	 while (++i < table->seat_count)
+		 after = print_tab(table, &table->philo[i], end, after);
+	 print_ledger(table);
+ }
+ 
\ No newline at end of file
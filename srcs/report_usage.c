@@ -0,0 +1,54 @@
+/**
+ * @file report_usage.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief The resource usage members of the `--report` JSON.
+ *
+ * @details
+ * With `--processes` or `--workers` the philosophers dine in child
+ * processes, which the process's own usage leaves out: theirs is
+ * reported apart, once they are all reaped, and stays at zero with
+ * threads.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+ #include <sys/resource.h>
+
+ /**
+  * @internal
+  * @brief Write one member of CPU times and context switches.
+  *
+  * @param report Report stream.
+  * @param name Member name.
+  * @param who RUSAGE_SELF or RUSAGE_CHILDREN.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	print_rusage(FILE *report, const char *name, int who)
+ {
+	 struct rusage	usage;
+ 
+	 getrusage(who, &usage);
+	 fprintf(report, ",\"%s\":{\"user_s\":%.3f,\"system_s\":%.3f,"
+		 "\"voluntary_switches\":%ld,\"involuntary_switches\":%ld}", name,
+		 usage.ru_utime.tv_sec + usage.ru_utime.tv_usec / 1e6,
+		 usage.ru_stime.tv_sec + usage.ru_stime.tv_usec / 1e6,
+		 usage.ru_nvcsw, usage.ru_nivcsw);
+ }
+ 
+ /**
+  * @brief Write the `cpu` and `children_cpu` members, closing the report.
+  *
+  * @param report Report stream, every philosopher joined or reaped.
+  *
+  * @ingroup philosopher_core
+  */
+ void	print_usage(FILE *report)
+ {
+	 print_rusage(report, "cpu", RUSAGE_SELF);
+	 print_rusage(report, "children_cpu", RUSAGE_CHILDREN);
+	 fprintf(report, "}\n");
+ }
+ 
\ No newline at end of file
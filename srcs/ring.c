@@ -0,0 +1,169 @@
+/**
+ * @file ring.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Raw io_uring setup for the `--writer=uring` backend.
+ *
+ * @details
+ * No liburing: the instance is created, mapped and given its buffers with
+ * the `io_uring_setup`, `mmap` and `io_uring_register` system calls.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+ #include <sys/mman.h>
+ #include <sys/syscall.h>
+ #include <sys/uio.h>
+
+ /**
+  * @internal
+  * @brief Map the submission ring, completion ring and submission entries.
+  *
+  * @details
+  * Kernels with IORING_FEAT_SINGLE_MMAP share one mapping for both rings;
+  * it is then mapped once, at the larger of the two sizes.
+  *
+  * @param ring Ring with its `fd` set; receives the mappings.
+  * @param params Parameters filled in by `io_uring_setup`.
+  * @return 0 on success, -1 on failure.
+  *
+  * @ingroup philosopher_core
+  */
+ static int	map_ring(t_ring *ring, struct io_uring_params *params)
+ {
+	 ring->entries = params->sq_entries;
+	 ring->sq_size = params->sq_off.array + ring->entries * sizeof(int);
+	 ring->cq_size = params->cq_off.cqes
+		 + params->cq_entries * sizeof(struct io_uring_cqe);
+	 if ((params->features & IORING_FEAT_SINGLE_MMAP)
+		 && ring->cq_size > ring->sq_size)
+		 ring->sq_size = ring->cq_size;
+	 ring->sq_map = mmap(NULL, ring->sq_size, PROT_READ | PROT_WRITE,
+			 MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+	 if (ring->sq_map == MAP_FAILED)
+		 return (-1);
+	 ring->cq_map = ring->sq_map;
+	 if (!(params->features & IORING_FEAT_SINGLE_MMAP))
+		 ring->cq_map = mmap(NULL, ring->cq_size, PROT_READ | PROT_WRITE,
+				 MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING);
+	 ring->sqes = mmap(NULL, ring->entries * sizeof(struct io_uring_sqe),
+			 PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd,
+			 IORING_OFF_SQES);
+	 if (ring->cq_map == MAP_FAILED || ring->sqes == MAP_FAILED)
+		 return (-1);
+	 return (0);
+ }
+ 
+ /**
+  * @internal
+  * @brief Locate the ring fields the backend uses inside the mappings.
+  *
+  * @param ring Mapped ring.
+  * @param params Parameters filled in by `io_uring_setup`.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	find_queues(t_ring *ring, struct io_uring_params *params)
+ {
+	 char	*sq;
+	 char	*cq;
+ 
+	 sq = ring->sq_map;
+	 cq = ring->cq_map;
+	 ring->sq_tail = (unsigned int *)(sq + params->sq_off.tail);
+	 ring->sq_mask = *(unsigned int *)(sq + params->sq_off.ring_mask);
+	 ring->sq_array = (unsigned int *)(sq + params->sq_off.array);
+	 ring->cq_head = (unsigned int *)(cq + params->cq_off.head);
+	 ring->cq_tail = (unsigned int *)(cq + params->cq_off.tail);
+	 ring->cq_mask = *(unsigned int *)(cq + params->cq_off.ring_mask);
+	 ring->cqes = (struct io_uring_cqe *)(cq + params->cq_off.cqes);
+ }
+ 
+ /**
+  * @internal
+  * @brief Register the trays as the ring's fixed buffers.
+  *
+  * @details
+  * Registered buffers stay mapped in the kernel, which spares it from
+  * pinning the pages again for every write. Tray `i` is buffer `i`.
+  *
+  * @param ring Open ring.
+  * @param trays TRAY_COUNT trays of TRAY_SIZE bytes.
+  * @return 0 on success, -1 on failure.
+  *
+  * @ingroup philosopher_core
+  */
+ static int	register_trays(t_ring *ring, char *trays)
+ {
+	 struct iovec	iov[TRAY_COUNT];
+	 int				i;
+ 
+	 i = -1;
+	 while (++i < TRAY_COUNT)
+	 {
+		 iov[i].iov_base = trays + i * TRAY_SIZE;
+		 iov[i].iov_len = TRAY_SIZE;
+	 }
+	 if (syscall(__NR_io_uring_register, ring->fd, IORING_REGISTER_BUFFERS,
+			 iov, TRAY_COUNT) < 0)
+		 return (-1);
+	 return (0);
+ }
+ 
+ /**
+  * @brief Create an io_uring instance and register the trays with it.
+  *
+  * @details
+  * Any failure, such as a kernel built without io_uring or a sandbox
+  * forbidding it, leaves the ring closed.
+  *
+  * @param ring Ring to open.
+  * @param trays TRAY_COUNT trays of TRAY_SIZE bytes.
+  * @return 0 on success, -1 on failure.
+  *
+  * @ingroup philosopher_core
+  */
+ int	open_ring(t_ring *ring, char *trays)
+ {
+	 struct io_uring_params	params;
+ 
+	 memset(ring, 0, sizeof(*ring));
+	 memset(&params, 0, sizeof(params));
+	 ring->fd = syscall(__NR_io_uring_setup, TRAY_COUNT, &params);
+	 if (ring->fd < 0)
+	 {
+		 ring->fd = -1;
+		 return (-1);
+	 }
+	 if (map_ring(ring, &params) == -1 || register_trays(ring, trays) == -1)
+	 {
+		 close_ring(ring);
+		 return (-1);
+	 }
+	 find_queues(ring, &params);
+	 return (0);
+ }
+ 
+ /**
+  * @brief Unmap and close a ring, opened or not.
+  *
+  * @param ring Ring to close; its `fd` becomes -1.
+  *
+  * @ingroup philosopher_core
+  */
+ void	close_ring(t_ring *ring)
+ {
+	 if (ring->sqes && ring->sqes != MAP_FAILED)
+		 munmap(ring->sqes, ring->entries * sizeof(struct io_uring_sqe));
+	 if (ring->cq_map && ring->cq_map != MAP_FAILED
+		 && ring->cq_map != ring->sq_map)
+		 munmap(ring->cq_map, ring->cq_size);
+	 if (ring->sq_map && ring->sq_map != MAP_FAILED)
+		 munmap(ring->sq_map, ring->sq_size);
+	 if (ring->fd != -1)
+		 close(ring->fd);
+	 memset(ring, 0, sizeof(*ring));
+	 ring->fd = -1;
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,187 @@
+/**
+ * @file ring_trays.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Asynchronous tray writes through io_uring.
+ *
+ * @details
+ * Whenever no write is in flight, every busy tray is submitted as one
+ * chain of linked fixed-buffer writes at the current stdout position, so
+ * the kernel runs them one after the other and the trays reach stdout in
+ * order. A short write, common on a pipe that fills up, severs the chain:
+ * the writes after it are cancelled, and the next chain resumes where the
+ * short one stopped. Nobody waits for the writes; the loading thread only
+ * blocks when every tray is still on its way down.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+ #include <sys/syscall.h>
+
+ /**
+  * @brief Mark the tray being loaded as busy, and move to the next one.
+  *
+  * @param dumbwaiter Dumbwaiter whose loading tray is full.
+  *
+  * @ingroup philosopher_core
+  */
+ void	queue_tray(t_dumbwaiter *dumbwaiter)
+ {
+	 dumbwaiter->sizes[dumbwaiter->loading] = dumbwaiter->filled;
+	 dumbwaiter->busy++;
+	 dumbwaiter->loading = (dumbwaiter->loading + 1) % TRAY_COUNT;
+	 dumbwaiter->filled = 0;
+ }
+ 
+ /**
+  * @internal
+  * @brief Add the write of one busy tray to the submission queue.
+  *
+  * @param dumbwaiter Dumbwaiter owning the tray.
+  * @param i Position of the tray among the busy ones, 0 for `oldest`.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	prepare_write(t_dumbwaiter *dumbwaiter, int i)
+ {
+	 t_ring				*ring;
+	 struct io_uring_sqe	*sqe;
+	 unsigned int		tail;
+	 int					tray;
+	 int					skip;
+ 
+	 ring = &dumbwaiter->ring;
+	 tail = *ring->sq_tail;
+	 tray = (dumbwaiter->oldest + i) % TRAY_COUNT;
+	 skip = 0;
+	 if (i == 0)
+		 skip = dumbwaiter->resume;
+	 sqe = &ring->sqes[tail & ring->sq_mask];
+	 memset(sqe, 0, sizeof(*sqe));
+	 sqe->opcode = IORING_OP_WRITE_FIXED;
+	 sqe->fd = STDOUT_FILENO;
+	 sqe->addr = (unsigned long)(dumbwaiter->trays + tray * TRAY_SIZE + skip);
+	 sqe->len = dumbwaiter->sizes[tray] - skip;
+	 sqe->off = (__u64)-1;
+	 sqe->buf_index = tray;
+	 if (i < dumbwaiter->busy - 1)
+		 sqe->flags = IOSQE_IO_LINK;
+	 ring->sq_array[tail & ring->sq_mask] = tail & ring->sq_mask;
+	 __atomic_store_n(ring->sq_tail, tail + 1, __ATOMIC_RELEASE);
+ }
+ 
+ /**
+  * @brief Hand every busy tray to the kernel, if no chain is in flight.
+  *
+  * @details
+  * Does not wait for the writes.
+  *
+  * @param dumbwaiter Dumbwaiter to submit.
+  *
+  * @ingroup philosopher_core
+  */
+ void	submit_trays(t_dumbwaiter *dumbwaiter)
+ {
+	 long	sent;
+	 int		i;
+ 
+	 if (dumbwaiter->flying > 0 || dumbwaiter->busy == 0)
+		 return ;
+	 i = -1;
+	 while (++i < dumbwaiter->busy)
+		 prepare_write(dumbwaiter, i);
+	 i = 0;
+	 while (i < dumbwaiter->busy)
+	 {
+		 sent = syscall(__NR_io_uring_enter, dumbwaiter->ring.fd,
+				 dumbwaiter->busy - i, 0, 0, NULL, 0);
+		 if (sent > 0)
+			 i += sent;
+		 else if (sent == -1 && errno != EINTR && errno != EAGAIN)
+		 {
+			 ft_putstr_fd(2, "Error: io_uring_enter failed\n");
+			 exit(EXIT_FAILURE);
+		 }
+	 }
+	 dumbwaiter->flying = dumbwaiter->busy;
+	 dumbwaiter->severed = false;
+ }
+ 
+ /**
+  * @internal
+  * @brief Account for the completion of one write of the chain.
+  *
+  * @details
+  * A complete write frees its tray. A short or cancelled one keeps the
+  * tray busy, with any written bytes skipped, and severs the chain; the
+  * writes after it leave their trays busy too, for the next chain. The
+  * kernel may cancel the rest of a chain even after a write it finished
+  * in several steps, so a cancellation is never taken for an error.
+  *
+  * @param dumbwaiter Dumbwaiter owning the chain.
+  * @param result Bytes written, or a negative error.
+  *
+  * @note Exits the program on write errors other than ECANCELED, EAGAIN
+  * and EINTR.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	settle_write(t_dumbwaiter *dumbwaiter, int result)
+ {
+	 dumbwaiter->flying--;
+	 if (dumbwaiter->severed)
+		 return ;
+	 if (result == dumbwaiter->sizes[dumbwaiter->oldest] - dumbwaiter->resume)
+	 {
+		 dumbwaiter->oldest = (dumbwaiter->oldest + 1) % TRAY_COUNT;
+		 dumbwaiter->busy--;
+		 dumbwaiter->resume = 0;
+		 return ;
+	 }
+	 if (result < 0 && result != -ECANCELED && result != -EAGAIN
+		 && result != -EINTR)
+	 {
+		 ft_putstr_fd(2, "Error: couldn't write the log\n");
+		 exit(EXIT_FAILURE);
+	 }
+	 if (result > 0)
+		 dumbwaiter->resume += result;
+	 dumbwaiter->severed = true;
+ }
+ 
+ /**
+  * @brief Take back the completed writes of the chain in flight.
+  *
+  * @details
+  * Returns once the chain has completed, or as soon as no more than `keep`
+  * trays are busy. Only then does it wait in the kernel; with a `keep` of
+  * TRAY_COUNT it just collects what has already completed.
+  *
+  * @param dumbwaiter Dumbwaiter to collect.
+  * @param keep Number of busy trays that may remain.
+  *
+  * @ingroup philosopher_core
+  */
+ void	collect_trays(t_dumbwaiter *dumbwaiter, int keep)
+ {
+	 t_ring			*ring;
+	 unsigned int	head;
+ 
+	 ring = &dumbwaiter->ring;
+	 head = *ring->cq_head;
+	 while (dumbwaiter->flying > 0)
+	 {
+		 if (head == __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE))
+		 {
+			 if (dumbwaiter->busy <= keep)
+				 return ;
+			 syscall(__NR_io_uring_enter, ring->fd, 0, 1,
+				 IORING_ENTER_GETEVENTS, NULL, 0);
+			 continue ;
+		 }
+		 settle_write(dumbwaiter, ring->cqes[head & ring->cq_mask].res);
+		 __atomic_store_n(ring->cq_head, ++head, __ATOMIC_RELEASE);
+	 }
+ }
+ 
\ No newline at end of file
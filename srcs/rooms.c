@@ -0,0 +1,158 @@
+/**
+ * @file rooms.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Philosophers in processes of their own (`--processes`).
+ *
+ * @details
+ * Each philosopher is forked from the main process once the table is
+ * laid, and runs the same `dinner_routine` as a thread would. Everything
+ * they change during the dinner is in anonymous shared mappings made
+ * before the first fork: the table itself, the seats, the forks and the
+ * bottles, with process-shared robust mutexes (`padlock_kind`). What is
+ * only read, like timings and graph rows, stays in each process's copy
+ * of the heap. The main process is the monitor: it watches `last_meal`
+ * in the shared seats and ends the dinner as usual. With `--workers`,
+ * the philosophers share a few processes instead (see wings.c).
+ *
+ * A philosopher whose process crashes takes nobody down with it: its
+ * forks go to the next philosopher asking for them, and the monitor
+ * reports it dead once it starves. Bottles it held are not given back.
+ *
+ * Output stays in order as stdout is line buffered, each line written
+ * under the print lock. Only text logs and the quiet formats go with
+ * processes, and none of the options that seat, steer or serve the
+ * dinner from threads of the main process (`--seats`, `--control`,
+ * `--metrics`) nor `--tables` (see menu_check.c).
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+ #include <signal.h>
+ #include <sys/mman.h>
+ #include <sys/prctl.h>
+ #include <sys/wait.h>
+
+ /**
+  * @brief Choose where the table is laid.
+  *
+  * @details
+  * Without `--processes`, in the caller's own `room`. With it, in a new
+  * shared mapping that gets the menu of `room`, and stdout becomes line
+  * buffered before anything is written to it.
+  *
+  * @param room Table on the caller's stack, menu read.
+  * @return The table to set up.
+  *
+  * @note Exits the program if the mapping cannot be made.
+  *
+  * @ingroup philosopher_core
+  */
+ t_table	*book_room(t_table *room)
+ {
+	 t_table	*table;
+ 
+	 if (!room->menu.processes)
+		 return (room);
+	 table = share_alloc(&room->menu, sizeof(t_table));
+	 if (!table)
+	 {
+		 ft_putstr_fd(2, "Error: couldn't share the table\n");
+		 exit(EXIT_FAILURE);
+	 }
+	 table->menu = room->menu;
+	 setvbuf(stdout, NULL, _IOLBF, 0);
+	 return (table);
+ }
+ 
+ /**
+  * @brief Allocate zeroed memory the philosophers change while they dine.
+  *
+  * @param menu Options of the dinner.
+  * @param size Bytes to allocate.
+  * @return The memory, shared between processes with `--processes`, or
+  * NULL on failure.
+  *
+  * @ingroup philosopher_core
+  */
+ void	*share_alloc(const t_menu *menu, size_t size)
+ {
+	 void	*memory;
+ 
+	 if (!menu->processes)
+		 return (calloc(1, size + !size));
+	 memory = mmap(NULL, size + !size, PROT_READ | PROT_WRITE,
+			 MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	 if (memory == MAP_FAILED)
+		 return (NULL);
+	 return (memory);
+ }
+ 
+ /**
+  * @brief Release memory from `share_alloc`.
+  *
+  * @param menu Options of the dinner.
+  * @param memory The memory, or NULL.
+  * @param size Size it was allocated with.
+  *
+  * @ingroup philosopher_core
+  */
+ void	share_free(const t_menu *menu, void *memory, size_t size)
+ {
+	 if (!menu->processes)
+		 free(memory);
+	 else if (memory)
+		 munmap(memory, size + !size);
+ }
+ 
+ /**
+  * @brief Start a philosopher, in a thread or a process of its own.
+  *
+  * @details
+  * With `--workers`, the philosopher joins its wing (`open_wing`).
+  * Otherwise stdout is flushed first, so that no process inherits lines
+  * to write again. A philosopher process leaves with `_exit` once its routine
+  * returns, or is killed if the monitor's process dies first.
+  *
+  * @param philo Philosopher to start.
+  * @return 0 on success, nonzero if it could not be started.
+  *
+  * @ingroup philosopher_core
+  */
+ int	start_guest(t_philo *philo)
+ {
+	 pid_t	room;
+ 
+	 if (!philo->table->menu.processes)
+		 return (pthread_create(&philo->thread, NULL, dinner_routine, philo));
+	 if (philo->table->menu.workers)
+		 return (open_wing(philo));
+	 fflush(stdout);
+	 room = fork();
+	 if (room == 0)
+	 {
+		 prctl(PR_SET_PDEATHSIG, SIGKILL);
+		 dinner_routine(philo);
+		 fflush(stdout);
+		 _exit(EXIT_SUCCESS);
+	 }
+	 philo->room = room;
+	 return (room == -1);
+ }
+ 
+ /**
+  * @brief Wait for a philosopher's thread or process to end.
+  *
+  * @param philo Philosopher started by `start_guest`.
+  *
+  * @ingroup philosopher_core
+  */
+ void	wait_guest(t_philo *philo)
+ {
+	 if (!philo->table->menu.processes)
+		 pthread_join(philo->thread, NULL);
+	 else if (philo->room > 0)
+		 waitpid(philo->room, NULL, 0);
+ }
+ 
\ No newline at end of file
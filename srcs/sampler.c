@@ -0,0 +1,181 @@
+/**
+ * @file sampler.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief The `--samples` thread, for long soak runs.
+ *
+ * @details
+ * Every `--sample-every` ms, a thread of its own appends one snapshot of
+ * the dinner to the `--samples` stream, as a CSV row or an NDJSON line:
+ * - `time_ms`: time since the start
+ * - `meals`: meals eaten so far, and `meals_per_s` since the last sample
+ * - `slack_min_ms`: the smallest margin to `time_to_die` right now
+ * - `print_queue`: threads asking for or holding the print lock
+ * - `contended`: fork and print locks found taken so far
+ *
+ * A last sample is taken once the dinner is over, its rate covering
+ * whatever was left of an interval. Every sample is
+ * flushed, so the file can be followed while the dinner goes on. The
+ * philosophers only pay for the atomic counters; the meals and margins
+ * are read under `eat_padlock`, as the monitor does.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+
+ /**
+  * @internal
+  * @brief Work out the meal rate and append one snapshot.
+  *
+  * @param table Pointer to the shared simulation table.
+  * @param sample Time, meals, meals per second (filled in here), smallest
+  * margin, print queue and contended locks, in that order.
+  * @param last Meals and time (ms) of the previous sample; receives those
+  * of this one.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	print_sample(t_table *table, long long sample[6],
+		 long long last[2])
+ {
+	 long long	now;
+ 
+	 now = table->start_time + sample[0];
+	 sample[2] = average((sample[1] - last[0]) * 1000, now - last[1]);
+	 last[0] = sample[1];
+	 last[1] = now;
+	 if (table->menu.sample_format == SAMPLE_CSV)
+		 fprintf(table->samples, "%lld,%lld,%lld,%lld,%lld,%lld\n",
+			 sample[0], sample[1], sample[2], sample[3], sample[4],
+			 sample[5]);
+	 else
+		 fprintf(table->samples, "{\"time_ms\":%lld,\"meals\":%lld,"
+			 "\"meals_per_s\":%lld,\"slack_min_ms\":%lld,"
+			 "\"print_queue\":%lld,\"contended\":%lld}\n", sample[0],
+			 sample[1], sample[2], sample[3], sample[4], sample[5]);
+	 fflush(table->samples);
+ }
+ 
+ /**
+  * @internal
+  * @brief Take a snapshot of the dinner and append it.
+  *
+  * @param table Pointer to the shared simulation table.
+  * @param last Meals and time (ms) of the previous sample.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	take_sample(t_table *table, long long last[2])
+ {
+	 long long	sample[6];
+	 t_philo		*philo;
+	 long long	now;
+	 long long	slack;
+	 int			i;
+ 
+	 now = get_current_time();
+	 sample[1] = 0;
+	 sample[3] = LLONG_MAX;
+	 i = -1;
+	 while (++i < table->seat_count)
+	 {
+		 philo = &table->philo[i];
+		 take_padlock(NULL, &table->eat_padlock);
+		 sample[1] += philo->meal_count;
+		 slack = own_time_to_die(philo) - (now - philo->last_meal);
+		 if (__atomic_load_n(&philo->seat, __ATOMIC_RELAXED) == SEAT_TAKEN
+			 && slack < sample[3])
+			 sample[3] = slack;
+		 pthread_mutex_unlock(&table->eat_padlock);
+	 }
+	 sample[0] = now - table->start_time;
+	 sample[4] = __atomic_load_n(&table->ledger.queue, __ATOMIC_RELAXED);
+	 sample[5] = __atomic_load_n(&table->ledger.contended, __ATOMIC_RELAXED);
+	 print_sample(table, sample, last);
+ }
+ 
+ /**
+  * @internal
+  * @brief Routine of the sampler thread.
+  *
+  * @details
+  * Wakes up every millisecond to check for the end of the dinner, and
+  * samples whenever the next interval is due.
+  *
+  * @param arg Pointer to the shared simulation table.
+  * @return Always NULL.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	*sample_dinner(void *arg)
+ {
+	 t_table		*table;
+	 long long	last[2];
+	 long long	next;
+ 
+	 table = (t_table *)arg;
+	 wait_doors(table);
+	 last[0] = 0;
+	 last[1] = table->start_time;
+	 next = table->start_time + table->menu.sample_every;
+	 while (!__atomic_load_n(&table->end_flag, __ATOMIC_ACQUIRE))
+	 {
+		 if (get_current_time() >= next)
+		 {
+			 take_sample(table, last);
+			 next += table->menu.sample_every;
+		 }
+		 usleep(1000);
+	 }
+	 take_sample(table, last);
+	 return (NULL);
+ }
+ 
+ /**
+  * @brief Write the CSV header and start the sampler, with `--samples`.
+  *
+  * @param table Pointer to the shared simulation table, philosophers seated.
+  *
+  * @note Ends the dinner and exits the program if the thread cannot be
+  * created.
+  *
+  * @ingroup philosopher_core
+  */
+ void	start_sampler(t_table *table)
+ {
+	 if (!table->samples)
+		 return ;
+	 if (table->menu.sample_format == SAMPLE_CSV)
+		 fprintf(table->samples, "time_ms,meals,meals_per_s,slack_min_ms,"
+			 "print_queue,contended\n");
+	 if (pthread_create(&table->sampler, NULL, sample_dinner, table))
+	 {
+		 ft_putstr_fd(2, "Couldn't start the sampler\n");
+		 is_dinner_over(&table->philo[0], true);
+		 end_dinner(table);
+		 exit(EXIT_FAILURE);
+	 }
+	 table->sampling = true;
+ }
+ 
+ /**
+  * @brief Wait for the sampler's last sample and close the stream.
+  *
+  * @details
+  * Called once the dinner is over; does nothing without a sampler.
+  *
+  * @param table Pointer to the shared simulation table.
+  *
+  * @ingroup philosopher_core
+  */
+ void	stop_sampler(t_table *table)
+ {
+	 if (!table->sampling)
+		 return ;
+	 pthread_join(table->sampler, NULL);
+	 fclose(table->samples);
+	 table->samples = NULL;
+	 table->sampling = false;
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,165 @@
+/**
+ * @file scenario.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Timings of their own for some philosophers (`--scenario`).
+ *
+ * @details
+ * A scenario file gives philosophers timings other than those of the
+ * command line, one line per philosopher or range of philosophers:
+ * @code
+ * # ids   die   eat   sleep
+ * 1       800   400   200
+ * 2-4     -     100   -
+ * @endcode
+ * A `-` keeps the table's value, which `--control` may still change;
+ * values of one's own never change. Blank lines and lines starting with
+ * `#` are skipped, and later lines override earlier ones.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+
+ /**
+  * @internal
+  * @brief Read one timing of a scenario line.
+  *
+  * @param word `-`, or a number of ms.
+  * @param least Smallest value allowed.
+  * @param value Receives the value, -1 for `-`.
+  * @return `false` if the word is neither.
+  *
+  * @ingroup philosopher_core
+  */
+ static bool	read_value(const char *word, int least, int *value)
+ {
+	 if (is_same(word, "-"))
+	 {
+		 *value = -1;
+		 return (true);
+	 }
+	 if (!is_number(word) || strlen(word) > 10 || ft_atoi(word) > INT_MAX
+		 || ft_atoi(word) < least)
+		 return (false);
+	 *value = ft_atoi(word);
+	 return (true);
+ }
+ 
+ /**
+  * @internal
+  * @brief Apply one line of the scenario.
+  *
+  * @details
+  * As on the command line, `time_to_die` must be above zero, and so must
+  * the others unless the dinner runs `--run-for`.
+  *
+  * @param table Pointer to the table, philosophers laid.
+  * @param line One line of the file.
+  * @return `false` if the line is malformed or names nobody at the table.
+  *
+  * @ingroup philosopher_core
+  */
+ static bool	read_override(t_table *table, const char *line)
+ {
+	 char		word[4][16];
+	 int			ids[2];
+	 t_timing	own;
+	 char		extra;
+ 
+	 ids[0] = sscanf(line, " %15s %15s %15s %15s %c", word[0], word[1],
+			 word[2], word[3], &extra);
+	 if (ids[0] <= 0 || word[0][0] == '#')
+		 return (true);
+	 if (ids[0] != 4 || !read_value(word[1], 1, &own.time_to_die)
+		 || !read_value(word[2], !table->menu.run_for, &own.time_to_eat)
+		 || !read_value(word[3], !table->menu.run_for, &own.time_to_sleep))
+		 return (false);
+	 if (sscanf(word[0], "%d%c", &ids[1], &extra) == 1)
+		 ids[0] = ids[1];
+	 else if (sscanf(word[0], "%d-%d%c", &ids[0], &ids[1], &extra) != 2)
+		 return (false);
+	 if (ids[0] < 1 || ids[0] > ids[1] || ids[1] > table->philosopher_count)
+		 return (false);
+	 own.previous = NULL;
+	 while (ids[0] <= ids[1])
+		 table->philo[ids[0]++ - 1].own = own;
+	 return (true);
+ }
+ 
+ /**
+  * @brief Give philosophers the timings of the `--scenario` file.
+  *
+  * @details
+  * Called once the philosophers are laid and before any thread starts.
+  * Neighbours are then fixed, so a scenario cannot go with `--seats`
+  * (see menu_check.c).
+  *
+  * @param table Pointer to the table.
+  *
+  * @note Exits the program if the file cannot be read or has a bad line.
+  *
+  * @ingroup philosopher_core
+  */
+ void	load_scenario(t_table *table)
+ {
+	 FILE	*file;
+	 char	line[SCENARIO_LINE];
+	 bool	ok;
+ 
+	 if (!table->menu.scenario)
+		 return ;
+	 file = fopen(table->menu.scenario, "r");
+	 if (!file)
+		 ft_putstr_fd(2, "Error: couldn't read the scenario\n");
+	 ok = (file != NULL);
+	 while (ok && fgets(line, sizeof(line), file))
+		 ok = read_override(table, line);
+	 if (file && !ok)
+	 {
+		 ft_putstr_fd(2, "Error: bad scenario line: ");
+		 ft_putstr_fd(2, line);
+	 }
+	 if (file)
+		 fclose(file);
+	 if (ok)
+		 return ;
+	 clean_table(table);
+	 exit(EXIT_FAILURE);
+ }
+ 
+ /**
+  * @brief Get the timings a philosopher goes by.
+  *
+  * @param philo Philosopher.
+  * @param timing Receives the current version, with the philosopher's own
+  * values in place.
+  *
+  * @ingroup philosopher_core
+  */
+ void	own_timing(t_philo *philo, t_timing *timing)
+ {
+	 *timing = *read_timing(philo->table);
+	 if (philo->own.time_to_die >= 0)
+		 timing->time_to_die = philo->own.time_to_die;
+	 if (philo->own.time_to_eat >= 0)
+		 timing->time_to_eat = philo->own.time_to_eat;
+	 if (philo->own.time_to_sleep >= 0)
+		 timing->time_to_sleep = philo->own.time_to_sleep;
+ }
+ 
+ /**
+  * @brief Get how long a philosopher may go without eating.
+  *
+  * @param philo Philosopher.
+  * @return Its own `time_to_die`, or the table's (ms).
+  *
+  * @ingroup philosopher_core
+  */
+ int	own_time_to_die(t_philo *philo)
+ {
+	 if (philo->own.time_to_die >= 0)
+		 return (philo->own.time_to_die);
+	 return (read_timing(philo->table)->time_to_die);
+ }
+ 
\ No newline at end of file
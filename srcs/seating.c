@@ -0,0 +1,198 @@
+/**
+ * @file seating.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Philosophers joining and leaving a running dinner (`--seats`).
+ *
+ * @details
+ * Every seat owns one fork, its left one; a philosopher's right fork is
+ * the left fork of the next one round the ring. Seating a guest to the
+ * right of a philosopher gives that philosopher the guest's fork as its
+ * right one, and the guest the fork it had; sending a guest away gives
+ * the philosopher on its left the guest's right fork. So only the
+ * philosopher on the left is re-linked, and only while it holds no
+ * fork, like the guest who leaves.
+ *
+ * A philosopher is parked with a ticket, the time the change began, in
+ * `hold`: the change waits for its meal in progress, if any, and it does
+ * not take its forks again, nor go past its next phase boundary
+ * (`next_phase`), until `hold` is cleared (see ushers.c). Seats are
+ * never taken twice, so `--seats` bounds how many may ever sit down.
+ * Forks are taken lowest index first, as no parity rule survives
+ * re-linking.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+
+ /**
+  * @internal
+  * @brief Find a seat.
+  *
+  * @param table Pointer to the shared simulation table.
+  * @param id Philosopher ID, unless SEAT_ANYONE is set.
+  * @param seat SEAT_* state the seat must be in, with SEAT_ANYONE for
+  * whoever sits there.
+  * @param fork Right fork the philosopher must have, or -1 for any.
+  * @return The first seat that matches, or NULL.
+  *
+  * @ingroup philosopher_core
+  */
+ static t_philo	*find_seat(t_table *table, long long id, int seat, int fork)
+ {
+	 t_philo	*philo;
+	 int		i;
+ 
+	 i = -1;
+	 while (++i < table->seat_count)
+	 {
+		 philo = &table->philo[i];
+		 if (philo->seat == (seat & ~SEAT_ANYONE)
+			 && ((seat & SEAT_ANYONE) || philo->id == id)
+			 && (fork < 0 || philo->right_fork == fork))
+			 return (philo);
+	 }
+	 return (NULL);
+ }
+ 
+ /**
+  * @internal
+  * @brief Let two parked philosophers go, and time the change.
+  *
+  * @param table Pointer to the shared simulation table.
+  * @param a One philosopher.
+  * @param b The other one.
+  * @param began When the change began (`get_precise_time`).
+  * @return How long the change took (us).
+  *
+  * @ingroup philosopher_core
+  */
+ static long long	settle(t_table *table, t_philo *a, t_philo *b,
+	 long long began)
+ {
+	 long long	took;
+ 
+	 __atomic_store_n(&a->hold, 0, __ATOMIC_RELEASE);
+	 __atomic_store_n(&b->hold, 0, __ATOMIC_RELEASE);
+	 took = get_precise_time() - began;
+	 table->ledger.reseats++;
+	 table->ledger.reseat_total += took;
+	 if (took > table->ledger.reseat_max)
+		 table->ledger.reseat_max = took;
+	 return (took / 1000);
+ }
+ 
+ /**
+  * @internal
+  * @brief Move a philosopher in or out of its seat, under `eat_padlock`.
+  *
+  * @details
+  * One who sits down is counted as just fed, so that the monitor does not
+  * hold the wait for its seat against it.
+  *
+  * @param table Pointer to the shared simulation table.
+  * @param philo Philosopher.
+  * @param seat SEAT_TAKEN or SEAT_LEFT.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	move_seat(t_table *table, t_philo *philo, int seat)
+ {
+	 take_padlock(NULL, &table->eat_padlock);
+	 if (seat == SEAT_TAKEN)
+		 __atomic_store_n(&philo->last_meal, get_current_time(),
+			 __ATOMIC_RELAXED);
+	 __atomic_store_n(&philo->seat, seat, __ATOMIC_RELEASE);
+	 if (seat == SEAT_TAKEN)
+		 __atomic_add_fetch(&table->philosopher_count, 1, __ATOMIC_RELAXED);
+	 else
+		 __atomic_sub_fetch(&table->philosopher_count, 1, __ATOMIC_RELAXED);
+	 pthread_mutex_unlock(&table->eat_padlock);
+ }
+ 
+ /**
+  * @brief Seat a new philosopher to the right of another one.
+  *
+  * @details
+  * The guest's thread starts first, parked at its first boundary until it
+  * is linked in, as every empty seat is put on hold from the start. It
+  * sits down with a full stomach, so its hungrier neighbours eat first
+  * (see ushers.c). Should the dinner end meanwhile, the seat counts as
+  * left, so that the thread is joined.
+  *
+  * @param table Pointer to the shared simulation table.
+  * @param after ID of the philosopher on the guest's left, from 1.
+  * @param reply Receives the answer, CONTROL_LINE bytes at most.
+  *
+  * @ingroup philosopher_core
+  */
+ void	seat_guest(t_table *table, int after, char *reply)
+ {
+	 t_philo		*left;
+	 t_philo		*guest;
+	 long long	began;
+ 
+	 snprintf(reply, CONTROL_LINE, "error: could not seat a guest\n");
+	 if (after < 1)
+		 return ;
+	 began = get_precise_time();
+	 left = find_seat(table, after, SEAT_TAKEN, -1);
+	 guest = find_seat(table, 0, SEAT_EMPTY | SEAT_ANYONE, -1);
+	 if (!table->menu.seats || !left || !guest
+		 || pthread_create(&guest->thread, NULL, dinner_routine, guest))
+		 return ;
+	 if (!park(left, began))
+	 {
+		 __atomic_store_n(&guest->seat, SEAT_LEFT, __ATOMIC_RELEASE);
+		 return ;
+	 }
+	 guest->right_fork = left->right_fork;
+	 __atomic_store_n(&left->right_fork, guest->left_fork, __ATOMIC_RELAXED);
+	 move_seat(table, guest, SEAT_TAKEN);
+	 snprintf(reply, CONTROL_LINE, "ok %d seated right of %d in %lld us\n",
+		 guest->id, left->id, settle(table, left, guest, began));
+ }
+ 
+ /**
+  * @brief Send a philosopher away from the table.
+  *
+  * @details
+  * Its thread ends at its next boundary. Two philosophers always stay, so
+  * that nobody is left with one fork.
+  *
+  * @param table Pointer to the shared simulation table.
+  * @param id ID of the philosopher leaving, from 1.
+  * @param reply Receives the answer, CONTROL_LINE bytes at most.
+  *
+  * @ingroup philosopher_core
+  */
+ void	unseat_guest(t_table *table, int id, char *reply)
+ {
+	 t_philo		*left;
+	 t_philo		*guest;
+	 long long	began;
+ 
+	 snprintf(reply, CONTROL_LINE, "error: no such philosopher, or two\n");
+	 if (id < 1)
+		 return ;
+	 began = get_precise_time();
+	 guest = find_seat(table, id, SEAT_TAKEN, -1);
+	 left = NULL;
+	 if (guest)
+		 left = find_seat(table, 0, SEAT_TAKEN | SEAT_ANYONE,
+				 guest->left_fork);
+	 if (!table->menu.seats || !left || table->philosopher_count <= 2)
+		 return ;
+	 if (!park(guest, began) || !park(left, began))
+	 {
+		 snprintf(reply, CONTROL_LINE, "error: the dinner is over\n");
+		 return ;
+	 }
+	 __atomic_store_n(&left->right_fork, guest->right_fork,
+		 __ATOMIC_RELAXED);
+	 move_seat(table, guest, SEAT_LEFT);
+	 snprintf(reply, CONTROL_LINE, "ok %d left in %lld us\n", guest->id,
+		 settle(table, left, guest, began));
+ }
+ 
\ No newline at end of file
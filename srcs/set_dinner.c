@@ -10,6 +10,7 @@
  * - Initializing philosopher IDs, forks, and timing values
  * - Launching philosopher threads
  * - Setting simulation parameters from command-line input
+ * - Releasing that memory again
  *
  * @ingroup philosopher_core
  */
@@ -20,7 +21,9 @@
   * @brief Create and launch all philosopher threads.
   *
   * @details
-  * Iterates over all philosophers and creates one thread per entity.
+  * Iterates over all philosophers and creates one thread per entity, or
+  * one process with `--processes`, then starts the `--samples` thread if
+  * asked for.
   * If any thread creation fails, the simulation is terminated.
   *
   * @param table Pointer to the table structure.
@@ -37,24 +40,64 @@
 	 i = -1;
 	 while (++i < table->philosopher_count)
 	 {
-		 if (pthread_create(&table->philo[i].thread, NULL,
-				 dinner_routine, &table->philo[i]))
+		 if (start_guest(&table->philo[i]))
 		 {
 			 ft_putstr_fd(2, "Couldn't seat the philosophers\n");
 			 end_dinner(table);
 			 exit(EXIT_FAILURE);
 		 }
 	 }
+	 start_sampler(table);
 	 return (0);
  }
  
+ /**
+  * @internal
+  * @brief Lay every seat: ID, fork indexes and state.
+  *
+  * @details
+  * The seats past the philosophers of the command line (`--seats`) start
+  * empty and on hold, for guests to come. With `--graph`, the fork
+  * indexes are the first and last of the seat's forks.
+  *
+  * @param table Pointer to the table, seats allocated and zeroed.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	lay_seats(t_table *table)
+ {
+	 t_philo	*philo;
+	 int		i;
+ 
+	 i = -1;
+	 while (++i < table->seat_count)
+	 {
+		 philo = &table->philo[i];
+		 philo->id = i + 1;
+		 philo->left_fork = i;
+		 philo->right_fork = (i + 1) % table->philosopher_count;
+		 if (table->menu.graph)
+			 lay_forks(table, philo);
+		 philo->seat = SEAT_TAKEN;
+		 if (i >= table->philosopher_count)
+			 philo->seat = SEAT_EMPTY;
+		 philo->hold = (philo->seat == SEAT_EMPTY);
+		 philo->own = (t_timing){-1, -1, -1, NULL};
+		 philo->table = table;
+	 }
+ }
+ 
  /**
   * @brief Allocate and initialize philosophers and fork mutexes.
   *
   * @details
-  * Allocates memory for philosopher structures and fork mutexes.
-  * Initializes each philosopher's ID, fork indexes, last meal time,
-  * and references to the shared table.
+  * Allocates memory for philosopher structures and fork mutexes, a seat
+  * and a fork for each philosopher or `--seats` if more, or a fork for
+  * each line of the `--graph` file, in memory shared between processes
+  * with `--processes`. Initializes each
+  * philosopher's ID, fork indexes, and references to the shared table;
+  * counters and tabs start at zero. The start time and first meals are
+  * stamped once the rest is set up (see doors.c).
   *
   * @param table Pointer to the table structure.
   *
@@ -64,28 +107,26 @@
   */
  void	welcome_philosophers(t_table *table)
  {
-	 int	i;
- 
-	 i = -1;
-	 table->philo = malloc(sizeof(t_philo) * table->philosopher_count);
-	 table->fork_padlock = malloc(sizeof(pthread_mutex_t)
-			 * table->philosopher_count);
+	 table->seat_count = table->philosopher_count;
+	 if (table->menu.seats > table->seat_count)
+		 table->seat_count = table->menu.seats;
+	 table->philo = share_alloc(&table->menu,
+			 sizeof(t_philo) * table->seat_count);
+	 table->fork_padlock = NULL;
+	 table->annex = NULL;
+	 table->links = NULL;
+	 table->doors_open = 0;
+	 load_graph(table);
+	 table->fork_padlock = share_alloc(&table->menu,
+			 sizeof(pthread_mutex_t) * table->fork_count);
 	 if (!table->philo || !table->fork_padlock)
 	 {
 		 ft_putstr_fd(2, "Couldn't get the philosophers or forks\n");
 		 clean_table(table);
 		 exit(EXIT_FAILURE);
 	 }
-	 table->start_time = get_current_time();
-	 while (++i < table->philosopher_count)
-	 {
-		 table->philo[i].id = i + 1;
-		 table->philo[i].left_fork = i;
-		 table->philo[i].right_fork = (i + 1) % table->philosopher_count;
-		 table->philo[i].meal_count = 0;
-		 table->philo[i].last_meal = table->start_time;
-		 table->philo[i].table = table;
-	 }
+	 memset(table->philo, 0, sizeof(t_philo) * table->seat_count);
+	 lay_seats(table);
  }
  
  /**
@@ -95,6 +136,8 @@
   * Converts string arguments into integers and assigns them to the
   * corresponding fields of the `t_table` structure.
   * If the optional 6th argument is provided, sets a meal quota.
+  * Also clears the `--io-stats` ledger and the shared memory stream, and
+  * makes the table its own host.
   *
   * @param table Pointer to the table structure.
   * @param argc Argument count.
@@ -108,10 +151,50 @@
 	 table->time_to_die = ft_atoi(argv[2]);
 	 table->time_to_eat = ft_atoi(argv[3]);
 	 table->time_to_sleep = ft_atoi(argv[4]);
+	 table->must_eat_count = -1;
 	 if (argc == 6)
 		 table->must_eat_count = ft_atoi(argv[5]);
-	 else
-		 table->must_eat_count = -1;
 	 table->end_flag = 0;
+	 table->last_stamp = 0;
+	 table->closer = NULL;
+	 table->closing = NULL;
+	 memset(&table->ledger, 0, sizeof(t_ledger));
+	 table->ledger.min_margin = LLONG_MAX;
+	 table->stream = NULL;
+	 table->report = NULL;
+	 table->samples = NULL;
+	 table->sampling = false;
+	 table->live = NULL;
+	 table->metrics_fd = -1;
+	 table->control_fd = -1;
+	 table->first_timing = (t_timing){table->time_to_die, table->time_to_eat,
+		 table->time_to_sleep, NULL};
+	 table->timing = &table->first_timing;
+	 table->host = table;
+	 table->number = 1;
+ }
+ 
+ /**
+  * @brief Free allocated memory for philosophers and forks.
+  *
+  * @details
+  * Releases the memory allocated for the philosopher array,
+  * the fork mutex array, the `--graph` rows and the `--tables` annexes.
+  *
+  * @param table Pointer to the shared simulation table.
+  *
+  * @ingroup philosopher_core
+  */
+ void	clean_table(t_table *table)
+ {
+	 forget_timings(table);
+	 share_free(&table->menu, table->philo,
+		 sizeof(t_philo) * table->seat_count);
+	 share_free(&table->menu, table->fork_padlock,
+		 sizeof(pthread_mutex_t) * table->fork_count);
+	 free (table->fork_start);
+	 free (table->fork_list);
+	 free (table->annex);
+	 free (table->links);
  }
  
\ No newline at end of file
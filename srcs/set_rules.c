@@ -6,7 +6,8 @@
  *
  * @details
  * This file sets up all necessary pthread mutexes for forks and
- * shared resources like printing, eating, and simulation termination.
+ * shared resources like printing, eating, and simulation termination,
+ * shared between processes with `--processes`.
  * It also provides rollback and cleanup on partial initialization failures.
  *
  * @ingroup philosopher_core
@@ -51,9 +52,10 @@
 	 int	i;
  
 	 i = -1;
-	 while (++i < table->philosopher_count)
+	 while (++i < table->fork_count)
 	 {
-		 if (pthread_mutex_init(&table->fork_padlock[i], NULL))
+		 if (pthread_mutex_init(&table->fork_padlock[i],
+				 padlock_kind(&table->menu)))
 		 {
 			 ft_putstr_fd(2, "Error initializing fork mutex\n");
 			 unset_previous_forks_rules(table, i - 1);
@@ -71,6 +73,8 @@
   * @details
   * Initializes:
   * - `print_padlock`: for synchronized output
+  * - `pass_padlock`: for the output itself, statically, as it cannot fail,
+  *   unless it must be shared between processes
   * - `eat_padlock`: to protect meal tracking
   * - `end_padlock`: to guard simulation state
   * - All fork mutexes
@@ -83,18 +87,24 @@
   */
  void	set_rules(t_table *table)
  {
-	 if (pthread_mutex_init(&table->print_padlock, NULL) != 0)
+	 table->pass_padlock = (pthread_mutex_t)PTHREAD_MUTEX_INITIALIZER;
+	 if (table->menu.processes)
+		 pthread_mutex_init(&table->pass_padlock, padlock_kind(&table->menu));
+	 if (pthread_mutex_init(&table->print_padlock,
+			 padlock_kind(&table->menu)) != 0)
 	 {
 		 ft_putstr_fd(2, "Error initializing print_padlock\n");
 		 exit(EXIT_FAILURE);
 	 }
-	 if (pthread_mutex_init(&table->eat_padlock, NULL) != 0)
+	 if (pthread_mutex_init(&table->eat_padlock,
+			 padlock_kind(&table->menu)) != 0)
 	 {
 		 ft_putstr_fd(2, "Error initializing print_padlock\n");
 		 pthread_mutex_destroy(&table->print_padlock);
 		 exit(EXIT_FAILURE);
 	 }
-	 if (pthread_mutex_init(&table->end_padlock, NULL) != 0)
+	 if (pthread_mutex_init(&table->end_padlock,
+			 padlock_kind(&table->menu)) != 0)
 	 {
 		 ft_putstr_fd(2, "Error initializing end_padlock\n");
 		 pthread_mutex_destroy(&table->print_padlock);
@@ -103,4 +113,64 @@
 	 }
 	 set_forks_rules(table);
  }
+ 
+ /**
+  * @brief Get the attributes of every mutex of the dinner.
+  *
+  * @details
+  * The defaults (NULL) unless philosophers are processes (`--processes`).
+  * Their mutexes live in shared memory and are process-shared and robust:
+  * the next process to lock one whose holder died gets it anyway, and
+  * `take_padlock` makes it consistent again, so a crash does not leave
+  * its forks taken forever. Set up on the first call, before any thread
+  * or process starts.
+  *
+  * @param menu Options of the dinner.
+  * @return The attributes to initialize mutexes with.
+  *
+  * @ingroup philosopher_core
+  */
+ const pthread_mutexattr_t	*padlock_kind(const t_menu *menu)
+ {
+	 static pthread_mutexattr_t	kind;
+	 static bool					ready;
+ 
+	 if (!menu->processes)
+		 return (NULL);
+	 if (!ready)
+	 {
+		 pthread_mutexattr_init(&kind);
+		 pthread_mutexattr_setpshared(&kind, PTHREAD_PROCESS_SHARED);
+		 pthread_mutexattr_setrobust(&kind, PTHREAD_MUTEX_ROBUST);
+		 ready = true;
+	 }
+	 return (&kind);
+ }
+ 
+ /**
+  * @brief Get the attributes of the condition variables of the dinner.
+  *
+  * @details
+  * Process-shared with `--processes`, the defaults (NULL) otherwise.
+  *
+  * @param menu Options of the dinner.
+  * @return The attributes to initialize condition variables with.
+  *
+  * @ingroup philosopher_core
+  */
+ const pthread_condattr_t	*signal_kind(const t_menu *menu)
+ {
+	 static pthread_condattr_t	kind;
+	 static bool					ready;
+ 
+	 if (!menu->processes)
+		 return (NULL);
+	 if (!ready)
+	 {
+		 pthread_condattr_init(&kind);
+		 pthread_condattr_setpshared(&kind, PTHREAD_PROCESS_SHARED);
+		 ready = true;
+	 }
+	 return (&kind);
+ }
  
\ No newline at end of file
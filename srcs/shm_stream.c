@@ -0,0 +1,111 @@
+/**
+ * @file shm_stream.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Publication of trace records into shared memory for `--format=shm`.
+ *
+ * @details
+ * The object is created afresh for every run, mapped and populated up
+ * front, so that publishing an event only stores to memory: no system
+ * call and no page fault while the dinner runs. See philo_shm.h for the
+ * protocol consumers follow.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+ #include <fcntl.h>
+ #include <sys/mman.h>
+
+ /**
+  * @brief Create the shared memory stream and announce the run in it.
+  *
+  * @details
+  * A leftover object of the same name is replaced. Must be called before
+  * any philosopher thread starts.
+  *
+  * @param table Pointer to the configured table.
+  * @param header Run parameters, copied into the stream.
+  *
+  * @note Exits the program if the object cannot be created or mapped.
+  *
+  * @ingroup philosopher_core
+  */
+ void	open_shm_stream(t_table *table, const t_trace_header *header)
+ {
+	 t_shm_stream	*stream;
+	 int				fd;
+ 
+	 shm_unlink(table->menu.shm_name);
+	 fd = shm_open(table->menu.shm_name, O_CREAT | O_EXCL | O_RDWR, 0644);
+	 stream = MAP_FAILED;
+	 if (fd != -1 && ftruncate(fd, sizeof(t_shm_stream)) == 0)
+		 stream = mmap(NULL, sizeof(t_shm_stream), PROT_READ | PROT_WRITE,
+				 MAP_SHARED | MAP_POPULATE, fd, 0);
+	 if (fd != -1)
+		 close(fd);
+	 if (stream == MAP_FAILED)
+	 {
+		 ft_putstr_fd(2, "Couldn't open the shared memory stream\n");
+		 shm_unlink(table->menu.shm_name);
+		 clean_table(table);
+		 exit(EXIT_FAILURE);
+	 }
+	 memcpy(stream->magic, SHM_MAGIC, sizeof(stream->magic));
+	 stream->slot_count = SHM_SLOTS;
+	 stream->header = *header;
+	 __atomic_store_n(&stream->version, SHM_VERSION, __ATOMIC_RELEASE);
+	 table->stream = stream;
+ }
+ 
+ /**
+  * @brief Publish one trace record.
+  *
+  * @details
+  * Called under `pass_padlock`, so there is a single producer at a time.
+  * Overwrites the oldest slot whether or not anybody has read it. The
+  * record is stored field by field with release ordering, so that no part
+  * of it can become visible before the slot's `seq` is cleared.
+  *
+  * @param stream Open stream.
+  * @param event Record to publish.
+  *
+  * @ingroup philosopher_core
+  */
+ void	publish_event(t_shm_stream *stream, const t_trace_event *event)
+ {
+	 t_shm_slot	*slot;
+	 uint64_t	n;
+ 
+	 n = stream->head;
+	 slot = &stream->slots[n % SHM_SLOTS];
+	 __atomic_store_n(&slot->seq, 0, __ATOMIC_RELAXED);
+	 __atomic_store_n(&slot->event.time, event->time, __ATOMIC_RELEASE);
+	 __atomic_store_n(&slot->event.id, event->id, __ATOMIC_RELEASE);
+	 __atomic_store_n(&slot->event.fork, event->fork, __ATOMIC_RELEASE);
+	 __atomic_store_n(&slot->event.kind, event->kind, __ATOMIC_RELEASE);
+	 __atomic_store_n(&slot->seq, n + 1, __ATOMIC_RELEASE);
+	 __atomic_store_n(&stream->head, n + 1, __ATOMIC_RELEASE);
+ }
+ 
+ /**
+  * @brief Mark the stream closed, unmap it and remove its name.
+  *
+  * @details
+  * Called once every philosopher thread is joined. Consumers still
+  * attached read what is left, then see `closed`.
+  *
+  * @param table Pointer to the shared simulation table.
+  *
+  * @ingroup philosopher_core
+  */
+ void	close_shm_stream(t_table *table)
+ {
+	 if (!table->stream)
+		 return ;
+	 __atomic_store_n(&table->stream->closed, 1, __ATOMIC_RELEASE);
+	 munmap(table->stream, sizeof(t_shm_stream));
+	 shm_unlink(table->menu.shm_name);
+	 table->stream = NULL;
+ }
+ 
\ No newline at end of file
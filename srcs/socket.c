@@ -0,0 +1,93 @@
+/**
+ * @file socket.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Unix domain sockets of the `--metrics` and `--control` servers.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+ #include <sys/socket.h>
+ #include <sys/un.h>
+
+ /**
+  * @brief Listen on a Unix domain stream socket.
+  *
+  * @details
+  * A leftover socket file at the path is replaced.
+  *
+  * @param path Socket path, shorter than `sun_path`.
+  * @return The listening socket, or -1 on failure.
+  *
+  * @ingroup philosopher_core
+  */
+ int	listen_on(const char *path)
+ {
+	 struct sockaddr_un	address;
+	 int					fd;
+ 
+	 memset(&address, 0, sizeof(address));
+	 address.sun_family = AF_UNIX;
+	 if (strlen(path) >= sizeof(address.sun_path))
+		 return (-1);
+	 strncpy(address.sun_path, path, sizeof(address.sun_path) - 1);
+	 unlink(path);
+	 fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	 if (fd != -1 && (bind(fd, (struct sockaddr *)&address,
+				 sizeof(address)) == -1 || listen(fd, 16) == -1))
+	 {
+		 close(fd);
+		 fd = -1;
+	 }
+	 return (fd);
+ }
+ 
+ /**
+  * @brief Send a whole buffer, giving up quietly if the client left.
+  *
+  * @param fd Connected socket.
+  * @param data Bytes to send.
+  * @param size Number of bytes.
+  *
+  * @ingroup philosopher_core
+  */
+ void	send_all(int fd, const char *data, size_t size)
+ {
+	 ssize_t	sent;
+ 
+	 while (size > 0)
+	 {
+		 sent = send(fd, data, size, MSG_NOSIGNAL);
+		 if (sent == -1 && errno == EINTR)
+			 continue ;
+		 if (sent == -1)
+			 return ;
+		 data += sent;
+		 size -= sent;
+	 }
+ }
+ 
+ /**
+  * @brief Wait for a server thread and remove its socket.
+  *
+  * @details
+  * Called once the dinner is over, which is what the thread waits for;
+  * does nothing if the server was never started.
+  *
+  * @param fd Listening socket, or -1; becomes -1.
+  * @param thread Server thread.
+  * @param path Socket path.
+  *
+  * @ingroup philosopher_core
+  */
+ void	stop_server(int *fd, pthread_t thread, const char *path)
+ {
+	 if (*fd == -1)
+		 return ;
+	 pthread_join(thread, NULL);
+	 close(*fd);
+	 unlink(path);
+	 *fd = -1;
+ }
+ 
\ No newline at end of file
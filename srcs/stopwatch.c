@@ -0,0 +1,66 @@
+/**
+ * @file stopwatch.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Fine-grained clock for the `--io-stats` and `--report` measurements.
+ *
+ * @details
+ * The log keeps its millisecond clock; lock timings need nanoseconds, and
+ * are only read when they are going to be reported.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+
+ /**
+  * @brief Get a monotonic timestamp in nanoseconds.
+  *
+  * @details
+  * Used for measurements finer than the millisecond clock of the log, such
+  * as how long `print_padlock` is held. Only differences are meaningful.
+  *
+  * @return Nanoseconds since an arbitrary fixed point.
+  */
+ long long	get_precise_time(void)
+ {
+	 struct timespec	now;
+ 
+	 clock_gettime(CLOCK_MONOTONIC, &now);
+	 return (now.tv_sec * 1000000000LL + now.tv_nsec);
+ }
+ 
+ /**
+  * @brief Get the wall clock in milliseconds.
+  *
+  * @details
+  * Unlike the dinner clock (`get_current_time`), it goes on through a
+  * `--control` pause; it only stamps when the dinner began and ended.
+  *
+  * @return Milliseconds since the epoch.
+  *
+  * @ingroup philosopher_core
+  */
+ long long	get_wall_time(void)
+ {
+	 struct timespec	now;
+ 
+	 clock_gettime(CLOCK_REALTIME, &now);
+	 return (now.tv_sec * 1000LL + now.tv_nsec / 1000000);
+ }
+ 
+ /**
+  * @brief Read the precise clock, only when a measurement needs it.
+  *
+  * @param table Pointer to the shared simulation table.
+  * @return `get_precise_time()`, or 0 without `--io-stats` or `--report`.
+  *
+  * @ingroup philosopher_core
+  */
+ long long	read_stopwatch(t_table *table)
+ {
+	 if (!is_measured(&table->menu))
+		 return (0);
+	 return (get_precise_time());
+ }
+ 
\ No newline at end of file
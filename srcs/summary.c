@@ -0,0 +1,150 @@
+/**
+ * @file summary.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief The closing line of `--format=summary` and `--format=json`.
+ *
+ * @details
+ * Both formats log no event while the dinner goes on: every action only
+ * bumps its philosopher's `events` counter. Once the threads are joined,
+ * one line goes to stdout, as `key=value` pairs or as a JSON object:
+ * - `outcome`: `died`, `full` when every quota was met, or `time` when a
+ *   `--run-for` dinner ran out
+ * - who died and when (ms since the start), if somebody did
+ * - total meals, and the fewest and most eaten by one philosopher
+ * - total actions and the run time (ms)
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+
+ /**
+  * @internal
+  * @brief Add up the meals and actions of every philosopher.
+  *
+  * @param table Pointer to the shared simulation table.
+  * @param count Receives the total meals, the fewest and the most eaten by
+  * one philosopher, and the total actions, in that order. Philosophers who
+  * left count too.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	count_plates(t_table *table, long long count[4])
+ {
+	 t_philo	*philo;
+	 int		i;
+ 
+	 count[0] = 0;
+	 count[1] = table->philo[0].meal_count;
+	 count[2] = count[1];
+	 count[3] = 0;
+	 i = -1;
+	 while (++i < table->seat_count)
+	 {
+		 philo = &table->philo[i];
+		 if (philo->seat == SEAT_EMPTY)
+			 continue ;
+		 count[0] += philo->meal_count;
+		 if (philo->meal_count < count[1])
+			 count[1] = philo->meal_count;
+		 if (philo->meal_count > count[2])
+			 count[2] = philo->meal_count;
+		 count[3] += philo->events;
+	 }
+ }
+ 
+ /**
+  * @internal
+  * @brief Name how the dinner ended.
+  *
+  * @param table Pointer to the shared simulation table.
+  * @return `died`, `full` or `time`.
+  *
+  * @ingroup philosopher_core
+  */
+ static const char	*name_outcome(t_table *table)
+ {
+	 if (table->closing && !strcmp(table->closing, DIE))
+		 return ("died");
+	 if (table->closing)
+		 return ("full");
+	 return ("time");
+ }
+ 
+ /**
+  * @internal
+  * @brief Print the summary as one line of `key=value` pairs.
+  *
+  * @param table Pointer to the shared simulation table.
+  * @param count Meal and action counts from `count_plates`.
+  * @param runtime Run time (ms).
+  *
+  * @ingroup philosopher_core
+  */
+ static void	print_line(t_table *table, long long count[4], long long runtime)
+ {
+	 printf("outcome=%s", name_outcome(table));
+	 if (table->closing && !strcmp(table->closing, DIE))
+		 printf(" philosopher=%d time_ms=%lld", house_number(table->closer),
+			 table->closed_at - table->start_time);
+	 printf(" meals=%lld meals_min=%lld meals_max=%lld events=%lld "
+		 "runtime_ms=%lld\n", count[0], count[1], count[2], count[3], runtime);
+ }
+ 
+ /**
+  * @brief Write how the dinner ended as JSON members.
+  *
+  * @details
+  * Writes `"outcome"` and `"died"`, null when nobody died, without the
+  * surrounding braces. Shared by `--format=json` and `--report`.
+  *
+  * @param out Stream to write to.
+  * @param table Pointer to the shared simulation table.
+  *
+  * @ingroup philosopher_core
+  */
+ void	print_outcome(FILE *out, t_table *table)
+ {
+	 fprintf(out, "\"outcome\":\"%s\",\"died\":", name_outcome(table));
+	 if (table->closing && !strcmp(table->closing, DIE))
+		 fprintf(out, "{\"id\":%d,\"time_ms\":%lld}",
+			 house_number(table->closer), table->closed_at - table->start_time);
+	 else
+		 fprintf(out, "null");
+ }
+ 
+ /**
+  * @brief Print the closing summary of a `summary` or `json` dinner.
+  *
+  * @details
+  * Called once every philosopher thread is joined; does nothing with the
+  * other formats.
+  *
+  * @param table Pointer to the shared simulation table.
+  *
+  * @ingroup philosopher_core
+  */
+ void	present_summary(t_table *table)
+ {
+	 long long	count[4];
+	 long long	runtime;
+ 
+	 if (table->menu.format != FORMAT_SUMMARY
+		 && table->menu.format != FORMAT_JSON)
+		 return ;
+	 runtime = get_current_time() - table->start_time;
+	 count_plates(table, count);
+	 if (table->menu.format == FORMAT_SUMMARY)
+		 print_line(table, count, runtime);
+	 else
+	 {
+		 printf("{");
+		 print_outcome(stdout, table);
+		 printf(",\"meals\":%lld,\"meals_min\":%lld,\"meals_max\":%lld,"
+			 "\"events\":%lld,\"runtime_ms\":%lld}\n", count[0], count[1],
+			 count[2], count[3], runtime);
+	 }
+	 fflush(stdout);
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,109 @@
+/**
+ * @file tab.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Per-philosopher figures for the `--report` JSON.
+ *
+ * @details
+ * Each philosopher keeps its own tab, so nothing here takes a lock: the
+ * figures are only read once the threads are joined. Hunger is always
+ * kept; fork waits and naps need the precise clock, read only when
+ * `read_stopwatch` runs. The report and the bill average them, and the
+ * ledger's totals, over counts that may be zero.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+
+ /**
+  * @brief Average a total over a count, 0 over none.
+  *
+  * @param total Sum of the figures.
+  * @param count How many figures it sums.
+  * @return The average, or 0 if `count` is 0.
+  *
+  * @ingroup philosopher_core
+  */
+ double	average(double total, long long count)
+ {
+	 if (count == 0)
+		 return (0);
+	 return (total / count);
+ }
+ 
+ /**
+  * @brief Record how long a philosopher waited for both forks.
+  *
+  * @details
+  * Called right after the second fork is taken.
+  *
+  * @param philo Philosopher who just took the forks.
+  * @param asked When the first fork was asked for (`read_stopwatch`), 0
+  * when nothing is measured.
+  *
+  * @ingroup philosopher_core
+  */
+ void	note_forks(t_philo *philo, long long asked)
+ {
+	 long long	waited;
+ 
+	 if (!asked)
+		 return ;
+	 waited = get_precise_time() - asked;
+	 philo->tab.meals_timed++;
+	 philo->tab.fork_wait += waited;
+	 if (waited > philo->tab.fork_wait_max)
+		 philo->tab.fork_wait_max = waited;
+ }
+ 
+ /**
+  * @brief Record how far past its request a nap ended.
+  *
+  * @details
+  * `advance_time` counts whole milliseconds of `gettimeofday`, so a nap
+  * may also end up to a millisecond early; the overrun is kept signed.
+  * Naps cut short by the end of the dinner, and empty ones, are skipped.
+  *
+  * @param philo Philosopher who just woke.
+  * @param began When the nap began (`read_stopwatch`), 0 when nothing is
+  * measured.
+  * @param ms Time asked for (ms).
+  *
+  * @ingroup philosopher_core
+  */
+ void	note_nap(t_philo *philo, long long began, long long ms)
+ {
+	 long long	over;
+ 
+	 if (!began || ms <= 0
+		 || __atomic_load_n(&philo->table->end_flag, __ATOMIC_ACQUIRE))
+		 return ;
+	 over = get_precise_time() - began - ms * 1000000;
+	 philo->tab.naps++;
+	 philo->tab.oversleep += over;
+	 if (philo->tab.naps == 1 || over > philo->tab.oversleep_max)
+		 philo->tab.oversleep_max = over;
+ }
+ 
+ /**
+  * @brief Record how long a philosopher went without a meal.
+  *
+  * @details
+  * Called once a meal is over, just before `last_meal` moves: the gap
+  * since the previous `last_meal` is the longest the monitor could have
+  * seen, and judged against `time_to_die`.
+  *
+  * @param philo Philosopher who just ate.
+  *
+  * @ingroup philosopher_core
+  */
+ void	note_hunger(t_philo *philo)
+ {
+	 long long	hunger;
+ 
+	 hunger = get_current_time() - philo->last_meal;
+	 if (hunger > philo->tab.hunger_max)
+		 philo->tab.hunger_max = hunger;
+ }
+ 
\ No newline at end of file
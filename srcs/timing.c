@@ -0,0 +1,153 @@
+/**
+ * @file timing.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Timings that `--control` can change while the dinner runs.
+ *
+ * @details
+ * The current `time_to_die`, `time_to_eat` and `time_to_sleep` are one
+ * read-only version behind `table->timing`, swapped read-copy-update
+ * style: the control thread copies the current version, changes the copy
+ * and publishes it with one atomic store. Readers take no lock; a
+ * philosopher loads the pointer at each phase boundary and keeps that
+ * version until the next one, the monitor at each look. Old versions stay
+ * linked behind the new one and are only freed once every thread is
+ * joined, so no reader is ever left holding a freed version.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+
+ /**
+  * @brief Get the timings currently in force.
+  *
+  * @param table Pointer to the shared simulation table.
+  * @return The current version, valid until the dinner is cleaned up.
+  *
+  * @ingroup philosopher_core
+  */
+ t_timing	*read_timing(t_table *table)
+ {
+	 return (__atomic_load_n(&table->timing, __ATOMIC_ACQUIRE));
+ }
+ 
+ /**
+  * @internal
+  * @brief Publish new timings.
+  *
+  * @details
+  * Only called by the control thread, the one writer.
+  *
+  * @param table Pointer to the shared simulation table.
+  * @param timing Values of the new version.
+  * @return 0 on success, -1 if the version could not be allocated.
+  *
+  * @ingroup philosopher_core
+  */
+ static int	publish_timing(t_table *table, const t_timing *timing)
+ {
+	 t_timing	*version;
+ 
+	 version = malloc(sizeof(*version));
+	 if (!version)
+		 return (-1);
+	 *version = *timing;
+	 version->previous = table->timing;
+	 __atomic_store_n(&table->timing, version, __ATOMIC_RELEASE);
+	 return (0);
+ }
+ 
+ /**
+  * @brief Change one of the timings.
+  *
+  * @details
+  * `time_to_die` must stay above zero, and so must the others unless the
+  * dinner runs `--run-for`, as on the command line.
+  *
+  * @param table Pointer to the shared simulation table.
+  * @param what `die`, `eat` or `sleep`.
+  * @param ms New value (ms).
+  * @return 0 once published, -1 on an unknown name or value, or if the
+  * version could not be allocated.
+  *
+  * @ingroup philosopher_core
+  */
+ int	retime(t_table *table, const char *what, long long ms)
+ {
+	 t_timing	timing;
+	 long long	least;
+ 
+	 timing = *read_timing(table);
+	 least = 1;
+	 if (table->menu.run_for && !is_same(what, "die"))
+		 least = 0;
+	 if (ms < least || ms > INT_MAX)
+		 return (-1);
+	 if (is_same(what, "die"))
+		 timing.time_to_die = ms;
+	 else if (is_same(what, "eat"))
+		 timing.time_to_eat = ms;
+	 else if (is_same(what, "sleep"))
+		 timing.time_to_sleep = ms;
+	 else
+		 return (-1);
+	 return (publish_timing(table, &timing));
+ }
+ 
+ /**
+  * @brief Wait out a pause, then get the timings of the next phase.
+  *
+  * @details
+  * Called by a philosopher before thinking and before sleeping: while the
+  * dinner clock is frozen it goes no further. A philosopher already
+  * waiting for its forks may still sit down, at the frozen time. While
+  * `--control` holds it, re-linking the ring around it, it waits too (see
+  * seating.c).
+  *
+  * @param philo Philosopher at a phase boundary.
+  * @param timing Receives its timings: the current version, with those of
+  * its own in place (see scenario.c).
+  * @return `false` once the dinner is over or the philosopher has left.
+  *
+  * @ingroup philosopher_core
+  */
+ bool	next_phase(t_philo *philo, t_timing *timing)
+ {
+	 long long	ticket;
+ 
+	 ticket = __atomic_load_n(&philo->hold, __ATOMIC_ACQUIRE);
+	 while ((ticket || is_clock_frozen()) && !is_dinner_over(philo, false))
+	 {
+		 usleep(PAUSE_NAP);
+		 ticket = __atomic_load_n(&philo->hold, __ATOMIC_ACQUIRE);
+	 }
+	 if (is_dinner_over(philo, false)
+		 || __atomic_load_n(&philo->seat, __ATOMIC_ACQUIRE) != SEAT_TAKEN)
+		 return (false);
+	 own_timing(philo, timing);
+	 return (true);
+ }
+ 
+ /**
+  * @brief Free every version published by `--control`.
+  *
+  * @details
+  * The first version is part of the table and stays.
+  *
+  * @param table Pointer to the table, with no reader left.
+  *
+  * @ingroup philosopher_core
+  */
+ void	forget_timings(t_table *table)
+ {
+	 t_timing	*previous;
+ 
+	 while (table->timing != &table->first_timing)
+	 {
+		 previous = table->timing->previous;
+		 free(table->timing);
+		 table->timing = previous;
+	 }
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,134 @@
+/**
+ * @file ushers.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Philosophers making way for each other around a re-linked ring.
+ *
+ * @details
+ * A philosopher is only re-linked while it holds no fork. It raises
+ * `dining` before it looks at `hold` on its way to the forks, and lowers
+ * it once they are back; `park` (see seating.c) raises `hold` before it
+ * looks at `dining`. One of the two always sees the other, so either the
+ * change waits for the meal in progress, or the philosopher waits for
+ * the change.
+ *
+ * Neither the parity stagger nor the odd count's wait survive a change:
+ * neighbours who ate together stay in step, and the count that decides
+ * the wait changes for everybody at once. So with `--seats` philosophers
+ * stagger themselves instead, as `--scenario` ones do (see courtesy.c):
+ * one about to take its forks first lets a neighbour who holds a fork of
+ * its own, or would starve during its meal, go first.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+
+ /**
+  * @internal
+  * @brief Tell whether a neighbour should take its forks first.
+  *
+  * @details
+  * Neighbours are found by their forks, scanning the seats, as the ring
+  * may be re-linked meanwhile. A hungrier neighbour only goes first if it
+  * could not wait for the meal: that one, at least, would end it dead.
+  *
+  * @param philo Philosopher about to take its forks.
+  * @param meal Length of its meal (ms).
+  * @return Whether a neighbour is dining, or needs the forks more.
+  *
+  * @ingroup philosopher_core
+  */
+ static bool	is_anyone_first(t_philo *philo, long long meal)
+ {
+	 t_philo		*other;
+	 long long	now;
+	 int			i;
+ 
+	 now = get_current_time();
+	 i = -1;
+	 while (++i < philo->table->seat_count)
+	 {
+		 other = &philo->table->philo[i];
+		 if (other != philo
+			 && __atomic_load_n(&other->seat, __ATOMIC_ACQUIRE) == SEAT_TAKEN
+			 && (other->left_fork == __atomic_load_n(&philo->right_fork,
+					 __ATOMIC_RELAXED) || philo->left_fork
+				 == __atomic_load_n(&other->right_fork, __ATOMIC_RELAXED))
+			 && (__atomic_load_n(&other->dining, __ATOMIC_RELAXED)
+				 || (urgency(other, now) < urgency(philo, now)
+					 && urgency(other, now) <= meal)))
+			 return (true);
+	 }
+	 return (false);
+ }
+ 
+ /**
+  * @brief Make way, then get ready to take the forks.
+  *
+  * @details
+  * Does nothing without `--seats`. Waits while a neighbour should go
+  * first; while the ring is being re-linked around the philosopher, it
+  * stops as at a phase boundary (`next_phase`), holding no fork.
+  *
+  * @param philo Philosopher about to take its forks.
+  * @param time_to_eat Length of its meal (ms).
+  * @return `false` once the dinner is over or the philosopher has left.
+  *
+  * @ingroup philosopher_core
+  */
+ bool	sit_down(t_philo *philo, int time_to_eat)
+ {
+	 t_timing	timing;
+ 
+	 if (!philo->table->menu.seats)
+		 return (true);
+	 while (!is_dinner_over(philo, false)
+		 && is_anyone_first(philo, time_to_eat))
+		 usleep(YIELD_NAP);
+	 __atomic_store_n(&philo->dining, true, __ATOMIC_SEQ_CST);
+	 while (__atomic_load_n(&philo->hold, __ATOMIC_SEQ_CST)
+		 || __atomic_load_n(&philo->seat, __ATOMIC_ACQUIRE) != SEAT_TAKEN)
+	 {
+		 __atomic_store_n(&philo->dining, false, __ATOMIC_SEQ_CST);
+		 if (!next_phase(philo, &timing))
+			 return (false);
+		 __atomic_store_n(&philo->dining, true, __ATOMIC_SEQ_CST);
+	 }
+	 return (true);
+ }
+ 
+ /**
+  * @brief Ask a philosopher to park, and wait until it holds no fork.
+  *
+  * @param philo Philosopher to park.
+  * @param ticket Ticket of the change.
+  * @return `false` if the dinner ended first.
+  *
+  * @ingroup philosopher_core
+  */
+ bool	park(t_philo *philo, long long ticket)
+ {
+	 __atomic_store_n(&philo->hold, ticket, __ATOMIC_SEQ_CST);
+	 while (__atomic_load_n(&philo->dining, __ATOMIC_SEQ_CST))
+	 {
+		 if (is_dinner_over(philo, false))
+			 return (false);
+		 usleep(PARK_NAP);
+	 }
+	 return (true);
+ }
+ 
+ /**
+  * @brief Say the forks are back, with `--seats`.
+  *
+  * @param philo Philosopher who just put its forks down.
+  *
+  * @ingroup philosopher_core
+  */
+ void	stand_up(t_philo *philo)
+ {
+	 if (philo->table->menu.seats)
+		 __atomic_store_n(&philo->dining, false, __ATOMIC_RELEASE);
+ }
+ 
\ No newline at end of file
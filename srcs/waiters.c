@@ -7,7 +7,8 @@
  * @details
  * This module defines support functions used by all philosopher threads:
  * - Delaying execution for a precise time span
- * - Displaying philosopher actions in a thread-safe way
+ * - Displaying philosopher actions in a thread-safe way, as text lines or
+ *   binary trace records
  * - Checking and setting simulation termination status
  *
  * @ingroup philosopher_core
@@ -21,6 +22,8 @@
   * @details
   * Sleeps the current philosopher using `usleep` until `time_to` ms has passed,
   * or until the dinner ends. Precision is maintained with short sleeps and polling.
+  * How far past `time_to` it woke goes on the philosopher's tab when it is
+  * measured.
   *
   * @param philo Pointer to the philosopher context.
   * @param time_to Time in milliseconds to wait.
@@ -30,11 +33,70 @@
  void	advance_time(t_philo *philo, long long time_to)
  {
 	 long long	start;
+	 long long	began;
  
+	 began = read_stopwatch(philo->table);
 	 start = get_current_time();
 	 while (!is_dinner_over(philo, false)
 		 && (get_current_time() - start) < time_to)
 		 usleep(100);
+	 note_nap(philo, began, time_to);
+ }
+ 
+ /**
+  * @brief Log one or more actions of a philosopher in a row, each stamped
+  * when it happened, with the fork involved when there is one.
+  *
+  * @details
+  * Outputs, under a single hold of `print_padlock` and `pass_padlock` and
+  * only while the dinner is running, either text lines (time since start,
+  * philosopher ID, action) or binary trace records, in order and at the
+  * time of their events rather than the time the lock was obtained. Once
+  * the dinner is over the lock is not even asked for. Counting the actions
+  * and updating the `--live` seat (`tally_actions`) is all that happens
+  * with `--format=none`, `summary` or `json`; with `--io-stats` the lock
+  * wait and hold times are recorded.
+  * The ledger's `queue` counts the threads asking for or holding the lock.
+  * The locks, the ledger and the output are those of the host table, which
+  * every `--tables` table shares.
+  *
+  * @param philo Pointer to the philosopher who is performing the actions.
+  * @param order Actions, each with its fork (-1 unless TAKE) and the time
+  * of its event (`get_current_time`), read before any lock is asked for.
+  * Receives the times logged.
+  * @param count Number of actions, at least 1.
+  * @return The time logged for the last action: later than its event only
+  * if a later event was logged first, its event's if nothing was logged.
+  *
+  * @ingroup philosopher_core
+  */
+ long long	print_order(t_philo *philo, t_order *order, int count)
+ {
+	 long long	asked;
+	 long long	locked;
+	 bool		printed;
+	 int			i;
+ 
+	 tally_actions(philo, order, count);
+	 if (is_quiet(&philo->table->menu)
+		 || __atomic_load_n(&philo->table->end_flag, __ATOMIC_ACQUIRE))
+		 return (order[count - 1].when);
+	 asked = read_stopwatch(philo->table);
+	 __atomic_add_fetch(&philo->table->host->ledger.queue, 1, __ATOMIC_RELAXED);
+	 take_padlock(philo->table->host, &philo->table->host->print_padlock);
+	 take_padlock(NULL, &philo->table->host->pass_padlock);
+	 locked = read_stopwatch(philo->table);
+	 printed = !is_dinner_over(philo, false);
+	 i = -1;
+	 while (printed && ++i < count)
+		 order[i].when = write_action(philo, order[i].action, order[i].fork,
+				 order[i].when);
+	 if (is_measured(&philo->table->menu))
+		 keep_ledger(philo->table->host, asked, locked, printed * count);
+	 pthread_mutex_unlock(&philo->table->host->pass_padlock);
+	 pthread_mutex_unlock(&philo->table->host->print_padlock);
+	 __atomic_sub_fetch(&philo->table->host->ledger.queue, 1, __ATOMIC_RELAXED);
+	 return (order[count - 1].when);
  }
  
  /**
@@ -47,7 +109,8 @@
   * - The action string (e.g., "is eating", "has taken a fork")
   *
   * Uses a mutex to ensure output remains synchronized across threads.
-  * Special-case: if action starts with `'e'`, prints END_MSG after the line.
+  * The messages that end the dinner go through `last_call` instead. With
+  * `--format=binary` a trace record is written instead of the line.
   *
   * @param philo Pointer to the philosopher who is performing the action.
   * @param action String representing the action being performed.
@@ -56,17 +119,24 @@
   */
  void	print_action(t_philo *philo, const char *action)
  {
-	 long long	time;
+	 print_order(philo, &(t_order){action, -1, get_current_time()}, 1);
+ }
  
-	 pthread_mutex_lock(&philo->table->print_padlock);
-	 if (!is_dinner_over(philo, false))
-	 {
-		 time = get_current_time() - philo->table->start_time;
-		 printf("%lld %d %s\n", time, philo->id, action);
-	 }
-	 pthread_mutex_unlock(&philo->table->print_padlock);
-	 if (action[0] == 'e')
-		 printf("%s\n", END_MSG);
+ /**
+  * @brief Log that a philosopher has taken a specific fork.
+  *
+  * @details
+  * Prints the same TAKE line as `print_action`; binary traces also record
+  * which fork was taken.
+  *
+  * @param philo Pointer to the philosopher holding the fork.
+  * @param fork Index of the fork in `fork_padlock`.
+  *
+  * @ingroup philosopher_core
+  */
+ void	print_fork(t_philo *philo, int fork)
+ {
+	 print_order(philo, &(t_order){TAKE, fork, get_current_time()}, 1);
  }
  
  /**
@@ -85,11 +155,11 @@
   */
  bool	is_dinner_over(t_philo *philo, bool end)
  {
-	 pthread_mutex_lock(&philo->table->end_padlock);
+	 take_padlock(NULL, &philo->table->end_padlock);
 	 if (end || philo->table->end_flag)
 	 {
 		 if (end)
-			 philo->table->end_flag = 1;
+			 __atomic_store_n(&philo->table->end_flag, 1, __ATOMIC_RELEASE);
 		 pthread_mutex_unlock(&philo->table->end_padlock);
 		 return (true);
 	 }
@@ -0,0 +1,117 @@
+/**
+ * @file wings.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Segments of the ring in worker processes (`--workers`).
+ *
+ * @details
+ * With `--workers=k`, the philosophers are split into k contiguous wings
+ * of the ring, as even as the count allows, and each wing is served by a
+ * process of its own, forked by the main process, that runs its
+ * philosophers as threads. Everything is laid out as for `--processes`:
+ * the forks are process-shared robust mutexes in shared memory, so those
+ * on the border of two wings work as any other, and the main process
+ * stays on as the one monitor, reading every philosopher's `last_meal`
+ * from the shared seats. With `--link`, the border forks are asked for
+ * by message instead (see links.c); nothing else is.
+ *
+ * @ingroup philosopher_core
+ */
+
+ #include "../include/philo.h"
+ #include <signal.h>
+ #include <sys/prctl.h>
+
+ /**
+  * @brief Find the wing a seat belongs to.
+  *
+  * @param table Pointer to the shared simulation table.
+  * @param seat Seat index, from 0.
+  * @return The wing, from 0 to `workers - 1`.
+  *
+  * @ingroup philosopher_core
+  */
+ int	find_wing(t_table *table, int seat)
+ {
+	 return ((long long) seat * table->menu.workers
+		 / table->philosopher_count);
+ }
+ 
+ /**
+  * @internal
+  * @brief Serve a wing, in its worker process, then leave.
+  *
+  * @details
+  * Starts the wing's porter with `--link`, then a thread per philosopher
+  * of the wing, and waits for them. If one cannot be started, the ones
+  * before it dine on, and the monitor finds the others starving. The
+  * porter is waited for last, once the wing's own link is hung up, since
+  * the next wing may still be asking for its fork.
+  *
+  * @param table Pointer to the shared simulation table.
+  * @param first First seat of the wing.
+  *
+  * @ingroup philosopher_core
+  */
+ static void	serve_wing(t_table *table, int first)
+ {
+	 pthread_t	porter;
+	 bool		served;
+	 int			end;
+	 int			i;
+ 
+	 prctl(PR_SET_PDEATHSIG, SIGKILL);
+	 end = first;
+	 while (end < table->philosopher_count
+		 && find_wing(table, end) == find_wing(table, first))
+		 end++;
+	 served = open_porter(&table->philo[first], &table->philo[end - 1],
+			 &porter);
+	 i = first;
+	 while (i < end && pthread_create(&table->philo[i].thread, NULL,
+			 dinner_routine, &table->philo[i]) == 0)
+		 i++;
+	 if (i < end)
+		 ft_putstr_fd(2, "Couldn't seat the philosophers\n");
+	 while (i > first)
+		 pthread_join(table->philo[--i].thread, NULL);
+	 close_porter(&table->philo[end - 1], porter, served);
+	 fflush(stdout);
+	 _exit(EXIT_SUCCESS);
+ }
+ 
+ /**
+  * @brief Start a philosopher of a `--workers` dinner.
+  *
+  * @details
+  * The first philosopher of each wing forks its worker, which starts the
+  * whole wing; the others are already on their way. Only the first one
+  * keeps the worker's `room`, for `wait_guest`. Once the last worker is
+  * forked, the main process lets go of the `--link` sockets.
+  *
+  * @param philo Philosopher to start.
+  * @return 0 on success, nonzero if the worker could not be forked.
+  *
+  * @ingroup philosopher_core
+  */
+ int	open_wing(t_philo *philo)
+ {
+	 t_table	*table;
+	 pid_t	room;
+	 int		seat;
+ 
+	 table = philo->table;
+	 seat = philo - table->philo;
+	 philo->room = 0;
+	 if (seat > 0 && find_wing(table, seat - 1) == find_wing(table, seat))
+		 return (0);
+	 fflush(stdout);
+	 room = fork();
+	 if (room == 0)
+		 serve_wing(table, seat);
+	 philo->room = room;
+	 if (find_wing(table, seat) == table->menu.workers - 1)
+		 close_links(table, -1, -1);
+	 return (room == -1);
+ }
+ 
\ No newline at end of file
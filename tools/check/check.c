@@ -0,0 +1,167 @@
+/**
+ * @file check.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Entry point of the `philo-check` streaming log validator.
+ *
+ * @details
+ * Usage: `philo-check [-t ms] [-w ms] [-r count] [-o] [-q] [-f file |
+ * -s name] [N die eat sleep [meals]]`. Text logs need the run's parameters
+ * on the command line; binary traces carry them in their header. The log
+ * is read from stdin unless `-f` names a file or `-s` the shared memory
+ * stream of a `philo --format=shm` run. Exits with 0 when the log is valid,
+ * 1 when violations were found and 2 on usage or input errors.
+ *
+ * @ingroup philosopher_check
+ */
+
+ #include "../../include/philo_check.h"
+ #include "../../include/philo_bench.h"
+ #include <stdlib.h>
+ #include <string.h>
+ #include <unistd.h>
+
+ /**
+  * @internal
+  * @brief Print the usage message to stderr.
+  *
+  * @ingroup philosopher_check
+  */
+ static void	check_usage(void)
+ {
+	 fprintf(stderr, "Usage: philo-check [-t tolerance_ms] [-w death_window_ms]"
+		 " [-r reports] [-o] [-q]\n"
+		 "                   [-f log | -s shm_name] [N time_to_die time_to_eat"
+		 " time_to_sleep [meals]]\n"
+		 "  -o  accept a log that ends without a death or the end message\n"
+		 "  -q  print nothing, only set the exit status\n"
+		 "  -s  follow the shared memory stream of philo --format=shm\n");
+ }
+ 
+ /**
+  * @internal
+  * @brief Read the optional positional `philo` parameters.
+  *
+  * @param rules Rules to fill.
+  * @param argc Number of positional arguments.
+  * @param argv Positional arguments.
+  * @return 0 on success, -1 on a wrong count or value.
+  *
+  * @ingroup philosopher_check
+  */
+ static int	read_parameters(t_check_rules *rules, int argc, char **argv)
+ {
+	 if (argc == 0)
+		 return (0);
+	 if (argc < 4 || argc > 5)
+		 return (-1);
+	 rules->philosopher_count = atoi(argv[0]);
+	 rules->time_to_die = atoi(argv[1]);
+	 rules->time_to_eat = atoi(argv[2]);
+	 rules->time_to_sleep = atoi(argv[3]);
+	 if (argc == 5)
+		 rules->must_eat_count = atoi(argv[4]);
+	 if (rules->philosopher_count < 1 || rules->time_to_die < 1)
+		 return (-1);
+	 return (0);
+ }
+ 
+ /**
+  * @internal
+  * @brief Apply one option to the checker.
+  *
+  * @param check Checker prepared with `check_defaults`.
+  * @param opt Option letter returned by `getopt`.
+  * @param source Log path and shared memory object name.
+  * @return 0 on success, -1 on an unknown option.
+  *
+  * @ingroup philosopher_check
+  */
+ static int	apply_check_option(t_check *check, int opt, const char **source)
+ {
+	 if (opt == 't')
+		 check->rules.tolerance = atoi(optarg);
+	 else if (opt == 'w')
+		 check->rules.death_window = atoi(optarg);
+	 else if (opt == 'r')
+		 check->max_report = atol(optarg);
+	 else if (opt == 'o')
+		 check->rules.open_ended = true;
+	 else if (opt == 'q')
+		 check->report = NULL;
+	 else if (opt == 'f')
+		 source[0] = optarg;
+	 else if (opt == 's')
+		 source[1] = optarg;
+	 else
+		 return (-1);
+	 return (0);
+ }
+ 
+ /**
+  * @internal
+  * @brief Parse all options into the checker.
+  *
+  * @param check Checker prepared with `check_defaults`.
+  * @param argc Argument count.
+  * @param argv Argument vector.
+  * @param source Receives the log path (`"-"` for stdin) and the shared
+  * memory object name (NULL unless `-s` is given).
+  * @return 0 on success, -1 on a usage error.
+  *
+  * @ingroup philosopher_check
+  */
+ static int	parse_check_options(t_check *check, int argc, char **argv,
+		 const char **source)
+ {
+	 int	opt;
+ 
+	 source[0] = "-";
+	 source[1] = NULL;
+	 check->report = stdout;
+	 opt = getopt(argc, argv, "t:w:r:oqf:s:");
+	 while (opt != -1)
+	 {
+		 if (apply_check_option(check, opt, source) == -1)
+			 return (-1);
+		 opt = getopt(argc, argv, "t:w:r:oqf:s:");
+	 }
+	 return (read_parameters(&check->rules, argc - optind, argv + optind));
+ }
+ 
+ /**
+  * @brief Validate a `philo` log or trace.
+  *
+  * @param argc Argument count.
+  * @param argv Argument vector.
+  * @return 0 if valid, 1 on violations, 2 on usage or input errors.
+  *
+  * @ingroup philosopher_check
+  */
+ int	main(int argc, char **argv)
+ {
+	 t_check		check;
+	 const char	*source[2];
+	 double		start;
+	 int			status;
+ 
+	 check_defaults(&check);
+	 if (parse_check_options(&check, argc, argv, source) == -1)
+	 {
+		 check_usage();
+		 return (2);
+	 }
+	 start = bench_clock();
+	 if (source[1])
+		 status = check_shm(&check, source[1]);
+	 else
+		 status = check_file(&check, source[0]);
+	 print_check_error(status);
+	 if (status == 0 && check.report)
+		 print_check_summary(&check, bench_clock() - start);
+	 check_free(&check);
+	 if (status)
+		 return (2);
+	 return (check.total_violations != 0);
+ }
+ 
\ No newline at end of file
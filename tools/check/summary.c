@@ -0,0 +1,78 @@
+/**
+ * @file summary.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief What `philo-check` prints once the log is read.
+ *
+ * @ingroup philosopher_check
+ */
+
+ #include "../../include/philo_check.h"
+
+ /**
+  * @internal
+  * @brief Print how the dinner ended and any events lost on the way.
+  *
+  * @param check Finished checker.
+  *
+  * @ingroup philosopher_check
+  */
+ static void	print_outcome(const t_check *check)
+ {
+	 if (check->death_id)
+		 printf("  outcome: philosopher %d died at %lld ms, %lld ms after "
+			 "the deadline\n", check->death_id, check->death_time,
+			 check->death_delay);
+	 else if (check->ended)
+		 printf("  outcome: everybody ate enough\n");
+	 else
+		 printf("  outcome: none (log ends while the dinner runs)\n");
+	 if (check->dropped)
+		 printf("  dropped: %ld events overwritten before they were read;"
+			 " later violations may be spurious\n", check->dropped);
+ }
+ 
+ /**
+  * @brief Print the outcome, throughput and per-kind violation counts.
+  *
+  * @param check Finished checker.
+  * @param seconds Wall time spent checking.
+  *
+  * @ingroup philosopher_check
+  */
+ void	print_check_summary(const t_check *check, double seconds)
+ {
+	 double	rate;
+	 int		kind;
+ 
+	 rate = 0;
+	 if (seconds > 0)
+		 rate = check->bytes / 1e6 / seconds;
+	 printf("philo-check: %ld events, %ld meals, %.1f MB in %.2f s "
+		 "(%.0f MB/s)\n", check->events, check->meals, check->bytes / 1e6,
+		 seconds, rate);
+	 print_outcome(check);
+	 printf("  violations: %ld\n", check->total_violations);
+	 kind = -1;
+	 while (++kind < CHECK_KINDS)
+		 if (check->violations[kind])
+			 printf("    %-14s %ld\n", check_kind_name(kind),
+				 check->violations[kind]);
+ }
+ 
+ /**
+  * @brief Explain why a log could not be checked.
+  *
+  * @param status Status returned by `check_file` or `check_shm`.
+  *
+  * @ingroup philosopher_check
+  */
+ void	print_check_error(int status)
+ {
+	 if (status == -2)
+		 fprintf(stderr, "philo-check: run parameters unknown (give N die eat"
+			 " sleep [meals]) or unsupported trace\n");
+	 else if (status == -1)
+		 perror("philo-check");
+ }
+ 
\ No newline at end of file
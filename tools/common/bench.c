@@ -0,0 +1,164 @@
+/**
+ * @file bench.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Synchronous, CPU-pinned and timed `philo` runs.
+ *
+ * @details
+ * Used by the measurement tools, which run one configuration at a time so
+ * that runs never compete with each other for the CPUs being measured.
+ *
+ * @ingroup philosopher_bench
+ */
+
+ #define _GNU_SOURCE
+ #include "../../include/philo_bench.h"
+ #include <fcntl.h>
+ #include <sched.h>
+ #include <signal.h>
+ #include <string.h>
+ #include <sys/resource.h>
+ #include <sys/wait.h>
+ #include <unistd.h>
+ 
+ /**
+  * @brief Clear a run: no arguments, both streams discarded, every CPU.
+  *
+  * @param run Run to reset.
+  *
+  * @ingroup philosopher_bench
+  */
+ void	bench_init(t_bench_run *run)
+ {
+	 memset(run, 0, sizeof(*run));
+	 run->out_fd = -1;
+ }
+ 
+ /**
+  * @internal
+  * @brief Restrict the calling process to the first `cpus` allowed CPUs.
+  *
+  * @param cpus Number of CPUs to keep, 0 to keep them all.
+  * @return 0 on success, -1 on failure.
+  *
+  * @ingroup philosopher_bench
+  */
+ static int	pin_to_cpus(int cpus)
+ {
+	 cpu_set_t	allowed;
+	 cpu_set_t	kept;
+	 int			cpu;
+ 
+	 if (cpus <= 0)
+		 return (0);
+	 if (sched_getaffinity(0, sizeof(allowed), &allowed) == -1)
+		 return (-1);
+	 CPU_ZERO(&kept);
+	 cpu = -1;
+	 while (++cpu < CPU_SETSIZE && CPU_COUNT(&kept) < cpus)
+		 if (CPU_ISSET(cpu, &allowed))
+			 CPU_SET(cpu, &kept);
+	 return (sched_setaffinity(0, sizeof(kept), &kept));
+ }
+ 
+ /**
+  * @internal
+  * @brief Replace the child image with the run's binary.
+  *
+  * @details
+  * Runs in the forked child: joins its own process group, pins itself,
+  * redirects stdout and stderr, then `exec`s. Never returns.
+  *
+  * @param run Run to execute.
+  *
+  * @ingroup philosopher_bench
+  */
+ static void	exec_bench(t_bench_run *run)
+ {
+	 int	out;
+	 int	err;
+ 
+	 setpgid(0, 0);
+	 out = open("/dev/null", O_WRONLY);
+	 if (run->out_path)
+		 out = open(run->out_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	 if (run->out_fd >= 0)
+		 out = run->out_fd;
+	 err = open("/dev/null", O_WRONLY);
+	 if (run->err_path)
+		 err = open(run->err_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	 if (out == -1 || err == -1 || pin_to_cpus(run->cpus) == -1
+		 || dup2(out, 1) == -1 || dup2(err, 2) == -1)
+		 _exit(127);
+	 execv(run->argv[0], run->argv);
+	 _exit(127);
+ }
+ 
+ /**
+  * @internal
+  * @brief Wait for the child, killing its process group once overdue.
+  *
+  * @param run Run being executed; `status` and `killed` are filled in.
+  * @param pid The child.
+  * @param start When the child was forked (s).
+  * @param usage Receives the child's resource usage.
+  * @return The reaped pid, or -1 if `wait4` failed.
+  *
+  * @ingroup philosopher_bench
+  */
+ static pid_t	watch_child(t_bench_run *run, pid_t pid, double start,
+		 struct rusage *usage)
+ {
+	 pid_t	done;
+ 
+	 done = wait4(pid, &run->status, WNOHANG, usage);
+	 while (done == 0)
+	 {
+		 if (!run->killed && bench_clock() - start > run->timeout / 1e3)
+		 {
+			 kill(-pid, SIGKILL);
+			 kill(pid, SIGKILL);
+			 run->killed = true;
+		 }
+		 usleep(1000);
+		 done = wait4(pid, &run->status, WNOHANG, usage);
+	 }
+	 return (done);
+ }
+ 
+ /**
+  * @brief Execute a run to completion and measure it.
+  *
+  * @details
+  * Polls the child every millisecond and kills its process group once
+  * `timeout` ms have passed. `wall` covers fork to reap; `cpu` is the user
+  * and system time `wait4` reports for the child and all its threads.
+  *
+  * @param run Run to execute; its result fields are filled in.
+  * @return 0 on success, -1 if `fork` or `wait4` failed.
+  *
+  * @ingroup philosopher_bench
+  */
+ int	bench_run(t_bench_run *run)
+ {
+	 struct rusage	usage;
+	 double			start;
+	 pid_t			pid;
+	 pid_t			done;
+ 
+	 run->killed = false;
+	 start = bench_clock();
+	 pid = fork();
+	 if (pid == -1)
+		 return (-1);
+	 if (pid == 0)
+		 exec_bench(run);
+	 done = watch_child(run, pid, start, &usage);
+	 run->wall = bench_clock() - start;
+	 run->cpu = usage.ru_utime.tv_sec + usage.ru_utime.tv_usec / 1e6
+		 + usage.ru_stime.tv_sec + usage.ru_stime.tv_usec / 1e6;
+	 if (done == -1)
+		 return (-1);
+	 return (0);
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,127 @@
+/**
+ * @file check_chunks.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Buffered input handed to the text or binary reader.
+ *
+ * @details
+ * The stream reader keeps one fixed buffer; these functions check what it
+ * holds, keep the trailing partial line or record, and deal with what is
+ * left at end of input.
+ *
+ * @ingroup philosopher_check
+ */
+
+ #include "../../include/philo_check.h"
+ #include "../../include/philo.h"
+
+ /**
+  * @internal
+  * @brief Check every complete record of a buffer.
+  *
+  * @param check Checker.
+  * @param buffer Data read so far.
+  * @param len Number of valid bytes.
+  * @return Number of bytes consumed (a trailing partial record is kept).
+  *
+  * @ingroup philosopher_check
+  */
+ static size_t	check_binary_chunk(t_check *check, const char *buffer,
+		 size_t len)
+ {
+	 t_trace_event	event;
+	 size_t			done;
+ 
+	 done = 0;
+	 while (len - done >= sizeof(event))
+	 {
+		 memcpy(&event, buffer + done, sizeof(event));
+		 check->position++;
+		 check_event(check, &event);
+		 done += sizeof(event);
+	 }
+	 return (done);
+ }
+ 
+ /**
+  * @brief Take the run parameters from a binary trace header.
+  *
+  * @details
+  * Parameters already set by the caller win over the header's.
+  *
+  * @param check Checker whose unknown rules are filled in.
+  * @param header Header read from the stream.
+  * @return 0 on success, -1 for an unsupported version.
+  *
+  * @ingroup philosopher_check
+  */
+ int	check_header(t_check *check, const t_trace_header *header)
+ {
+	 t_check_rules	*rules;
+ 
+	 if (header->version != TRACE_VERSION)
+		 return (-1);
+	 rules = &check->rules;
+	 check->binary = true;
+	 if (!rules->philosopher_count)
+		 rules->philosopher_count = header->philosopher_count;
+	 if (!rules->time_to_die)
+		 rules->time_to_die = header->time_to_die;
+	 if (!rules->time_to_eat)
+		 rules->time_to_eat = header->time_to_eat;
+	 if (!rules->time_to_sleep)
+		 rules->time_to_sleep = header->time_to_sleep;
+	 if (rules->must_eat_count < 0)
+		 rules->must_eat_count = header->must_eat_count;
+	 return (0);
+ }
+ 
+ /**
+  * @brief Check every complete line or record of the buffer.
+  *
+  * @details
+  * The checked bytes are dropped and the rest moved to the front. A full
+  * buffer without a single complete line is reported and dropped.
+  *
+  * @param check Checker.
+  * @param buffer Buffer of CHECK_BUFFER bytes.
+  * @param len Number of valid bytes.
+  * @return Number of bytes left in the buffer.
+  *
+  * @ingroup philosopher_check
+  */
+ size_t	check_chunk(t_check *check, char *buffer, size_t len)
+ {
+	 size_t	used;
+ 
+	 if (check->binary)
+		 used = check_binary_chunk(check, buffer, len);
+	 else
+		 used = check_text_chunk(check, buffer, len);
+	 if (used == 0 && len == CHECK_BUFFER)
+	 {
+		 check_violation(check, CHECK_FORMAT, "line too long");
+		 used = len;
+	 }
+	 memmove(buffer, buffer + used, len - used);
+	 return (len - used);
+ }
+ 
+ /**
+  * @brief Handle the bytes left at end of input and close the check.
+  *
+  * @param check Checker.
+  * @param buffer Buffer holding the leftover bytes.
+  * @param len Number of leftover bytes.
+  *
+  * @ingroup philosopher_check
+  */
+ void	check_tail(t_check *check, const char *buffer, size_t len)
+ {
+	 if (len && check->binary)
+		 check_violation(check, CHECK_FORMAT, "truncated record");
+	 else if (len)
+		 check_text_line(check, buffer, buffer + len);
+	 check_finish(check);
+ }
+ 
\ No newline at end of file
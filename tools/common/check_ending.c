@@ -0,0 +1,118 @@
+/**
+ * @file check_ending.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Checks of the final event of a `philo` log.
+ *
+ * @details
+ * A log ends with one death or with the end message. Either way, nobody
+ * may have starved long before it without being reported.
+ *
+ * @ingroup philosopher_check
+ */
+
+ #include "../../include/philo_check.h"
+ #include <stdio.h>
+
+ /**
+  * @internal
+  * @brief Flag every philosopher whose deadline passed long before `time`.
+  *
+  * @details
+  * Called when the log ends with a death or the end message: anybody whose
+  * latest possible deadline plus `death_window` lies before that moment
+  * starved unnoticed.
+  *
+  * @param check Checker.
+  * @param time Timestamp of the final event.
+  *
+  * @ingroup philosopher_check
+  */
+ static void	check_missed_deaths(t_check *check, long long time)
+ {
+	 char		message[CHECK_MESSAGE];
+	 long long	deadline;
+	 int			i;
+ 
+	 i = -1;
+	 while (++i < check->rules.philosopher_count)
+	 {
+		 deadline = check->seats[i].meal_end_max + check->rules.time_to_die;
+		 if (i + 1 != check->death_id
+			 && time > deadline + check->rules.death_window)
+		 {
+			 snprintf(message, CHECK_MESSAGE, "philosopher %d starved since "
+				 "%lld ms without dying", i + 1, deadline);
+			 check_violation(check, CHECK_MISSED_DEATH, message);
+		 }
+	 }
+ }
+ 
+ /**
+  * @brief Check a death against the philosopher's starvation deadline.
+  *
+  * @param check Checker.
+  * @param seat Seat of the philosopher who died.
+  * @param event The event.
+  *
+  * @ingroup philosopher_check
+  */
+ void	check_death(t_check *check, t_seat *seat,
+		 const t_trace_event *event)
+ {
+	 char	message[CHECK_MESSAGE];
+ 
+	 check->death_id = event->id;
+	 check->death_time = event->time;
+	 check->death_delay = event->time - seat->meal_end_max
+		 - check->rules.time_to_die;
+	 if (event->time < seat->meal_end_min + check->rules.time_to_die)
+	 {
+		 snprintf(message, CHECK_MESSAGE, "died %lld ms before the deadline",
+			 seat->meal_end_min + check->rules.time_to_die - event->time);
+		 check_violation(check, CHECK_DEATH_TIME, message);
+	 }
+	 else if (check->death_delay > check->rules.death_window)
+	 {
+		 snprintf(message, CHECK_MESSAGE, "death printed %lld ms after the "
+			 "deadline", check->death_delay);
+		 check_violation(check, CHECK_DEATH_TIME, message);
+	 }
+	 check_missed_deaths(check, event->time);
+ }
+ 
+ /**
+  * @brief Check the end message: everybody must have eaten enough.
+  *
+  * @details
+  * A philosopher still eating counts that meal, since the quota is counted
+  * when a meal ends and its "is sleeping" line is suppressed by the end.
+  *
+  * @param check Checker.
+  * @param event The event.
+  *
+  * @ingroup philosopher_check
+  */
+ void	check_end(t_check *check, const t_trace_event *event)
+ {
+	 char	message[CHECK_MESSAGE];
+	 long	meals;
+	 int		i;
+ 
+	 check->ended = true;
+	 i = -1;
+	 while (check->rules.must_eat_count > 0
+		 && ++i < check->rules.philosopher_count)
+	 {
+		 meals = check->seats[i].meals
+			 + (check->seats[i].state == SEAT_EATING);
+		 if (meals < check->rules.must_eat_count)
+		 {
+			 snprintf(message, CHECK_MESSAGE, "philosopher %d ate %ld of %d "
+				 "meals", i + 1, meals, check->rules.must_eat_count);
+			 check_violation(check, CHECK_SEQUENCE, message);
+		 }
+	 }
+	 check_missed_deaths(check, event->time);
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,104 @@
+/**
+ * @file check_follow.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Reading a mapped `philo --format=shm` stream slot by slot.
+ *
+ * @details
+ * The reader polls `head` when caught up. Events overwritten before they
+ * could be read are skipped and counted in `dropped`; nothing here ever
+ * slows the producer down.
+ *
+ * @ingroup philosopher_check
+ */
+
+ #include "../../include/philo_check.h"
+ #include <string.h>
+ #include <unistd.h>
+
+ #define SHM_POLL_US		100
+ 
+ /**
+  * @internal
+  * @brief Copy event `next` out of the ring if it is still there.
+  *
+  * @param stream Mapped stream.
+  * @param next Event number, below `head`.
+  * @param event Receives the record.
+  * @return true if the copy is event `next`, false if its slot was reused.
+  *
+  * @ingroup philosopher_check
+  */
+ static bool	read_slot(const t_shm_stream *stream, uint64_t next,
+		 t_trace_event *event)
+ {
+	 const t_shm_slot	*slot;
+	 uint64_t			seq;
+ 
+	 slot = &stream->slots[next % SHM_SLOTS];
+	 seq = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+	 memcpy(event, &slot->event, sizeof(*event));
+	 __atomic_thread_fence(__ATOMIC_ACQUIRE);
+	 return (seq == next + 1
+		 && __atomic_load_n(&slot->seq, __ATOMIC_RELAXED) == seq);
+ }
+ 
+ /**
+  * @internal
+  * @brief Jump past events lost to the producer and count them.
+  *
+  * @details
+  * The reader lands half a ring behind `head` so it has room to catch up.
+  *
+  * @param check Checker whose `dropped` count grows.
+  * @param stream Mapped stream.
+  * @param next Event the reader could not read.
+  * @return The next event to read.
+  *
+  * @ingroup philosopher_check
+  */
+ static uint64_t	skip_lost(t_check *check, const t_shm_stream *stream,
+		 uint64_t next)
+ {
+	 uint64_t	head;
+ 
+	 head = __atomic_load_n(&stream->head, __ATOMIC_ACQUIRE);
+	 check->dropped += head - SHM_SLOTS / 2 - next;
+	 return (head - SHM_SLOTS / 2);
+ }
+ 
+ /**
+  * @brief Check every event published until the stream is closed.
+  *
+  * @param check Started checker.
+  * @param stream Mapped stream.
+  *
+  * @ingroup philosopher_check
+  */
+ void	follow_stream(t_check *check, const t_shm_stream *stream)
+ {
+	 t_trace_event	event;
+	 uint64_t		next;
+	 uint64_t		head;
+ 
+	 next = 0;
+	 while (true)
+	 {
+		 head = __atomic_load_n(&stream->head, __ATOMIC_ACQUIRE);
+		 if (next == head && __atomic_load_n(&stream->closed, __ATOMIC_ACQUIRE)
+			 && next == __atomic_load_n(&stream->head, __ATOMIC_ACQUIRE))
+			 break ;
+		 if (next == head)
+			 usleep(SHM_POLL_US);
+		 else if (read_slot(stream, next, &event))
+		 {
+			 check->position++;
+			 check->bytes += sizeof(event);
+			 check_event(check, &event);
+			 next++;
+		 }
+		 else
+			 next = skip_lost(check, stream, next);
+	 }
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,109 @@
+/**
+ * @file check_forks.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Fork ownership checks of a `philo` log.
+ *
+ * @details
+ * Every fork remembers who took it last. Fork releases are never logged,
+ * so a fork counts as free again once its holder's meal has ended.
+ *
+ * @ingroup philosopher_check
+ */
+
+ #include "../../include/philo_check.h"
+ #include <stdio.h>
+
+ /**
+  * @internal
+  * @brief Record that a philosopher now holds a fork.
+  *
+  * @details
+  * The previous holder may only have let go once its meal was over, i.e.
+  * not before its meal start plus `time_to_eat`, and never while it has not
+  * started eating yet.
+  *
+  * @param check Checker.
+  * @param id Philosopher taking the fork.
+  * @param fork Fork index.
+  * @param time When the fork was taken.
+  *
+  * @ingroup philosopher_check
+  */
+ static void	claim_fork(t_check *check, int id, int fork, long long time)
+ {
+	 char	message[CHECK_MESSAGE];
+	 int		holder;
+	 t_seat	*seat;
+ 
+	 holder = check->holders[fork];
+	 if (holder)
+	 {
+		 seat = &check->seats[holder - 1];
+		 if (holder == id || seat->state == SEAT_THINKING
+			 || (seat->state == SEAT_EATING
+				 && time < seat->since + check->rules.time_to_eat))
+		 {
+			 snprintf(message, CHECK_MESSAGE, "philosopher %d takes fork %d "
+				 "still held by philosopher %d", id, fork, holder);
+			 check_violation(check, CHECK_FORK, message);
+		 }
+	 }
+	 check->holders[fork] = id;
+ }
+ 
+ /**
+  * @brief Check a "has taken a fork" event.
+  *
+  * @details
+  * Binary traces name the fork, which must be beside the philosopher.
+  * Text logs do not, so both forks are claimed on the second take.
+  *
+  * @param check Checker.
+  * @param event The event.
+  *
+  * @ingroup philosopher_check
+  */
+ void	check_take(t_check *check, const t_trace_event *event)
+ {
+	 t_seat	*seat;
+	 int		left;
+	 int		right;
+ 
+	 seat = &check->seats[event->id - 1];
+	 left = event->id - 1;
+	 right = event->id % check->rules.philosopher_count;
+	 if (++seat->forks > 2)
+		 check_violation(check, CHECK_FORK, "a third fork is taken");
+	 if (event->fork >= 0 && event->fork != left && event->fork != right)
+		 check_violation(check, CHECK_FORK, "the fork is not beside them");
+	 else if (event->fork >= 0)
+		 claim_fork(check, event->id, event->fork, event->time);
+	 else if (seat->forks == 2)
+	 {
+		 claim_fork(check, event->id, left, event->time);
+		 if (right != left)
+			 claim_fork(check, event->id, right, event->time);
+	 }
+ }
+ 
+ /**
+  * @brief Let go of the forks a philosopher holds, once its meal ended.
+  *
+  * @param check Checker.
+  * @param id Philosopher who fell asleep.
+  *
+  * @ingroup philosopher_check
+  */
+ void	drop_forks(t_check *check, int id)
+ {
+	 int	right;
+ 
+	 right = id % check->rules.philosopher_count;
+	 check->seats[id - 1].forks = 0;
+	 if (check->holders[id - 1] == id)
+		 check->holders[id - 1] = 0;
+	 if (check->holders[right] == id)
+		 check->holders[right] = 0;
+ }
+ 
\ No newline at end of file
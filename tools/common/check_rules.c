@@ -0,0 +1,166 @@
+/**
+ * @file check_rules.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Event-by-event invariant checks of a `philo` log.
+ *
+ * @details
+ * Every bound used here follows from the order of operations in
+ * `dinner_routine`: a meal's timestamp is taken before `advance_time`
+ * starts, forks are released only after it returns, and each later line is
+ * timestamped after the step it reports. Meal ends and fork releases are
+ * never logged, so they are bracketed between the earliest possible time
+ * (meal start plus `time_to_eat`) and the next line of that philosopher.
+ *
+ * @ingroup philosopher_check
+ */
+
+ #include "../../include/philo_check.h"
+ #include <string.h>
+
+ /**
+  * @internal
+  * @brief Close a meal on "is sleeping" and release its forks.
+  *
+  * @details
+  * The meal must have lasted at least `time_to_eat` and at most
+  * `tolerance` more. If its earliest possible end is past the previous
+  * deadline, the philosopher outlived a starvation nobody reported.
+  *
+  * @param check Checker.
+  * @param seat Seat of the philosopher.
+  * @param event The event.
+  *
+  * @ingroup philosopher_check
+  */
+ static void	check_sleep(t_check *check, t_seat *seat,
+		 const t_trace_event *event)
+ {
+	 char		message[CHECK_MESSAGE];
+	 long long	lasted;
+ 
+	 if (seat->state != SEAT_EATING)
+	 {
+		 check_violation(check, CHECK_SEQUENCE, "sleeps without having eaten");
+		 return ;
+	 }
+	 lasted = event->time - seat->since;
+	 snprintf(message, CHECK_MESSAGE, "meal lasted %lld ms", lasted);
+	 if (lasted < check->rules.time_to_eat
+		 || lasted > check->rules.time_to_eat + check->rules.tolerance)
+		 check_violation(check, CHECK_EAT_TIME, message);
+	 if (seat->since + check->rules.time_to_eat > seat->meal_end_max
+		 + check->rules.time_to_die + check->rules.death_window)
+		 check_violation(check, CHECK_MISSED_DEATH, "finished a meal after "
+			 "starving");
+	 seat->meal_end_min = seat->since + check->rules.time_to_eat;
+	 seat->meal_end_max = event->time;
+	 seat->meals++;
+	 check->meals++;
+	 drop_forks(check, event->id);
+ }
+ 
+ /**
+  * @internal
+  * @brief Check "is eating" and "is thinking" transitions.
+  *
+  * @details
+  * Eating needs two forks. Waking up to think must come at least
+  * `time_to_sleep` after falling asleep, and at most `think_slack` plus
+  * `tolerance` later than that.
+  *
+  * @param check Checker.
+  * @param seat Seat of the philosopher.
+  * @param event The event.
+  *
+  * @ingroup philosopher_check
+  */
+ static void	check_eat_or_think(t_check *check, t_seat *seat,
+		 const t_trace_event *event)
+ {
+	 char		message[CHECK_MESSAGE];
+	 long long	slept;
+ 
+	 if (event->kind == TRACE_EAT && seat->forks != 2)
+	 {
+		 snprintf(message, CHECK_MESSAGE, "eats with %d fork(s)", seat->forks);
+		 check_violation(check, CHECK_SEQUENCE, message);
+	 }
+	 if (seat->state == SEAT_EATING)
+		 check_violation(check, CHECK_SEQUENCE, "was already eating");
+	 if (event->kind == TRACE_THINK && seat->state == SEAT_SLEEPING)
+	 {
+		 slept = event->time - seat->since;
+		 snprintf(message, CHECK_MESSAGE, "slept for %lld ms", slept);
+		 if (slept < check->rules.time_to_sleep
+			 || slept > check->rules.time_to_sleep + check->rules.think_slack
+			 + check->rules.tolerance)
+			 check_violation(check, CHECK_SLEEP_TIME, message);
+	 }
+ }
+ 
+ /**
+  * @internal
+  * @brief Check timestamp order and dispatch a philosopher event.
+  *
+  * @param check Checker.
+  * @param event Event of a known philosopher and kind.
+  *
+  * @ingroup philosopher_check
+  */
+ static void	check_seat_event(t_check *check, const t_trace_event *event)
+ {
+	 t_seat	*seat;
+ 
+	 if (event->time < check->last_time)
+		 check_violation(check, CHECK_TIME_ORDER, "timestamp goes backwards");
+	 else
+		 check->last_time = event->time;
+	 seat = &check->seats[event->id - 1];
+	 if (event->kind == TRACE_TAKE)
+		 check_take(check, event);
+	 else if (event->kind == TRACE_DIE)
+		 check_death(check, seat, event);
+	 else if (event->kind == TRACE_SLEEP)
+		 check_sleep(check, seat, event);
+	 else
+		 check_eat_or_think(check, seat, event);
+	 if (event->kind == TRACE_TAKE || event->kind == TRACE_DIE)
+		 return ;
+	 seat->state = SEAT_SLEEPING;
+	 if (event->kind == TRACE_EAT)
+		 seat->state = SEAT_EATING;
+	 else if (event->kind == TRACE_THINK)
+		 seat->state = SEAT_THINKING;
+	 seat->since = event->time;
+ }
+ 
+ /**
+  * @brief Check one event against the rules and the state so far.
+  *
+  * @details
+  * Rejects anything after a death or the end message, ids out of range and
+  * unknown kinds, then checks timestamp order and dispatches on the kind.
+  * END events may carry id 0 (the text end message names nobody).
+  *
+  * @param check Checker started with `check_start`.
+  * @param event Event to check.
+  *
+  * @ingroup philosopher_check
+  */
+ void	check_event(t_check *check, const t_trace_event *event)
+ {
+	 check->events++;
+	 if (check->death_id || check->ended)
+		 check_violation(check, CHECK_AFTER_END, "printed after the dinner "
+			 "ended");
+	 else if (event->kind == TRACE_END)
+		 check_end(check, event);
+	 else if (event->id < 1
+		 || event->id > (uint32_t) check->rules.philosopher_count
+		 || event->kind < TRACE_TAKE || event->kind > TRACE_DIE)
+		 check_violation(check, CHECK_FORMAT, "unknown philosopher or action");
+	 else
+		 check_seat_event(check, event);
+ }
+ 
\ No newline at end of file
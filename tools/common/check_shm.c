@@ -0,0 +1,125 @@
+/**
+ * @file check_shm.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Checking of a live `philo --format=shm` stream.
+ *
+ * @details
+ * The consumer side of the protocol described in philo_shm.h: the object
+ * is mapped read-only, then followed slot by slot (see check_follow.c).
+ *
+ * @ingroup philosopher_check
+ */
+
+ #include "../../include/philo_check.h"
+ #include <errno.h>
+ #include <fcntl.h>
+ #include <string.h>
+ #include <sys/mman.h>
+ #include <sys/stat.h>
+ #include <unistd.h>
+
+ #define SHM_ATTACH_MS	10000
+ 
+ /**
+  * @internal
+  * @brief Map a stream if `philo` has created and announced it.
+  *
+  * @param name Shared memory object name.
+  * @return The mapping, or MAP_FAILED if the object is missing, short or
+  * not announced yet.
+  *
+  * @ingroup philosopher_check
+  */
+ static t_shm_stream	*try_attach(const char *name)
+ {
+	 t_shm_stream	*stream;
+	 struct stat		status;
+	 int				fd;
+ 
+	 stream = MAP_FAILED;
+	 fd = shm_open(name, O_RDONLY, 0);
+	 if (fd != -1 && fstat(fd, &status) == 0
+		 && status.st_size >= (off_t) sizeof(t_shm_stream))
+		 stream = mmap(NULL, sizeof(t_shm_stream), PROT_READ, MAP_SHARED,
+				 fd, 0);
+	 if (fd != -1)
+		 close(fd);
+	 if (stream != MAP_FAILED
+		 && !__atomic_load_n(&stream->version, __ATOMIC_ACQUIRE))
+	 {
+		 munmap(stream, sizeof(t_shm_stream));
+		 stream = MAP_FAILED;
+	 }
+	 return (stream);
+ }
+ 
+ /**
+  * @internal
+  * @brief Map a stream once `philo` has created and announced it.
+  *
+  * @details
+  * Waits for the object to exist, to have its full size and a non-zero
+  * `version`, for up to SHM_ATTACH_MS, so the checker may be started
+  * before `philo`.
+  *
+  * @param name Shared memory object name.
+  * @return The mapping, or MAP_FAILED (`errno` set) on failure.
+  *
+  * @ingroup philosopher_check
+  */
+ static t_shm_stream	*attach_stream(const char *name)
+ {
+	 t_shm_stream	*stream;
+	 int				waited;
+ 
+	 stream = MAP_FAILED;
+	 waited = 0;
+	 while (stream == MAP_FAILED && waited++ < SHM_ATTACH_MS)
+	 {
+		 stream = try_attach(name);
+		 if (stream == MAP_FAILED)
+			 usleep(1000);
+	 }
+	 if (stream == MAP_FAILED && !errno)
+		 errno = ETIMEDOUT;
+	 return (stream);
+ }
+ 
+ /**
+  * @brief Check a `philo --format=shm` stream as it is published.
+  *
+  * @details
+  * Returns once `philo` has closed the stream and every event left in it
+  * has been read, then runs `check_finish`.
+  *
+  * @param check Checker prepared with `check_defaults` and any known rules.
+  * @param name Shared memory object name, as given to `--shm-name`.
+  * @return 0 on success, -1 if the stream cannot be attached, -2 on an
+  * unsupported stream or missing parameters.
+  *
+  * @ingroup philosopher_check
+  */
+ int	check_shm(t_check *check, const char *name)
+ {
+	 t_shm_stream	*stream;
+	 int				status;
+ 
+	 errno = 0;
+	 stream = attach_stream(name);
+	 if (stream == MAP_FAILED)
+		 return (-1);
+	 status = -2;
+	 if (!memcmp(stream->magic, SHM_MAGIC, sizeof(stream->magic))
+		 && stream->version == SHM_VERSION && stream->slot_count == SHM_SLOTS
+		 && check_header(check, &stream->header) == 0)
+		 status = 2 * check_start(check);
+	 if (status == 0)
+	 {
+		 follow_stream(check, stream);
+		 check_finish(check);
+	 }
+	 munmap(stream, sizeof(t_shm_stream));
+	 return (status);
+ }
+ 
\ No newline at end of file
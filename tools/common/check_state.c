@@ -0,0 +1,103 @@
+/**
+ * @file check_state.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Lifecycle and violation bookkeeping of a `t_check`.
+ *
+ * @details
+ * Sets default rules, allocates the per-philosopher and per-fork state,
+ * records violations and runs the end-of-stream checks.
+ *
+ * @ingroup philosopher_check
+ */
+
+ #include "../../include/philo_check.h"
+ #include <stdlib.h>
+ #include <string.h>
+
+ /**
+  * @brief Reset a checker to default rules and empty results.
+  *
+  * @details
+  * Timings are left unknown (zero), the meal quota disabled, durations
+  * tolerated within 10 ms and deaths expected within 10 ms of the deadline.
+  * `think_slack` is derived from the table parity by `check_start`.
+  *
+  * @param check Checker to reset.
+  *
+  * @ingroup philosopher_check
+  */
+ void	check_defaults(t_check *check)
+ {
+	 memset(check, 0, sizeof(*check));
+	 check->rules.must_eat_count = -1;
+	 check->rules.tolerance = 10;
+	 check->rules.death_window = 10;
+	 check->rules.think_slack = -1;
+	 check->max_report = 10;
+ }
+ 
+ /**
+  * @brief Allocate seats and fork holders once the rules are known.
+  *
+  * @param check Checker with `rules` filled in.
+  * @return 0 on success, -1 if the rules are incomplete or allocation fails.
+  *
+  * @ingroup philosopher_check
+  */
+ int	check_start(t_check *check)
+ {
+	 t_check_rules	*rules;
+ 
+	 rules = &check->rules;
+	 if (rules->philosopher_count < 1 || rules->time_to_die < 1
+		 || rules->time_to_eat < 0 || rules->time_to_sleep < 0)
+		 return (-1);
+	 if (rules->think_slack < 0 && rules->philosopher_count % 2)
+		 rules->think_slack = rules->time_to_eat;
+	 else if (rules->think_slack < 0)
+		 rules->think_slack = 0;
+	 check->seats = calloc(rules->philosopher_count, sizeof(t_seat));
+	 check->holders = calloc(rules->philosopher_count, sizeof(int));
+	 if (!check->seats || !check->holders)
+	 {
+		 check_free(check);
+		 return (-1);
+	 }
+	 return (0);
+ }
+ 
+ /**
+  * @brief Release the memory held by a checker.
+  *
+  * @param check Checker to release.
+  *
+  * @ingroup philosopher_check
+  */
+ void	check_free(t_check *check)
+ {
+	 free(check->seats);
+	 free(check->holders);
+	 check->seats = NULL;
+	 check->holders = NULL;
+ }
+ 
+ /**
+  * @brief Run the end-of-stream checks.
+  *
+  * @details
+  * A log must end with a death or with the end message unless the rules
+  * declare it open-ended (for example a run that was stopped externally).
+  *
+  * @param check Checker.
+  *
+  * @ingroup philosopher_check
+  */
+ void	check_finish(t_check *check)
+ {
+	 if (check->death_id || check->ended || check->rules.open_ended)
+		 return ;
+	 check_violation(check, CHECK_UNFINISHED,
+		 "log ends without a death or the end message");
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,146 @@
+/**
+ * @file check_stream.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Streaming readers feeding text logs and binary traces to a checker.
+ *
+ * @details
+ * Input is read with plain `read` into one fixed 1 MiB buffer, so memory
+ * use does not depend on the log size. The format is detected from the
+ * first bytes: a binary trace starts with TRACE_MAGIC, anything else is
+ * parsed as text lines (see check_text.c).
+ *
+ * @ingroup philosopher_check
+ */
+
+ #include "../../include/philo_check.h"
+ #include "../../include/philo.h"
+ #include <fcntl.h>
+
+ /**
+  * @internal
+  * @brief Read more input after the `len` bytes already buffered.
+  *
+  * @param check Checker; its byte counter is updated.
+  * @param fd Input descriptor.
+  * @param buffer Buffer of CHECK_BUFFER bytes.
+  * @param len Bytes already in the buffer; updated.
+  * @return Bytes read (0 at end of input), or -1 on a read error.
+  *
+  * @ingroup philosopher_check
+  */
+ static ssize_t	refill(t_check *check, int fd, char *buffer, size_t *len)
+ {
+	 ssize_t	got;
+ 
+	 got = read(fd, buffer + *len, CHECK_BUFFER - *len);
+	 while (got == -1 && errno == EINTR)
+		 got = read(fd, buffer + *len, CHECK_BUFFER - *len);
+	 if (got > 0)
+	 {
+		 *len += got;
+		 check->bytes += got;
+	 }
+	 return (got);
+ }
+ 
+ /**
+  * @internal
+  * @brief Detect the format, apply a trace header and start the checker.
+  *
+  * @param check Checker.
+  * @param fd Input descriptor.
+  * @param buffer Buffer receiving the first bytes of the stream.
+  * @param len Bytes in the buffer; a header is removed from it.
+  * @return 0 on success, -1 on a read error, -2 on incomplete rules or a
+  * bad header.
+  *
+  * @ingroup philosopher_check
+  */
+ static int	open_stream(t_check *check, int fd, char *buffer, size_t *len)
+ {
+	 t_trace_header	header;
+	 ssize_t			got;
+ 
+	 got = 1;
+	 while (*len < sizeof(header) && got > 0)
+		 got = refill(check, fd, buffer, len);
+	 if (got == -1)
+		 return (-1);
+	 if (*len >= sizeof(header) && !memcmp(buffer, TRACE_MAGIC, 8))
+	 {
+		 memcpy(&header, buffer, sizeof(header));
+		 if (check_header(check, &header) == -1)
+			 return (-2);
+		 *len -= sizeof(header);
+		 memmove(buffer, buffer + sizeof(header), *len);
+	 }
+	 return (2 * check_start(check));
+ }
+ 
+ /**
+  * @brief Check a whole stream, in constant memory.
+  *
+  * @details
+  * Reads `fd` to the end, checking every event as soon as its line or
+  * record is complete, then runs `check_finish`. A final text line without
+  * newline is still checked.
+  *
+  * @param check Checker prepared with `check_defaults` and any known rules.
+  * @param fd Input descriptor.
+  * @return 0 on success, -1 on a read or allocation error, -2 on missing
+  * parameters or an unsupported trace.
+  *
+  * @ingroup philosopher_check
+  */
+ int	check_stream(t_check *check, int fd)
+ {
+	 char	*buffer;
+	 size_t	len;
+	 ssize_t	got;
+ 
+	 buffer = malloc(CHECK_BUFFER);
+	 if (!buffer)
+		 return (-1);
+	 len = 0;
+	 posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+	 got = open_stream(check, fd, buffer, &len);
+	 while (got >= 0)
+	 {
+		 len = check_chunk(check, buffer, len);
+		 got = refill(check, fd, buffer, &len);
+		 if (got == 0)
+			 break ;
+	 }
+	 if (got == 0)
+		 check_tail(check, buffer, len);
+	 free(buffer);
+	 if (got < 0)
+		 return (got);
+	 return (0);
+ }
+ 
+ /**
+  * @brief Check a log file, or stdin when `path` is `"-"`.
+  *
+  * @param check Checker prepared with `check_defaults`.
+  * @param path File to read.
+  * @return Same as `check_stream`.
+  *
+  * @ingroup philosopher_check
+  */
+ int	check_file(t_check *check, const char *path)
+ {
+	 int	fd;
+	 int	status;
+ 
+	 if (!strcmp(path, "-"))
+		 return (check_stream(check, 0));
+	 fd = open(path, O_RDONLY);
+	 if (fd == -1)
+		 return (-1);
+	 status = check_stream(check, fd);
+	 close(fd);
+	 return (status);
+ }
+ 
\ No newline at end of file
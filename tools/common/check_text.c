@@ -0,0 +1,157 @@
+/**
+ * @file check_text.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Parsing of text log lines for the checker.
+ *
+ * @details
+ * Lines are parsed in place, without `stdio` or `sscanf`: the reader
+ * hands over complete lines straight from its buffer.
+ *
+ * @ingroup philosopher_check
+ */
+
+ #include "../../include/philo_check.h"
+ #include "../../include/philo.h"
+
+ /**
+  * @internal
+  * @brief Parse a decimal number and advance the cursor past it.
+  *
+  * @param cursor Current position; moved past the digits.
+  * @param end End of the line.
+  * @return The number, or -1 if there is no digit.
+  *
+  * @ingroup philosopher_check
+  */
+ static long long	parse_number(const char **cursor, const char *end)
+ {
+	 long long	value;
+ 
+	 if (*cursor == end || **cursor < '0' || **cursor > '9')
+		 return (-1);
+	 value = 0;
+	 while (*cursor < end && **cursor >= '0' && **cursor <= '9')
+		 value = value * 10 + *(*cursor)++ - '0';
+	 return (value);
+ }
+ 
+ /**
+  * @internal
+  * @brief Identify the action text of a log line.
+  *
+  * @param text Start of the action.
+  * @param len Length of the action.
+  * @return The TRACE_* kind, or 0 if unknown.
+  *
+  * @ingroup philosopher_check
+  */
+ static uint32_t	parse_action(const char *text, size_t len)
+ {
+	 if (len == sizeof(TAKE) - 1 && !memcmp(text, TAKE, len))
+		 return (TRACE_TAKE);
+	 if (len == sizeof(EAT) - 1 && !memcmp(text, EAT, len))
+		 return (TRACE_EAT);
+	 if (len == sizeof(SLEEP) - 1 && !memcmp(text, SLEEP, len))
+		 return (TRACE_SLEEP);
+	 if (len == sizeof(THINK) - 1 && !memcmp(text, THINK, len))
+		 return (TRACE_THINK);
+	 if (len == sizeof(DIE) - 1 && !memcmp(text, DIE, len))
+		 return (TRACE_DIE);
+	 if (len == sizeof(END) - 1 && !memcmp(text, END, len))
+		 return (TRACE_END);
+	 return (0);
+ }
+ 
+ /**
+  * @internal
+  * @brief Parse a `"<time> <id> <action>"` line into an event.
+  *
+  * @param event Event to fill in.
+  * @param line Start of the line.
+  * @param end End of the line (the newline, excluded).
+  * @return true if the line is well formed.
+  *
+  * @ingroup philosopher_check
+  */
+ static bool	parse_text_line(t_trace_event *event, const char *line,
+		 const char *end)
+ {
+	 long long	time;
+	 long long	id;
+ 
+	 time = parse_number(&line, end);
+	 if (time >= 0 && line < end && *line == ' ')
+		 line++;
+	 id = parse_number(&line, end);
+	 event->kind = 0;
+	 if (time >= 0 && id >= 0 && line < end && *line++ == ' ')
+		 event->kind = parse_action(line, end - line);
+	 if (!event->kind || time > UINT32_MAX || id > UINT32_MAX)
+		 return (false);
+	 event->time = (uint32_t) time;
+	 event->id = (uint32_t) id;
+	 event->fork = -1;
+	 return (true);
+ }
+ 
+ /**
+  * @brief Turn one text line into an event and check it.
+  *
+  * @details
+  * Accepts `"<time> <id> <action>"` and the bare END_MSG line, which is
+  * checked as an END event at the latest timestamp.
+  *
+  * @param check Checker.
+  * @param line Start of the line.
+  * @param end End of the line (the newline, excluded).
+  *
+  * @ingroup philosopher_check
+  */
+ void	check_text_line(t_check *check, const char *line, const char *end)
+ {
+	 t_trace_event	event;
+ 
+	 check->position++;
+	 if ((size_t)(end - line) == sizeof(END_MSG) - 1
+		 && !memcmp(line, END_MSG, sizeof(END_MSG) - 1))
+	 {
+		 event.time = check->last_time;
+		 event.id = 0;
+		 event.kind = TRACE_END;
+		 event.fork = -1;
+	 }
+	 else if (!parse_text_line(&event, line, end))
+	 {
+		 check_violation(check, CHECK_FORMAT, "malformed line");
+		 return ;
+	 }
+	 check_event(check, &event);
+ }
+ 
+ /**
+  * @brief Check every complete line of a buffer.
+  *
+  * @param check Checker.
+  * @param buffer Data read so far.
+  * @param len Number of valid bytes.
+  * @return Number of bytes consumed (the trailing partial line is kept).
+  *
+  * @ingroup philosopher_check
+  */
+ size_t	check_text_chunk(t_check *check, const char *buffer, size_t len)
+ {
+	 const char	*line;
+	 const char	*newline;
+ 
+	 line = buffer;
+	 newline = memchr(line, '\n', len);
+	 while (newline)
+	 {
+		 check_text_line(check, line, newline);
+		 line = newline + 1;
+		 newline = memchr(line, '\n', buffer + len - line);
+	 }
+	 return (line - buffer);
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,61 @@
+/**
+ * @file check_violations.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Recording and naming of the violations a checker finds.
+ *
+ * @ingroup philosopher_check
+ */
+
+ #include "../../include/philo_check.h"
+ #include <stdio.h>
+
+ /**
+  * @brief Short name of a violation kind.
+  *
+  * @param kind One of the CHECK_* kinds.
+  * @return Static string such as `"fork"`.
+  *
+  * @ingroup philosopher_check
+  */
+ const char	*check_kind_name(int kind)
+ {
+	 static const char	*names[CHECK_KINDS] = {"format", "time-order",
+		 "fork", "sequence", "eat-time", "sleep-time", "after-end",
+		 "death-time", "missed-death", "unfinished"};
+ 
+	 if (kind < 0 || kind >= CHECK_KINDS)
+		 return ("unknown");
+	 return (names[kind]);
+ }
+ 
+ /**
+  * @brief Record a violation at the current position.
+  *
+  * @details
+  * The first violation is kept verbatim in `check->first`; the first
+  * `max_report` ones are also written to `check->report` when it is set.
+  *
+  * @param check Checker.
+  * @param kind One of the CHECK_* kinds.
+  * @param message Description without position.
+  *
+  * @ingroup philosopher_check
+  */
+ void	check_violation(t_check *check, int kind, const char *message)
+ {
+	 const char	*unit;
+ 
+	 unit = "line";
+	 if (check->binary)
+		 unit = "record";
+	 check->violations[kind]++;
+	 check->total_violations++;
+	 if (check->total_violations == 1)
+		 snprintf(check->first, CHECK_MESSAGE, "%s %ld: %s", unit,
+			 check->position, message);
+	 if (check->report && check->total_violations <= check->max_report)
+		 fprintf(check->report, "%s %ld: [%s] %s\n", unit, check->position,
+			 check_kind_name(kind), message);
+ }
+ 
\ No newline at end of file
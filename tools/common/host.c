@@ -0,0 +1,78 @@
+/**
+ * @file host.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Clock, CPU count and temporary files of the measurement host.
+ *
+ * @ingroup philosopher_bench
+ */
+
+ #define _GNU_SOURCE
+ #include "../../include/philo_bench.h"
+ #include <limits.h>
+ #include <sched.h>
+ #include <stdio.h>
+ #include <stdlib.h>
+ #include <time.h>
+ #include <unistd.h>
+ 
+ /**
+  * @brief Create an empty temporary file in `$TMPDIR` (or `/tmp`).
+  *
+  * @param path Buffer of PATH_MAX bytes receiving the file name.
+  * @param prefix Start of the file name, e.g. `philo-graph`.
+  * @return 0 on success, -1 on failure.
+  *
+  * @ingroup philosopher_bench
+  */
+ int	make_temp(char *path, const char *prefix)
+ {
+	 const char	*dir;
+	 int			fd;
+ 
+	 dir = getenv("TMPDIR");
+	 if (!dir)
+		 dir = "/tmp";
+	 snprintf(path, PATH_MAX, "%s/%s-XXXXXX", dir, prefix);
+	 fd = mkstemp(path);
+	 if (fd == -1)
+		 return (-1);
+	 close(fd);
+	 return (0);
+ }
+ 
+ /**
+  * @brief Monotonic clock in seconds.
+  *
+  * @return Seconds since an arbitrary fixed point.
+  *
+  * @ingroup philosopher_bench
+  */
+ double	bench_clock(void)
+ {
+	 struct timespec	now;
+ 
+	 clock_gettime(CLOCK_MONOTONIC, &now);
+	 return (now.tv_sec + now.tv_nsec / 1e9);
+ }
+ 
+ /**
+  * @brief Number of CPUs this process may run on.
+  *
+  * @return The size of the current affinity mask, at least 1.
+  *
+  * @ingroup philosopher_bench
+  */
+ int	bench_cpu_count(void)
+ {
+	 cpu_set_t	set;
+	 int			count;
+ 
+	 if (sched_getaffinity(0, sizeof(set), &set) == -1)
+		 return (1);
+	 count = CPU_COUNT(&set);
+	 if (count < 1)
+		 return (1);
+	 return (count);
+ }
+ 
\ No newline at end of file
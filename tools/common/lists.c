@@ -0,0 +1,74 @@
+/**
+ * @file lists.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Small parsing and timing helpers shared by the tools.
+ *
+ * @ingroup philosopher_bench
+ */
+
+ #include "../../include/philo_bench.h"
+ #include <stdlib.h>
+
+ /**
+  * @brief Parse a comma-separated list of positive integers.
+  *
+  * @param str The list, e.g. `"1,2,5,200"`.
+  * @param out Destination array of `max` entries.
+  * @param max Capacity of `out`.
+  * @param len Receives the number of parsed values.
+  * @return 0 on success, -1 on malformed input or too many values.
+  *
+  * @ingroup philosopher_bench
+  */
+ int	parse_int_list(const char *str, int *out, int max, int *len)
+ {
+	 char	*end;
+	 long	value;
+ 
+	 *len = 0;
+	 while (*str)
+	 {
+		 value = strtol(str, &end, 10);
+		 if (end == str || value < 1 || value > 1000000
+			 || *len == max || (*end && *end != ','))
+			 return (-1);
+		 out[(*len)++] = (int) value;
+		 str = end;
+		 if (*str == ',')
+			 str++;
+	 }
+	 if (*len == 0)
+		 return (-1);
+	 return (0);
+ }
+ 
+ /**
+  * @brief Length of one meal cycle of `philo`'s routine, in milliseconds.
+  *
+  * @details
+  * With an even table two groups alternate and a philosopher also sleeps in
+  * between: `max(2 * eat, eat + sleep)`. With an odd table `dinner_routine`
+  * waits an extra `time_to_eat` after sleeping and three groups rotate:
+  * `max(3 * eat, 2 * eat + sleep)`.
+  *
+  * @param count Number of philosophers.
+  * @param eat time_to_eat in milliseconds.
+  * @param sleep time_to_sleep in milliseconds.
+  * @return The cycle length in milliseconds.
+  *
+  * @ingroup philosopher_bench
+  */
+ int	meal_period(int count, int eat, int sleep)
+ {
+	 if (count % 2 == 0)
+	 {
+		 if (2 * eat > eat + sleep)
+			 return (2 * eat);
+		 return (eat + sleep);
+	 }
+	 if (3 * eat > 2 * eat + sleep)
+		 return (3 * eat);
+	 return (2 * eat + sleep);
+ }
+ 
\ No newline at end of file
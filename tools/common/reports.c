@@ -0,0 +1,107 @@
+/**
+ * @file reports.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Reading the `--report` files of the benchmarks.
+ *
+ * @details
+ * A report is read whole and scanned for the few members a benchmark
+ * needs, relying on the layout `philo` writes rather than on a JSON
+ * parser.
+ *
+ * @ingroup philosopher_bench
+ */
+
+ #include "../../include/philo_bench.h"
+ #include <stdio.h>
+ #include <stdlib.h>
+ #include <string.h>
+
+ /**
+  * @brief Read a whole file into memory.
+  *
+  * @param path File to read.
+  * @return The NUL-terminated contents, to free, or NULL on failure.
+  *
+  * @ingroup philosopher_bench
+  */
+ char	*read_whole(const char *path)
+ {
+	 FILE	*file;
+	 char	*text;
+	 long	size;
+ 
+	 file = fopen(path, "r");
+	 if (!file)
+		 return (NULL);
+	 text = NULL;
+	 if (fseek(file, 0, SEEK_END) == 0)
+	 {
+		 size = ftell(file);
+		 rewind(file);
+		 if (size > 0)
+			 text = malloc(size + 1);
+		 if (text && fread(text, 1, size, file) == (size_t) size)
+			 text[size] = '\0';
+		 else if (text)
+		 {
+			 free(text);
+			 text = NULL;
+		 }
+	 }
+	 fclose(file);
+	 return (text);
+ }
+ 
+ /**
+  * @brief How a reported dinner ended.
+  *
+  * @param text Report contents.
+  * @return `"died"`, `"full"` or `"time"`, or NULL if the member is
+  * missing or unknown.
+  *
+  * @ingroup philosopher_bench
+  */
+ const char	*report_outcome(const char *text)
+ {
+	 static const char	*names[3] = {"died", "full", "time"};
+	 const char			*at;
+	 size_t				len;
+	 int					i;
+ 
+	 at = strstr(text, "\"outcome\":\"");
+	 if (!at)
+		 return (NULL);
+	 at += strlen("\"outcome\":\"");
+	 i = -1;
+	 while (++i < 3)
+	 {
+		 len = strlen(names[i]);
+		 if (!strncmp(at, names[i], len) && at[len] == '"')
+			 return (names[i]);
+	 }
+	 return (NULL);
+ }
+ 
+ /**
+  * @brief Read a top-level integer member of a report.
+  *
+  * @param text Report contents.
+  * @param key Member name, e.g. `runtime_ms`.
+  * @param value Receives the number.
+  * @return 0 on success, -1 if the member is missing.
+  *
+  * @ingroup philosopher_bench
+  */
+ int	report_number(const char *text, const char *key, long long *value)
+ {
+	 char		member[64];
+	 const char	*at;
+ 
+	 snprintf(member, sizeof(member), "\"%s\":", key);
+	 at = strstr(text, member);
+	 if (!at || sscanf(at + strlen(member), "%lld", value) != 1)
+		 return (-1);
+	 return (0);
+ }
+ 
\ No newline at end of file
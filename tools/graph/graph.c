@@ -0,0 +1,155 @@
+/**
+ * @file graph.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Entry point of the `philo-graph` topology benchmark.
+ *
+ * @details
+ * Usage: `philo-graph [-b philo] [-o out.csv] [-k kinds] [-n counts] ...`.
+ * Runs a saturated dinner on every kind of graph at every count and
+ * drinking percent, `repeats` times, and writes one CSV row per run,
+ * ready for gnuplot or a dataframe. Progress goes to stderr. With
+ * `-g kind`, writes that one graph for `philo --graph` instead. Exits
+ * with 1 on usage errors, or if the `-g` graph cannot be drawn.
+ *
+ * @ingroup philosopher_graph
+ */
+
+ #include "../../include/philo_graph.h"
+
+ /**
+  * @internal
+  * @brief Write the CSV header.
+  *
+  * @param out CSV stream.
+  *
+  * @ingroup philosopher_graph
+  */
+ static void	print_header(FILE *out)
+ {
+	 fprintf(out, "kind,philosophers,forks,degree_max,drinking_pct,cpus,"
+		 "repeat,outcome,meals,runtime_ms,meals_per_s,fork_wait_avg_us,"
+		 "fork_wait_max_us,hunger_p50_ms,hunger_p99_ms,hunger_max_ms,"
+		 "contended_locks,fairness,cpu_s\n");
+ }
+ 
+ /**
+  * @internal
+  * @brief Write one run as a CSV row.
+  *
+  * @details
+  * Figures are left empty when no report came back.
+  *
+  * @param out CSV stream.
+  * @param bench Benchmark settings.
+  * @param point Measured run.
+  *
+  * @ingroup philosopher_graph
+  */
+ static void	print_point(FILE *out, t_graph_bench *bench, t_graph_point *point)
+ {
+	 fprintf(out, "%s,%d,%d,%d,%d,%d,%d,%s", graph_kind_name(point->kind),
+		 point->count, point->forks, point->degree_max, point->drinking,
+		 bench->cpus, point->repeat, point->outcome);
+	 if (point->runtime > 0)
+		 fprintf(out, ",%ld,%lld,%.1f,%.2f,%.2f,%lld,%lld,%lld,%lld,%.4f",
+			 point->meals, point->runtime, point->meals * 1e3 / point->runtime,
+			 point->wait_avg, point->wait_max, point->hunger[0],
+			 point->hunger[1], point->hunger[2], point->contended,
+			 point->fairness);
+	 else
+		 fprintf(out, ",,,,,,,,,,");
+	 fprintf(out, ",%.3f\n", point->cpu);
+	 fflush(out);
+ }
+ 
+ /**
+  * @internal
+  * @brief Write the `-g` graph.
+  *
+  * @param bench Benchmark settings.
+  * @return 0 on success, 1 if the graph cannot be drawn.
+  *
+  * @ingroup philosopher_graph
+  */
+ static int	print_graph(t_graph_bench *bench)
+ {
+	 t_graph_point	point;
+	 int				status;
+ 
+	 point = (t_graph_point){.kind = bench->print, .count = bench->counts[0]};
+	 status = write_graph(bench->out, bench, &point);
+	 if (bench->out != stdout)
+		 fclose(bench->out);
+	 if (status == 0)
+		 return (0);
+	 fprintf(stderr, "philo-graph: can't draw a %s graph of %d\n",
+		 graph_kind_name(point.kind), point.count);
+	 return (1);
+ }
+ 
+ /**
+  * @internal
+  * @brief Measure every repeat of one (kind, count, drinking) point.
+  *
+  * @param bench Benchmark settings.
+  * @param kind Graph kind.
+  * @param count Philosophers.
+  * @param drinking Drinking percent, 0 for every fork.
+  *
+  * @ingroup philosopher_graph
+  */
+ static void	measure_repeats(t_graph_bench *bench, int kind, int count,
+		 int drinking)
+ {
+	 t_graph_point	point;
+ 
+	 point = (t_graph_point){.kind = kind, .count = count,
+		 .drinking = drinking, .repeat = -1};
+	 while (++point.repeat < bench->repeats)
+	 {
+		 fprintf(stderr, "philo-graph: %s of %d, drinking %d%%, run %d\n",
+			 graph_kind_name(kind), count, drinking, point.repeat + 1);
+		 measure_graph(bench, &point);
+		 print_point(bench->out, bench, &point);
+	 }
+ }
+ 
+ /**
+  * @brief Run the topology benchmark.
+  *
+  * @param argc Argument count.
+  * @param argv Argument vector.
+  * @return 0 when the benchmark ran, 1 on usage errors.
+  *
+  * @ingroup philosopher_graph
+  */
+ int	main(int argc, char **argv)
+ {
+	 t_graph_bench	bench;
+	 int				k;
+	 int				n;
+	 int				p;
+ 
+	 if (parse_graph_options(&bench, argc, argv) == -1)
+		 return (1);
+	 if (bench.print >= 0)
+		 return (print_graph(&bench));
+	 print_header(bench.out);
+	 k = -1;
+	 while (++k < bench.kind_len)
+	 {
+		 n = -1;
+		 while (++n < bench.count_len)
+		 {
+			 p = -1;
+			 while (++p < bench.drink_len)
+				 measure_repeats(&bench, bench.kinds[k], bench.counts[n],
+					 bench.drinks[p]);
+		 }
+	 }
+	 if (bench.out != stdout)
+		 fclose(bench.out);
+	 return (0);
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,97 @@
+/**
+ * @file lists.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief The list options of `philo-graph`: kinds, counts and drinking.
+ *
+ * @ingroup philosopher_graph
+ */
+
+ #include "../../include/philo_graph.h"
+ #include <stdlib.h>
+ #include <string.h>
+
+ /**
+  * @internal
+  * @brief Parse a comma separated list of graph kinds.
+  *
+  * @param bench Benchmark whose `kinds` are replaced.
+  * @param str List, e.g. `grid,star`.
+  * @return 0 on success, -1 on an empty list or an unknown kind.
+  *
+  * @ingroup philosopher_graph
+  */
+ static int	parse_kinds(t_graph_bench *bench, char *str)
+ {
+	 char	*name;
+	 char	*rest;
+ 
+	 bench->kind_len = 0;
+	 name = strtok_r(str, ",", &rest);
+	 while (name)
+	 {
+		 if (bench->kind_len == GRAPH_MAX_LIST || find_graph_kind(name) < 0)
+			 return (-1);
+		 bench->kinds[bench->kind_len++] = find_graph_kind(name);
+		 name = strtok_r(NULL, ",", &rest);
+	 }
+	 if (bench->kind_len == 0)
+		 return (-1);
+	 return (0);
+ }
+ 
+ /**
+  * @internal
+  * @brief Parse a comma separated list of drinking percents.
+  *
+  * @details
+  * Like `parse_int_list`, but for percents, 0 included.
+  *
+  * @param bench Benchmark whose `drinks` are replaced.
+  * @param str List, e.g. `0,50,100`.
+  * @return 0 on success, -1 on an empty list or a value outside 0 to 100.
+  *
+  * @ingroup philosopher_graph
+  */
+ static int	parse_drinks(t_graph_bench *bench, const char *str)
+ {
+	 char	*end;
+	 long	value;
+ 
+	 bench->drink_len = 0;
+	 while (*str)
+	 {
+		 value = strtol(str, &end, 10);
+		 if (end == str || value < 0 || value > 100
+			 || bench->drink_len == GRAPH_MAX_LIST || (*end && *end != ','))
+			 return (-1);
+		 bench->drinks[bench->drink_len++] = (int) value;
+		 str = end;
+		 if (*str == ',')
+			 str++;
+	 }
+	 if (bench->drink_len == 0)
+		 return (-1);
+	 return (0);
+ }
+ 
+ /**
+  * @brief Replace one axis of the benchmark with a comma separated list.
+  *
+  * @param bench Benchmark being configured.
+  * @param opt `k`, `n` or `p`: kinds, counts or drinking percents.
+  * @param arg The list.
+  * @return 0 on success, -1 on an invalid list.
+  *
+  * @ingroup philosopher_graph
+  */
+ int	apply_axis_option(t_graph_bench *bench, int opt, char *arg)
+ {
+	 if (opt == 'k')
+		 return (parse_kinds(bench, arg));
+	 if (opt == 'n')
+		 return (parse_int_list(arg, bench->counts, GRAPH_MAX_LIST,
+				 &bench->count_len));
+	 return (parse_drinks(bench, arg));
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,135 @@
+/**
+ * @file measure.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief One run of the topology benchmark.
+ *
+ * @details
+ * The graph and the report are temporary files in `$TMPDIR`, deleted
+ * once the run is read.
+ *
+ * @ingroup philosopher_graph
+ */
+
+ #include "../../include/philo_graph.h"
+ #include <stddef.h>
+ #include <stdlib.h>
+ #include <string.h>
+ #include <unistd.h>
+
+ /**
+  * @internal
+  * @brief Write the graph of a point to a file.
+  *
+  * @param bench Benchmark settings.
+  * @param point Point with `kind`, `count` and `repeat` set.
+  * @param path Temporary file to fill.
+  * @return 0 on success, -1 on failure.
+  *
+  * @ingroup philosopher_graph
+  */
+ static int	save_graph(t_graph_bench *bench, t_graph_point *point,
+		 const char *path)
+ {
+	 FILE	*file;
+	 int		status;
+ 
+	 file = fopen(path, "w");
+	 if (!file)
+		 return (-1);
+	 status = write_graph(file, bench, point);
+	 if (fclose(file) != 0)
+		 return (-1);
+	 return (status);
+ }
+ 
+ /**
+  * @internal
+  * @brief Fill the argument vector of a run.
+  *
+  * @details
+  * Runs `philo --run-for=<ms> --format=none --report=<path>
+  * --graph=<path> [--drinking=<pct> --seed=<n>] N INT_MAX eat sleep`:
+  * nobody can die, so the run only ends with its wall time. Every repeat
+  * draws its bottles from a seed of its own.
+  *
+  * @param bench Benchmark settings.
+  * @param run Run whose `argv`, `cpus` and `timeout` are filled.
+  * @param args Storage for the options and numbers; the graph and report
+  * options are already in `args[1]` and `args[2]`.
+  * @param point Point being measured.
+  *
+  * @ingroup philosopher_graph
+  */
+ static void	set_arguments(t_graph_bench *bench, t_bench_run *run,
+		 char args[8][PATH_MAX + 16], t_graph_point *point)
+ {
+	 int	i;
+	 int	n;
+ 
+	 bench_init(run);
+	 snprintf(args[0], PATH_MAX + 16, "--run-for=%d", bench->run_for);
+	 snprintf(args[3], PATH_MAX + 16, "--drinking=%d", point->drinking);
+	 snprintf(args[4], PATH_MAX + 16, "--seed=%u",
+		 bench->seed + point->repeat);
+	 snprintf(args[5], PATH_MAX + 16, "%d", point->count);
+	 snprintf(args[6], PATH_MAX + 16, "%d", bench->time_to_eat);
+	 snprintf(args[7], PATH_MAX + 16, "%d", bench->time_to_sleep);
+	 run->argv[0] = (char *) bench->philo_bin;
+	 run->argv[1] = "--format=none";
+	 n = 2;
+	 i = -1;
+	 while (++i < 6)
+		 if ((i != 3 && i != 4) || point->drinking)
+			 run->argv[n++] = args[i];
+	 run->argv[n++] = "2147483647";
+	 run->argv[n++] = args[6];
+	 run->argv[n++] = args[7];
+	 run->argv[n] = NULL;
+	 run->cpus = bench->cpus;
+	 run->timeout = bench->run_for + bench->timeout;
+ }
+ 
+ /**
+  * @brief Draw the graph of a point, run it and read its figures.
+  *
+  * @details
+  * The outcome is `time` when the dinner lasted its wall time, `hung` when
+  * the watchdog killed it, `no-graph` when the graph cannot be drawn (a
+  * `regular` one with an odd number of ends, or a degree too high) and
+  * `error` when no report came back.
+  *
+  * @param bench Benchmark settings.
+  * @param point Point with `kind`, `count` and `repeat` set; the rest is
+  * filled in.
+  *
+  * @ingroup philosopher_graph
+  */
+ void	measure_graph(t_graph_bench *bench, t_graph_point *point)
+ {
+	 static char	args[8][PATH_MAX + 16];
+	 char		paths[2][PATH_MAX];
+	 t_bench_run	run;
+ 
+	 memset(&point->outcome, 0, sizeof(*point)
+		 - offsetof(t_graph_point, outcome));
+	 point->outcome = "error";
+	 if (make_temp(paths[0], "philo-graph") == -1)
+		 return ;
+	 if (save_graph(bench, point, paths[0]) == -1)
+		 point->outcome = "no-graph";
+	 else if (make_temp(paths[1], "philo-graph") == 0)
+	 {
+		 snprintf(args[1], PATH_MAX + 16, "--graph=%.*s", PATH_MAX, paths[0]);
+		 snprintf(args[2], PATH_MAX + 16, "--report=%.*s", PATH_MAX, paths[1]);
+		 set_arguments(bench, &run, args, point);
+		 if (bench_run(&run) == 0)
+			 read_graph_report(point, paths[1]);
+		 if (run.killed)
+			 point->outcome = "hung";
+		 point->cpu = run.cpu;
+		 unlink(paths[1]);
+	 }
+	 unlink(paths[0]);
+ }
+ 
\ No newline at end of file
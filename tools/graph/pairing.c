@@ -0,0 +1,141 @@
+/**
+ * @file pairing.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Pairing the points of a random regular graph.
+ *
+ * @details
+ * Every philosopher holds `degree` points, and points are paired at
+ * random two by two; a pair becomes a fork unless both points are the
+ * same philosopher's, or the two already share one, in which case
+ * another pair is drawn.
+ *
+ * @ingroup philosopher_graph
+ */
+
+ #include "../../include/philo_graph.h"
+
+ /**
+  * @internal
+  * @brief Draw the next random number (splitmix64).
+  *
+  * @param state Generator state, advanced.
+  * @return A uniformly distributed 64-bit number.
+  *
+  * @ingroup philosopher_graph
+  */
+ static unsigned long long	next_draw(unsigned long long *state)
+ {
+	 unsigned long long	z;
+ 
+	 *state += 0x9e3779b97f4a7c15ULL;
+	 z = *state;
+	 z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	 z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+	 return (z ^ (z >> 31));
+ }
+ 
+ /**
+  * @internal
+  * @brief Tell whether two philosophers already share a fork.
+  *
+  * @param draw Graph being drawn.
+  * @param pair The two philosophers.
+  * @return Whether `pair[1]` is among the neighbours of `pair[0]`.
+  *
+  * @ingroup philosopher_graph
+  */
+ static bool	is_linked(const t_regular *draw, int pair[2])
+ {
+	 int	i;
+ 
+	 i = -1;
+	 while (++i < draw->sink->degrees[pair[0]])
+		 if (draw->adjacent[pair[0] * draw->degree + i] == pair[1])
+			 return (true);
+	 return (false);
+ }
+ 
+ /**
+  * @internal
+  * @brief Link two philosophers and take their points out of the pool.
+  *
+  * @details
+  * Each point is replaced by the last one of the pool, the higher slot
+  * first so that the last point is never one of the two.
+  *
+  * @param draw Graph being drawn.
+  * @param pair The two philosophers.
+  * @param at Slots of their points, different.
+  *
+  * @ingroup philosopher_graph
+  */
+ static void	take_pair(t_regular *draw, int pair[2], int at[2])
+ {
+	 int	*degrees;
+	 int	high;
+ 
+	 degrees = draw->sink->degrees;
+	 draw->adjacent[pair[0] * draw->degree + degrees[pair[0]]++] = pair[1];
+	 draw->adjacent[pair[1] * draw->degree + degrees[pair[1]]++] = pair[0];
+	 high = at[0];
+	 if (at[1] > high)
+		 high = at[1];
+	 draw->points[high] = draw->points[--draw->left];
+	 draw->points[at[0] + at[1] - high] = draw->points[--draw->left];
+ }
+ 
+ /**
+  * @internal
+  * @brief Fill the pool with every point and reset the degrees.
+  *
+  * @param draw Graph being drawn.
+  *
+  * @ingroup philosopher_graph
+  */
+ static void	fill_pool(t_regular *draw)
+ {
+	 int	i;
+ 
+	 draw->left = draw->sink->point->count * draw->degree;
+	 i = -1;
+	 while (++i < draw->left)
+		 draw->points[i] = i / draw->degree;
+	 i = -1;
+	 while (++i < draw->sink->point->count)
+		 draw->sink->degrees[i] = 0;
+ }
+ 
+ /**
+  * @brief Pair all points once.
+  *
+  * @param draw Graph being drawn; its degrees are reset and filled.
+  * @return 0 once every point is paired, -1 when stuck.
+  *
+  * @ingroup philosopher_graph
+  */
+ int	pair_points(t_regular *draw)
+ {
+	 int	pair[2];
+	 int	at[2];
+	 int	tries;
+ 
+	 fill_pool(draw);
+	 tries = 0;
+	 while (draw->left > 0 && tries++ < GRAPH_PAIR_TRIES)
+	 {
+		 at[0] = next_draw(&draw->state) % draw->left;
+		 at[1] = next_draw(&draw->state) % draw->left;
+		 pair[0] = draw->points[at[0]];
+		 pair[1] = draw->points[at[1]];
+		 if (pair[0] != pair[1] && !is_linked(draw, pair))
+		 {
+			 take_pair(draw, pair, at);
+			 tries = 0;
+		 }
+	 }
+	 if (draw->left > 0)
+		 return (-1);
+	 return (0);
+ }
+ 
\ No newline at end of file
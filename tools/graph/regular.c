@@ -0,0 +1,107 @@
+/**
+ * @file regular.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Random regular conflict graphs.
+ *
+ * @details
+ * Points are paired in pairing.c; when only unusable pairs are left the
+ * draw starts over, which is rare for small degrees.
+ *
+ * @ingroup philosopher_graph
+ */
+
+ #include "../../include/philo_graph.h"
+ #include <stdlib.h>
+
+ /**
+  * @internal
+  * @brief Set up a draw and allocate its tables.
+  *
+  * @param draw Graph to set up.
+  * @param sink Destination, with its point's `count` and `repeat` set.
+  * @param bench Benchmark settings, with `degree` and `seed`.
+  * @return 0 on success, -1 if an allocation failed.
+  *
+  * @ingroup philosopher_graph
+  */
+ static int	start_draw(t_regular *draw, t_graph_sink *sink,
+		 t_graph_bench *bench)
+ {
+	 int	points;
+ 
+	 points = sink->point->count * bench->degree;
+	 draw->sink = sink;
+	 draw->degree = bench->degree;
+	 draw->adjacent = malloc(sizeof(int) * (points + 1));
+	 draw->points = malloc(sizeof(int) * (points + 1));
+	 draw->state = ((unsigned long long) bench->seed << 32)
+		 ^ (sink->point->count * 1000003ULL) ^ sink->point->repeat;
+	 if (draw->adjacent && draw->points)
+		 return (0);
+	 free(draw->adjacent);
+	 free(draw->points);
+	 return (-1);
+ }
+ 
+ /**
+  * @internal
+  * @brief Write the forks of a finished draw.
+  *
+  * @param draw Graph whose points are all paired.
+  *
+  * @ingroup philosopher_graph
+  */
+ static void	write_pairs(t_regular *draw)
+ {
+	 int	count;
+	 int	i;
+ 
+	 count = draw->sink->point->count;
+	 i = -1;
+	 while (++i < count)
+		 draw->sink->degrees[i] = 0;
+	 i = -1;
+	 while (++i < count * draw->degree)
+		 if (i / draw->degree < draw->adjacent[i])
+			 put_edge(draw->sink, i / draw->degree, draw->adjacent[i]);
+ }
+ 
+ /**
+  * @brief Draw and write a random `degree`-regular graph.
+  *
+  * @details
+  * The draw depends on the seed, the count and the repeat, so every repeat
+  * runs on a graph of its own and the same command gives the same graphs.
+  * Forks are written philosopher by philosopher.
+  *
+  * @param sink Destination, degrees zeroed; its point has `count` and
+  * `repeat` set.
+  * @param bench Benchmark settings, with `degree` and `seed`.
+  * @return 0 on success, -1 if `count * degree` is odd, `degree` is not
+  * below `count`, or no draw succeeded.
+  *
+  * @ingroup philosopher_graph
+  */
+ int	draw_regular(t_graph_sink *sink, t_graph_bench *bench)
+ {
+	 t_regular	draw;
+	 int			count;
+	 int			draws;
+ 
+	 count = sink->point->count;
+	 if ((count * bench->degree) % 2 || bench->degree >= count
+		 || start_draw(&draw, sink, bench) == -1)
+		 return (-1);
+	 draws = 0;
+	 while (draws < GRAPH_DRAWS && pair_points(&draw) == -1)
+		 draws++;
+	 if (draws < GRAPH_DRAWS)
+		 write_pairs(&draw);
+	 free(draw.adjacent);
+	 free(draw.points);
+	 if (draws == GRAPH_DRAWS)
+		 return (-1);
+	 return (0);
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,170 @@
+/**
+ * @file setup.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Command-line parsing for `philo-graph`.
+ *
+ * @ingroup philosopher_graph
+ */
+
+ #include "../../include/philo_graph.h"
+ #include <stdlib.h>
+ #include <string.h>
+ #include <unistd.h>
+
+ /**
+  * @internal
+  * @brief Fill the default benchmark.
+  *
+  * @details
+  * Every kind at 16, 64, 256 and 1024 philosophers, square counts so that
+  * grids and tori are square, 4-regular random graphs, every fork taken,
+  * and saturated runs of 2 s: meals and naps take no time, so only taking
+  * the forks does.
+  *
+  * @param bench Benchmark to initialize.
+  *
+  * @ingroup philosopher_graph
+  */
+ static void	set_graph_defaults(t_graph_bench *bench)
+ {
+	 memset(bench, 0, sizeof(*bench));
+	 bench->philo_bin = "./bin/philo-release";
+	 bench->out = stdout;
+	 bench->degree = 4;
+	 bench->run_for = 2000;
+	 bench->repeats = 1;
+	 bench->timeout = 10000;
+	 bench->seed = 42;
+	 bench->print = -1;
+	 while (bench->kind_len < GRAPH_KIND_COUNT)
+	 {
+		 bench->kinds[bench->kind_len] = bench->kind_len;
+		 bench->kind_len++;
+	 }
+	 parse_int_list("16,64,256,1024", bench->counts, GRAPH_MAX_LIST,
+		 &bench->count_len);
+	 bench->drink_len = 1;
+ }
+ 
+ /**
+  * @internal
+  * @brief Print the usage message to stderr.
+  *
+  * @ingroup philosopher_graph
+  */
+ static void	graph_usage(void)
+ {
+	 fprintf(stderr, "Usage: philo-graph [-b philo] [-o out.csv] [-k kinds]"
+		 " [-n counts] [-D degree]\n"
+		 "                   [-p drinking] [-e eat] [-s sleep] [-w run_for_ms]"
+		 " [-r repeats]\n"
+		 "                   [-c cpus] [-t timeout_ms] [-x seed]\n"
+		 "       philo-graph -g kind -n count [-D degree] [-x seed]"
+		 " [-o out.txt]\n"
+		 "  Kinds are comma separated: ring, grid, torus, regular, star\n"
+		 "  Drinking percents are too, 0 taking every fork: -p 0,50,100\n");
+ }
+ 
+ /**
+  * @internal
+  * @brief Apply one option of the runs: timings, repeats, CPUs, timeout.
+  *
+  * @param bench Benchmark being configured.
+  * @param opt Option character.
+  * @param arg Option argument.
+  * @return 0 on success, -1 on an unknown option.
+  *
+  * @ingroup philosopher_graph
+  */
+ static int	apply_run_option(t_graph_bench *bench, int opt, char *arg)
+ {
+	 if (opt == 'e')
+		 bench->time_to_eat = atoi(arg);
+	 else if (opt == 's')
+		 bench->time_to_sleep = atoi(arg);
+	 else if (opt == 'w')
+		 bench->run_for = atoi(arg);
+	 else if (opt == 'r')
+		 bench->repeats = atoi(arg);
+	 else if (opt == 'c')
+		 bench->cpus = atoi(arg);
+	 else if (opt == 't')
+		 bench->timeout = atoi(arg);
+	 else
+		 return (-1);
+	 return (0);
+ }
+ 
+ /**
+  * @internal
+  * @brief Apply one parsed `getopt` option to the benchmark.
+  *
+  * @param bench Benchmark being configured.
+  * @param opt Option character.
+  * @param arg Option argument.
+  * @return 0 on success, -1 on an invalid value.
+  *
+  * @ingroup philosopher_graph
+  */
+ static int	apply_graph_option(t_graph_bench *bench, int opt, char *arg)
+ {
+	 if (opt == 'b')
+		 bench->philo_bin = arg;
+	 else if (opt == 'o')
+		 bench->out = fopen(arg, "w");
+	 else if (opt == 'D')
+		 bench->degree = atoi(arg);
+	 else if (opt == 'x')
+		 bench->seed = strtoul(arg, NULL, 10);
+	 else if (opt == 'g')
+		 bench->print = find_graph_kind(arg);
+	 else if (opt == 'k' || opt == 'n' || opt == 'p')
+		 return (apply_axis_option(bench, opt, arg));
+	 else
+		 return (apply_run_option(bench, opt, arg));
+	 if (!bench->out || (opt == 'g' && bench->print < 0))
+		 return (-1);
+	 return (0);
+ }
+ 
+ /**
+  * @brief Parse `philo-graph` command-line options.
+  *
+  * @details
+  * Rejects negative timings and degrees, and a `-g` graph for more than
+  * one count.
+  *
+  * @param bench Benchmark to fill.
+  * @param argc Argument count.
+  * @param argv Argument vector.
+  * @return 0 on success, -1 after printing the usage on error.
+  *
+  * @ingroup philosopher_graph
+  */
+ int	parse_graph_options(t_graph_bench *bench, int argc, char **argv)
+ {
+	 int	opt;
+ 
+	 set_graph_defaults(bench);
+	 opt = getopt(argc, argv, "b:o:k:n:D:p:e:s:w:r:c:t:x:g:");
+	 while (opt != -1)
+	 {
+		 if (apply_graph_option(bench, opt, optarg) == -1)
+		 {
+			 graph_usage();
+			 return (-1);
+		 }
+		 opt = getopt(argc, argv, "b:o:k:n:D:p:e:s:w:r:c:t:x:g:");
+	 }
+	 if (optind != argc || bench->degree < 0 || bench->time_to_eat < 0
+		 || bench->time_to_sleep < 0 || bench->run_for < 1
+		 || bench->repeats < 1 || bench->cpus < 0 || bench->timeout < 1
+		 || (bench->print >= 0 && bench->count_len != 1))
+	 {
+		 graph_usage();
+		 return (-1);
+	 }
+	 return (0);
+ }
+ 
\ No newline at end of file
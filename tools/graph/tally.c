@@ -0,0 +1,174 @@
+/**
+ * @file tally.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Figures of one topology run, from its `--report`.
+ *
+ * @details
+ * The report is read whole and scanned for the few members the benchmark
+ * needs, relying on the layout `philo` writes rather than on a JSON
+ * parser.
+ *
+ * @ingroup philosopher_graph
+ */
+
+ #include "../../include/philo_graph.h"
+ #include <stdlib.h>
+ #include <string.h>
+
+ /**
+  * @internal
+  * @brief Read the outcome, the run time and the contended locks.
+  *
+  * @param point Point whose `outcome`, `runtime` and `contended` are
+  * filled.
+  * @param text Report contents.
+  * @return 0 on success, -1 if a member is missing.
+  *
+  * @ingroup philosopher_graph
+  */
+ static int	read_ending(t_graph_point *point, const char *text)
+ {
+	 const char	*outcome;
+ 
+	 outcome = report_outcome(text);
+	 if (!outcome || report_number(text, "runtime_ms", &point->runtime) == -1
+		 || report_number(text, "contended_locks", &point->contended) == -1)
+		 return (-1);
+	 point->outcome = outcome;
+	 return (0);
+ }
+ 
+ /**
+  * @internal
+  * @brief Order two hungers, for `qsort`.
+  *
+  * @param a First hunger.
+  * @param b Second hunger.
+  * @return Negative, zero or positive as `a` is below, equal to or above
+  * `b`.
+  *
+  * @ingroup philosopher_graph
+  */
+ static int	compare_hunger(const void *a, const void *b)
+ {
+	 long long	x;
+	 long long	y;
+ 
+	 x = *(const long long *) a;
+	 y = *(const long long *) b;
+	 return ((x > y) - (x < y));
+ }
+ 
+ /**
+  * @internal
+  * @brief Add up the philosophers' lines.
+  *
+  * @details
+  * `sums` receives the number of philosophers, the sum of their meals,
+  * the sum of their squares and the sum of their fork waits (us); each
+  * one's longest hunger goes to `hungers`.
+  *
+  * @param point Point whose meals and longest wait are filled.
+  * @param text Report contents, from the `philosophers` array on.
+  * @param sums Receives the four sums.
+  * @param hungers Room for `point->count` hungers.
+  *
+  * @ingroup philosopher_graph
+  */
+ static void	add_meals(t_graph_point *point, const char *text, double sums[4],
+		 long long *hungers)
+ {
+	 double		wait[2];
+	 long long	hunger;
+	 long		meals;
+ 
+	 text = strstr(text, "{\"id\":");
+	 while (text && sums[0] < point->count && sscanf(text, "{\"id\":%*d,"
+			 "\"meals\":%ld,\"last_meal_ms\":%*d,\"hunger_max_ms\":%lld,"
+			 "\"slack_min_ms\":%*d,\"fork_wait_avg_us\":%lf,"
+			 "\"fork_wait_max_us\":%lf", &meals, &hunger, &wait[0],
+			 &wait[1]) == 4)
+	 {
+		 point->meals += meals;
+		 if (wait[1] > point->wait_max)
+			 point->wait_max = wait[1];
+		 hungers[(int) sums[0]] = hunger;
+		 sums[0] += 1;
+		 sums[1] += meals;
+		 sums[2] += (double) meals * meals;
+		 sums[3] += wait[0] * meals;
+		 text = strstr(text + 1, "{\"id\":");
+	 }
+ }
+ 
+ /**
+  * @internal
+  * @brief Turn the sums and hungers into the figures of the point.
+  *
+  * @param point Point whose fork wait, hunger tails and fairness are set.
+  * @param hungers Longest hunger of each philosopher, sorted here.
+  * @param sums The sums of `add_meals`, at least one philosopher.
+  *
+  * @ingroup philosopher_graph
+  */
+ static void	set_figures(t_graph_point *point, long long *hungers,
+		 double sums[4])
+ {
+	 int	count;
+ 
+	 count = (int) sums[0];
+	 qsort(hungers, count, sizeof(long long), compare_hunger);
+	 point->hunger[0] = hungers[(int)((count - 1) * 0.5)];
+	 point->hunger[1] = hungers[(int)((count - 1) * 0.99)];
+	 point->hunger[2] = hungers[count - 1];
+	 if (sums[1] > 0)
+		 point->wait_avg = sums[3] / sums[1];
+	 point->fairness = 1;
+	 if (sums[2] > 0)
+		 point->fairness = sums[1] * sums[1] / (sums[0] * sums[2]);
+ }
+ 
+ /**
+  * @brief Read the figures of a run from its report.
+  *
+  * @details
+  * The fork wait is averaged over all meals, fairness is Jain's index
+  * of the meal counts, 1 when everyone ate as often, and the hunger tails
+  * are nearest-rank percentiles of everyone's longest hunger.
+  *
+  * @param point Point with `kind`, `count` and `repeat` set; receives the
+  * outcome, meals, fork waits, hunger tails, contended locks and
+  * fairness.
+  * @param path The run's `--report` file.
+  * @return 0 on success, -1 if the report is missing or incomplete.
+  *
+  * @ingroup philosopher_graph
+  */
+ int	read_graph_report(t_graph_point *point, const char *path)
+ {
+	 char		*text;
+	 char		*philosophers;
+	 long long	*hungers;
+	 double		sums[4];
+ 
+	 text = read_whole(path);
+	 if (!text)
+		 return (-1);
+	 philosophers = strstr(text, "\"philosophers\":[");
+	 hungers = malloc(sizeof(long long) * point->count);
+	 memset(sums, 0, sizeof(sums));
+	 if (philosophers && hungers && read_ending(point, text) == 0)
+		 add_meals(point, philosophers, sums, hungers);
+	 free(text);
+	 if (sums[0] == 0)
+	 {
+		 free(hungers);
+		 point->outcome = "error";
+		 return (-1);
+	 }
+	 set_figures(point, hungers, sums);
+	 free(hungers);
+	 return (0);
+ }
+ 
\ No newline at end of file
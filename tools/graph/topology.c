@@ -0,0 +1,162 @@
+/**
+ * @file topology.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief The regular shapes of conflict graph: ring, grid, torus, star.
+ *
+ * @details
+ * Graphs are written as the edge lists `philo --graph` reads, one fork
+ * per line, philosophers numbered from 1.
+ *
+ * @ingroup philosopher_graph
+ */
+
+ #include "../../include/philo_graph.h"
+ #include <stdlib.h>
+ #include <string.h>
+
+ /**
+  * @brief Look a graph kind up by name.
+  *
+  * @param name `ring`, `grid`, `torus`, `regular` or `star`.
+  * @return Its index, or -1 if unknown.
+  *
+  * @ingroup philosopher_graph
+  */
+ int	find_graph_kind(const char *name)
+ {
+	 int	kind;
+ 
+	 kind = -1;
+	 while (++kind < GRAPH_KIND_COUNT)
+		 if (strcmp(name, graph_kind_name(kind)) == 0)
+			 return (kind);
+	 return (-1);
+ }
+ 
+ /**
+  * @brief Name of a graph kind.
+  *
+  * @param kind Index of the kind.
+  * @return Its name.
+  *
+  * @ingroup philosopher_graph
+  */
+ const char	*graph_kind_name(int kind)
+ {
+	 static const char	*names[GRAPH_KIND_COUNT] = {"ring", "grid", "torus",
+		 "regular", "star"};
+ 
+	 return (names[kind]);
+ }
+ 
+ /**
+  * @brief Write one fork, shared by two philosophers (from 0).
+  *
+  * @param sink Destination, counting forks and degrees.
+  * @param a One philosopher.
+  * @param b The other.
+  *
+  * @ingroup philosopher_graph
+  */
+ void	put_edge(t_graph_sink *sink, int a, int b)
+ {
+	 fprintf(sink->out, "%d %d\n", a + 1, b + 1);
+	 sink->point->forks++;
+	 if (++sink->degrees[a] > sink->point->degree_max)
+		 sink->point->degree_max = sink->degrees[a];
+	 if (++sink->degrees[b] > sink->point->degree_max)
+		 sink->point->degree_max = sink->degrees[b];
+ }
+ 
+ /**
+  * @internal
+  * @brief Write a grid, or a torus, of `count` philosophers.
+  *
+  * @details
+  * The grid has as many rows as the largest divisor of `count` up to its
+  * square root, so a prime count gives a single row: a path, or a ring
+  * once wrapped. Philosopher `r * cols + c` sits in row `r`, column `c`.
+  * A dimension of two is not wrapped, which would share a second fork
+  * between the same two philosophers.
+  *
+  * @param sink Destination.
+  * @param count Philosophers.
+  * @param wrap Whether to wrap the edges around.
+  *
+  * @ingroup philosopher_graph
+  */
+ static void	write_grid(t_graph_sink *sink, int count, bool wrap)
+ {
+	 int	rows;
+	 int	cols;
+	 int	i;
+ 
+	 rows = 1;
+	 i = 2;
+	 while (i * i <= count)
+	 {
+		 if (count % i == 0)
+			 rows = i;
+		 i++;
+	 }
+	 cols = count / rows;
+	 i = -1;
+	 while (++i < count)
+	 {
+		 if (i % cols + 1 < cols)
+			 put_edge(sink, i, i + 1);
+		 else if (wrap && cols > 2)
+			 put_edge(sink, i - cols + 1, i);
+		 if (i / cols + 1 < rows)
+			 put_edge(sink, i, i + cols);
+		 else if (wrap && rows > 2)
+			 put_edge(sink, i % cols, i);
+	 }
+ }
+ 
+ /**
+  * @brief Write the graph of a point.
+  *
+  * @details
+  * A ring of two has two forks between the same philosophers, as the
+  * classic table does; a ring of one has none.
+  *
+  * @param out Edge list destination.
+  * @param bench Benchmark settings, for `regular` graphs.
+  * @param point Point with `kind`, `count` and `repeat` set; receives
+  * `forks` and `degree_max`.
+  * @return 0 on success, -1 on a failed allocation or a `regular` graph
+  * that cannot be drawn.
+  *
+  * @ingroup philosopher_graph
+  */
+ int	write_graph(FILE *out, t_graph_bench *bench, t_graph_point *point)
+ {
+	 t_graph_sink	sink;
+	 int				i;
+	 int				status;
+ 
+	 sink = (t_graph_sink){out, calloc(point->count, sizeof(int)), point};
+	 point->forks = 0;
+	 point->degree_max = 0;
+	 if (!sink.degrees)
+		 return (-1);
+	 fprintf(out, "# %s graph of %d philosophers\n",
+		 graph_kind_name(point->kind), point->count);
+	 status = 0;
+	 i = -1;
+	 if (point->kind == 0)
+		 while (++i < point->count - (point->count == 1))
+			 put_edge(&sink, i, (i + 1) % point->count);
+	 else if (point->kind == 1 || point->kind == 2)
+		 write_grid(&sink, point->count, point->kind == 2);
+	 else if (point->kind == 3)
+		 status = draw_regular(&sink, bench);
+	 else
+		 while (++i < point->count - 1)
+			 put_edge(&sink, 0, i + 1);
+	 free(sink.degrees);
+	 return (status);
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,108 @@
+/**
+ * @file drain.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Readers emptying the pipe and terminal sinks.
+ *
+ * @details
+ * A reader is a forked process: it keeps reading while `philo` writes and
+ * is killed by `close_sink` once the run is over.
+ *
+ * @ingroup philosopher_io
+ */
+
+ #include "../../include/philo_io.h"
+ #include <errno.h>
+ #include <unistd.h>
+
+ /**
+  * @internal
+  * @brief Read a tenth of a second's worth of `rate`, at most 4 KiB.
+  *
+  * @details
+  * Sleeps first for as long as the previous read takes at `rate` bytes
+  * per second.
+  *
+  * @param fd Descriptor to read.
+  * @param buffer Buffer of at least 4 KiB.
+  * @param last Bytes returned by the previous read.
+  * @param rate Bytes per second, above 0.
+  * @return What `read` returned.
+  *
+  * @ingroup philosopher_io
+  */
+ static ssize_t	sip(int fd, char *buffer, ssize_t last, int rate)
+ {
+	 size_t	size;
+ 
+	 if (last > 0)
+		 usleep(last * 1000000LL / rate);
+	 size = rate / 10 + 1;
+	 if (size > 4096)
+		 size = 4096;
+	 return (read(fd, buffer, size));
+ }
+ 
+ /**
+  * @internal
+  * @brief Read `fd` until end of file, then exit.
+  *
+  * @details
+  * With a `rate`, the reader sips (see `sip`) to average `rate` bytes per
+  * second, like a slow terminal or a consumer doing real work, for the
+  * first `slow_for` ms. After that, or without a rate, it reads 64 KiB at
+  * a time and never sleeps, so that output buffered by `philo` does not
+  * outlast the run by minutes.
+  *
+  * @param fd Descriptor to read.
+  * @param rate Bytes per second, 0 for as fast as possible.
+  * @param slow_for How long the rate applies (ms).
+  *
+  * @ingroup philosopher_io
+  */
+ static void	drain(int fd, int rate, int slow_for)
+ {
+	 static char	buffer[65536];
+	 double		until;
+	 ssize_t		got;
+ 
+	 until = 0;
+	 if (rate)
+		 until = bench_clock() + slow_for / 1e3;
+	 got = 0;
+	 while (got >= 0 || errno == EINTR)
+	 {
+		 if (bench_clock() < until)
+			 got = sip(fd, buffer, got, rate);
+		 else
+			 got = read(fd, buffer, sizeof(buffer));
+		 if (got == 0)
+			 break ;
+	 }
+	 _exit(0);
+ }
+ 
+ /**
+  * @brief Fork a process that reads `fd` until end of file.
+  *
+  * @param fd Read end of the pipe or master side of the terminal.
+  * @param other Write end held by the parent, closed in the reader.
+  * @param rate Bytes per second, 0 for as fast as possible.
+  * @param slow_for How long the rate applies (ms).
+  * @return The reader's pid, or -1 if `fork` failed.
+  *
+  * @ingroup philosopher_io
+  */
+ pid_t	start_drain(int fd, int other, int rate, int slow_for)
+ {
+	 pid_t	pid;
+ 
+	 pid = fork();
+	 if (pid == 0)
+	 {
+		 close(other);
+		 drain(fd, rate, slow_for);
+	 }
+	 return (pid);
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,138 @@
+/**
+ * @file io.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Entry point of the `philo-io` output sink benchmark.
+ *
+ * @details
+ * Usage: `philo-io [-b philo] [-o out.csv] [-c scenario]... [-k sinks]
+ * [-W writers] ...`. Runs every scenario with every selected writer into
+ * every selected sink, `repeats` times, and writes one CSV row per run. Progress goes to stderr. Exits with 1
+ * on usage errors.
+ *
+ * @ingroup philosopher_io
+ */
+
+ #include "../../include/philo_io.h"
+
+ /**
+  * @internal
+  * @brief Write the CSV header.
+  *
+  * @param out CSV stream.
+  *
+  * @ingroup philosopher_io
+  */
+ static void	print_header(FILE *out)
+ {
+	 fprintf(out, "scenario,writer,sink,repeat,outcome,lines,elapsed_ms,"
+		 "lines_per_s,hold_avg_us,hold_max_us,wait_avg_us,wait_max_us,"
+		 "min_margin_ms,margin_change_ms,cpu_s\n");
+ }
+ 
+ /**
+  * @internal
+  * @brief Write one run as a CSV row.
+  *
+  * @details
+  * `margin_change_ms` is the run's smallest margin minus that of the
+  * `null` sink for the same scenario, writer and repeat: how much closer to
+  * starving the output brought the philosophers. It is left empty when
+  * there is no baseline or no figures.
+  *
+  * @param out CSV stream.
+  * @param point Measured run.
+  * @param baseline `null` sink run of the same scenario, writer and
+  * repeat, or NULL.
+  *
+  * @ingroup philosopher_io
+  */
+ static void	print_point(FILE *out, t_io_point *point, t_io_point *baseline)
+ {
+	 fprintf(out, "%s,%s,%s,%d,%s,%ld,%lld,", point->scenario,
+		 writer_name(point->writer), sink_name(point->sink), point->repeat,
+		 point->outcome, point->lines, point->elapsed);
+	 if (point->elapsed > 0)
+		 fprintf(out, "%.0f", point->lines * 1e3 / point->elapsed);
+	 fprintf(out, ",%.2f,%.2f,%.2f,%.2f,", point->hold_avg, point->hold_max,
+		 point->wait_avg, point->wait_max);
+	 if (point->elapsed > 0)
+		 fprintf(out, "%lld", point->min_margin);
+	 fprintf(out, ",");
+	 if (baseline && baseline->elapsed > 0 && point->elapsed > 0)
+		 fprintf(out, "%lld", point->min_margin - baseline->min_margin);
+	 fprintf(out, ",%.3f\n", point->cpu);
+	 fflush(out);
+ }
+ 
+ /**
+  * @internal
+  * @brief Measure one scenario and repeat with every writer and sink.
+  *
+  * @details
+  * The `null` sink, when selected, is measured first for every writer so
+  * that the other sinks can be compared with it.
+  *
+  * @param io Benchmark settings.
+  * @param point Point with `scenario` and `repeat` set.
+  *
+  * @ingroup philosopher_io
+  */
+ static void	measure_repeat(t_io *io, t_io_point *point)
+ {
+	 t_io_point	baseline;
+	 t_io_point	*against;
+ 
+	 against = NULL;
+	 if (io->sinks[0])
+		 against = &baseline;
+	 point->writer = -1;
+	 while (++point->writer < IO_WRITERS)
+	 {
+		 point->sink = -1;
+		 while (io->writers[point->writer] && ++point->sink < IO_SINKS)
+		 {
+			 if (!io->sinks[point->sink])
+				 continue ;
+			 fprintf(stderr, "philo-io: \"%s\" with %s into %s, run %d\n",
+				 point->scenario, writer_name(point->writer),
+				 sink_name(point->sink), point->repeat + 1);
+			 measure_sink(io, point);
+			 if (point->sink == 0)
+				 baseline = *point;
+			 print_point(io->out, point, against);
+		 }
+	 }
+ }
+ 
+ /**
+  * @brief Run the output benchmark.
+  *
+  * @param argc Argument count.
+  * @param argv Argument vector.
+  * @return 0 when the benchmark ran, 1 on usage errors.
+  *
+  * @ingroup philosopher_io
+  */
+ int	main(int argc, char **argv)
+ {
+	 t_io		io;
+	 t_io_point	point;
+	 int			s;
+ 
+	 if (parse_io_options(&io, argc, argv) == -1)
+		 return (1);
+	 print_header(io.out);
+	 s = -1;
+	 while (++s < io.scenario_len)
+	 {
+		 point.scenario = io.scenarios[s];
+		 point.repeat = -1;
+		 while (++point.repeat < io.repeats)
+			 measure_repeat(&io, &point);
+	 }
+	 if (io.out != stdout)
+		 fclose(io.out);
+	 return (0);
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,145 @@
+/**
+ * @file measure.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief One run of the output benchmark.
+ *
+ * @ingroup philosopher_io
+ */
+
+ #include "../../include/philo_io.h"
+ #include <stddef.h>
+ #include <stdlib.h>
+ #include <string.h>
+ #include <unistd.h>
+
+ /**
+  * @internal
+  * @brief Fill the argument vector of a run.
+  *
+  * @details
+  * Runs `philo --run-for=<ms> --io-stats --writer=<writer> <scenario>`,
+  * the scenario being split on spaces into the storage `words`.
+  *
+  * @param io Benchmark settings.
+  * @param run Run whose `argv` and `timeout` are filled.
+  * @param options The `--run-for` and `--writer` options.
+  * @param words Copy of the scenario, split in place.
+  *
+  * @ingroup philosopher_io
+  */
+ static void	set_arguments(t_io *io, t_bench_run *run, char options[2][32],
+		 char *words)
+ {
+	 char	*word;
+	 int		argc;
+ 
+	 bench_init(run);
+	 run->argv[0] = (char *) io->philo_bin;
+	 run->argv[1] = options[0];
+	 run->argv[2] = options[1];
+	 run->argv[3] = "--io-stats";
+	 argc = 4;
+	 word = strtok(words, " ");
+	 while (word && argc < BENCH_MAX_ARGS)
+	 {
+		 run->argv[argc++] = word;
+		 word = strtok(NULL, " ");
+	 }
+	 run->argv[argc] = NULL;
+	 run->timeout = io->run_for + io->timeout;
+ }
+ 
+ /**
+  * @internal
+  * @brief Read the `--io-stats` line from `philo`'s stderr.
+  *
+  * @param path File holding the run's stderr.
+  * @param point Point whose figures are filled in.
+  * @return 0 on success, -1 if the line is missing.
+  *
+  * @ingroup philosopher_io
+  */
+ static int	read_io_stats(const char *path, t_io_point *point)
+ {
+	 FILE	*bill;
+	 char	line[512];
+	 int		found;
+ 
+	 bill = fopen(path, "r");
+	 if (!bill)
+		 return (-1);
+	 found = 0;
+	 while (found != 7 && fgets(line, sizeof(line), bill))
+		 found = sscanf(line, "philo: io %ld lines in %lld ms, lock held %lf"
+				 " us avg %lf us max, waited %lf us avg %lf us max, min margin"
+				 " %lld ms", &point->lines, &point->elapsed, &point->hold_avg,
+				 &point->hold_max, &point->wait_avg, &point->wait_max,
+				 &point->min_margin);
+	 fclose(bill);
+	 if (found != 7)
+		 return (-1);
+	 return (0);
+ }
+ 
+ /**
+  * @internal
+  * @brief Settle the outcome of a finished run and record its CPU time.
+  *
+  * @param point Point whose outcome is `ran` or `error` so far.
+  * @param run The finished run.
+  *
+  * @ingroup philosopher_io
+  */
+ static void	judge_run(t_io_point *point, const t_bench_run *run)
+ {
+	 if (run->killed)
+		 point->outcome = "hung";
+	 else if (point->outcome[0] == 'r' && point->min_margin <= 0)
+		 point->outcome = "died";
+	 point->cpu = run->cpu;
+ }
+ 
+ /**
+  * @brief Run one scenario into one sink and read its figures.
+  *
+  * @details
+  * The outcome is `died` when the monitor saw a philosopher reach
+  * `time_to_die` (a margin of 0 or less), `ran` when the dinner lasted its
+  * wall time, `hung` when the watchdog killed it and `error` when no
+  * figures came back.
+  *
+  * @param io Benchmark settings.
+  * @param point Point with `scenario`, `sink`, `writer` and `repeat` set;
+  * the rest is filled in.
+  *
+  * @ingroup philosopher_io
+  */
+ void	measure_sink(t_io *io, t_io_point *point)
+ {
+	 t_bench_run	run;
+	 t_sink		sink;
+	 char		options[2][32];
+	 char		words[256];
+	 char		path[PATH_MAX];
+ 
+	 snprintf(options[0], 32, "--run-for=%d", io->run_for);
+	 snprintf(options[1], 32, "--writer=%s", writer_name(point->writer));
+	 snprintf(words, sizeof(words), "%s", point->scenario);
+	 set_arguments(io, &run, options, words);
+	 memset(&point->lines, 0, sizeof(*point) - offsetof(t_io_point, lines));
+	 point->outcome = "error";
+	 if (make_temp(path, "philo-io") == -1)
+		 return ;
+	 run.err_path = path;
+	 if (open_sink(&sink, point->sink, io) == 0)
+	 {
+		 run.out_fd = sink.fd;
+		 if (bench_run(&run) == 0 && read_io_stats(path, point) == 0)
+			 point->outcome = "ran";
+		 close_sink(&sink);
+	 }
+	 judge_run(point, &run);
+	 unlink(path);
+ }
+ 
\ No newline at end of file
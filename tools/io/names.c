@@ -0,0 +1,43 @@
+/**
+ * @file names.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Names of the sinks and writers of the output benchmark.
+ *
+ * @ingroup philosopher_io
+ */
+
+ #include "../../include/philo_io.h"
+
+ /**
+  * @brief Name of a sink, as used by `-k` and in the CSV.
+  *
+  * @param kind Sink index, below IO_SINKS.
+  * @return The sink's name.
+  *
+  * @ingroup philosopher_io
+  */
+ const char	*sink_name(int kind)
+ {
+	 static const char	*names[IO_SINKS] = {"null", "file", "pipe", "tty",
+		 "slow"};
+ 
+	 return (names[kind]);
+ }
+ 
+ /**
+  * @brief Name of a `philo --writer`, as used by `-W` and in the CSV.
+  *
+  * @param writer Writer index, below IO_WRITERS, in WRITER_* order.
+  * @return The writer's name.
+  *
+  * @ingroup philosopher_io
+  */
+ const char	*writer_name(int writer)
+ {
+	 static const char	*names[IO_WRITERS] = {"stdio", "write", "uring",
+		 "splice"};
+ 
+	 return (names[writer]);
+ }
+ 
\ No newline at end of file
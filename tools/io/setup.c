@@ -0,0 +1,180 @@
+/**
+ * @file setup.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Command-line parsing for `philo-io`.
+ *
+ * @ingroup philosopher_io
+ */
+
+ #include "../../include/philo_io.h"
+ #include <stdlib.h>
+ #include <string.h>
+ #include <unistd.h>
+
+ /**
+  * @internal
+  * @brief Fill the default benchmark.
+  *
+  * @details
+  * Two scenarios: a flood, where nobody can die and meals and naps take no
+  * time, so the philosophers do little but print; and an ordinary dinner
+  * with 400 ms of slack, where slow output shows up as a shrinking margin.
+  * Every sink is measured with every writer for 5 s, the slow reader
+  * taking 1 KiB per second, so that even the ordinary dinner fills its
+  * pipe.
+  *
+  * @param io Benchmark to initialize.
+  *
+  * @ingroup philosopher_io
+  */
+ static void	set_io_defaults(t_io *io)
+ {
+	 int	kind;
+ 
+	 memset(io, 0, sizeof(*io));
+	 io->philo_bin = "./bin/philo-release";
+	 io->out = stdout;
+	 io->run_for = 5000;
+	 io->rate = 1024;
+	 io->repeats = 1;
+	 io->timeout = 10000;
+	 kind = -1;
+	 while (++kind < IO_SINKS)
+		 io->sinks[kind] = true;
+	 kind = -1;
+	 while (++kind < IO_WRITERS)
+		 io->writers[kind] = true;
+ }
+ 
+ /**
+  * @internal
+  * @brief Print the usage message to stderr.
+  *
+  * @ingroup philosopher_io
+  */
+ static void	io_usage(void)
+ {
+	 fprintf(stderr, "Usage: philo-io [-b philo] [-o out.csv]"
+		 " [-c \"N die eat sleep [meals]\"]...\n"
+		 "                [-k sinks] [-W writers] [-w run_for_ms]"
+		 " [-R bytes_per_s] [-r repeats]\n"
+		 "                [-t timeout_ms]\n"
+		 "  Sinks are comma separated among null,file,pipe,tty,slow\n"
+		 "  Writers are comma separated among stdio,write,uring,splice\n");
+ }
+ 
+ /**
+  * @internal
+  * @brief Select the entries named in a comma separated list.
+  *
+  * @param list Names, e.g. `null,slow`.
+  * @param selected Flags to replace, one per name.
+  * @param count Number of names.
+  * @param name Function giving the name of each index.
+  * @return 0 on success, -1 on an unknown name.
+  *
+  * @ingroup philosopher_io
+  */
+ static int	parse_names(char *list, bool *selected, int count,
+		 const char *(*name)(int))
+ {
+	 char	*word;
+	 int		i;
+ 
+	 memset(selected, 0, count * sizeof(*selected));
+	 word = strtok(list, ",");
+	 while (word)
+	 {
+		 i = 0;
+		 while (i < count && strcmp(word, name(i)) != 0)
+			 i++;
+		 if (i == count)
+			 return (-1);
+		 selected[i] = true;
+		 word = strtok(NULL, ",");
+	 }
+	 return (0);
+ }
+ 
+ /**
+  * @internal
+  * @brief Apply one parsed `getopt` option to the benchmark.
+  *
+  * @param io Benchmark being configured.
+  * @param opt Option character.
+  * @param arg Option argument.
+  * @return 0 on success, -1 on an invalid value.
+  *
+  * @ingroup philosopher_io
+  */
+ static int	apply_io_option(t_io *io, int opt, char *arg)
+ {
+	 if (opt == 'b')
+		 io->philo_bin = arg;
+	 else if (opt == 'o')
+		 io->out = fopen(arg, "w");
+	 else if (opt == 'c' && io->scenario_len < IO_MAX_SCENARIOS)
+		 io->scenarios[io->scenario_len++] = arg;
+	 else if (opt == 'k')
+		 return (parse_names(arg, io->sinks, IO_SINKS, sink_name));
+	 else if (opt == 'W')
+		 return (parse_names(arg, io->writers, IO_WRITERS, writer_name));
+	 else if (opt == 'w')
+		 io->run_for = atoi(arg);
+	 else if (opt == 'R')
+		 io->rate = atoi(arg);
+	 else if (opt == 'r')
+		 io->repeats = atoi(arg);
+	 else if (opt == 't')
+		 io->timeout = atoi(arg);
+	 else
+		 return (-1);
+	 if (!io->out)
+		 return (-1);
+	 return (0);
+ }
+ 
+ /**
+  * @brief Parse `philo-io` command-line options.
+  *
+  * @details
+  * Without `-c`, the default scenarios `200 2147483647 0 0` and
+  * `100 800 200 200` are measured.
+  *
+  * @param io Benchmark to fill.
+  * @param argc Argument count.
+  * @param argv Argument vector.
+  * @return 0 on success, -1 after printing the usage on error.
+  *
+  * @ingroup philosopher_io
+  */
+ int	parse_io_options(t_io *io, int argc, char **argv)
+ {
+	 int	opt;
+ 
+	 set_io_defaults(io);
+	 opt = getopt(argc, argv, "b:o:c:k:W:w:R:r:t:");
+	 while (opt != -1)
+	 {
+		 if (apply_io_option(io, opt, optarg) == -1)
+		 {
+			 io_usage();
+			 return (-1);
+		 }
+		 opt = getopt(argc, argv, "b:o:c:k:W:w:R:r:t:");
+	 }
+	 if (io->scenario_len == 0)
+	 {
+		 io->scenarios[io->scenario_len++] = "200 2147483647 0 0";
+		 io->scenarios[io->scenario_len++] = "100 800 200 200";
+	 }
+	 if (optind != argc || io->run_for < 1 || io->rate < 1
+		 || io->repeats < 1 || io->timeout < 1)
+	 {
+		 io_usage();
+		 return (-1);
+	 }
+	 return (0);
+ }
+ 
\ No newline at end of file
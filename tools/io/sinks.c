@@ -0,0 +1,158 @@
+/**
+ * @file sinks.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief The stdout sinks of the output benchmark.
+ *
+ * @details
+ * Every descriptor is close-on-exec, so `philo` only inherits the one
+ * `bench_run` moves onto its stdout. Pipes and terminals are emptied by a
+ * forked reader (see drain.c), which `close_sink` kills once the run is
+ * over.
+ *
+ * @ingroup philosopher_io
+ */
+
+ #define _GNU_SOURCE
+ #include "../../include/philo_io.h"
+ #include <fcntl.h>
+ #include <signal.h>
+ #include <stdlib.h>
+ #include <sys/wait.h>
+ #include <unistd.h>
+ 
+ /**
+  * @internal
+  * @brief Create the temporary file of the `file` sink in `$TMPDIR`.
+  *
+  * @param sink Sink whose `fd` and `path` are filled in.
+  *
+  * @ingroup philosopher_io
+  */
+ static void	open_file(t_sink *sink)
+ {
+	 const char	*dir;
+ 
+	 dir = getenv("TMPDIR");
+	 if (!dir)
+		 dir = "/tmp";
+	 snprintf(sink->path, PATH_MAX, "%s/philo-io-XXXXXX", dir);
+	 sink->fd = mkostemp(sink->path, O_CLOEXEC);
+ }
+ 
+ /**
+  * @internal
+  * @brief Open a pseudo-terminal and drain its master side.
+  *
+  * @details
+  * The slave keeps its default line discipline, output processing
+  * included, so `philo` sees the same terminal it would in a shell.
+  *
+  * @param sink Sink whose `fd` and `drain` are filled in.
+  * @return 0 on success, -1 on failure.
+  *
+  * @ingroup philosopher_io
+  */
+ static int	open_tty(t_sink *sink)
+ {
+	 int	master;
+ 
+	 master = posix_openpt(O_RDWR | O_NOCTTY | O_CLOEXEC);
+	 if (master == -1)
+		 return (-1);
+	 if (grantpt(master) == -1 || unlockpt(master) == -1)
+	 {
+		 close(master);
+		 return (-1);
+	 }
+	 sink->fd = open(ptsname(master), O_WRONLY | O_NOCTTY | O_CLOEXEC);
+	 if (sink->fd != -1)
+		 sink->drain = start_drain(master, sink->fd, 0, 0);
+	 close(master);
+	 if (sink->fd == -1 || sink->drain == -1)
+		 return (-1);
+	 return (0);
+ }
+ 
+ /**
+  * @internal
+  * @brief Open a pipe and drain its read end.
+  *
+  * @param sink Sink whose `fd` and `drain` are filled in.
+  * @param rate Bytes per second the reader takes, 0 for as fast as
+  * possible.
+  * @param slow_for How long the rate applies (ms).
+  *
+  * @ingroup philosopher_io
+  */
+ static void	open_pipe(t_sink *sink, int rate, int slow_for)
+ {
+	 int	ends[2];
+ 
+	 if (pipe2(ends, O_CLOEXEC) == -1)
+		 return ;
+	 sink->fd = ends[1];
+	 sink->drain = start_drain(ends[0], ends[1], rate, slow_for);
+	 close(ends[0]);
+ }
+ 
+ /**
+  * @brief Open the stdout of one run.
+  *
+  * @param sink Sink to open.
+  * @param kind Sink index, below IO_SINKS.
+  * @param io Benchmark settings: the `slow` reader takes `rate` bytes per
+  * second during the `run_for` ms of the dinner.
+  * @return 0 on success, -1 on failure (the sink is left closed).
+  *
+  * @ingroup philosopher_io
+  */
+ int	open_sink(t_sink *sink, int kind, t_io *io)
+ {
+	 sink->kind = kind;
+	 sink->fd = -1;
+	 sink->drain = -1;
+	 sink->path[0] = '\0';
+	 if (kind == 0)
+		 sink->fd = open("/dev/null", O_WRONLY | O_CLOEXEC);
+	 else if (kind == 1)
+		 open_file(sink);
+	 else if (kind == 3)
+		 open_tty(sink);
+	 else if (kind == 4)
+		 open_pipe(sink, io->rate, io->run_for);
+	 else
+		 open_pipe(sink, 0, 0);
+	 if (sink->fd != -1 && (kind < 2 || sink->drain != -1))
+		 return (0);
+	 close_sink(sink);
+	 return (-1);
+ }
+ 
+ /**
+  * @brief Close a sink, stop its reader and remove its file.
+  *
+  * @details
+  * The reader is killed rather than waited for: once `philo` has exited,
+  * whatever is still buffered no longer matters.
+  *
+  * @param sink Sink to close.
+  *
+  * @ingroup philosopher_io
+  */
+ void	close_sink(t_sink *sink)
+ {
+	 if (sink->fd != -1)
+		 close(sink->fd);
+	 if (sink->drain > 0)
+	 {
+		 kill(sink->drain, SIGKILL);
+		 waitpid(sink->drain, NULL, 0);
+	 }
+	 if (sink->path[0])
+		 unlink(sink->path);
+	 sink->fd = -1;
+	 sink->drain = -1;
+	 sink->path[0] = '\0';
+ }
+ 
\ No newline at end of file
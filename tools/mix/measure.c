@@ -0,0 +1,159 @@
+/**
+ * @file measure.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief One run of the heterogeneity benchmark.
+ *
+ * @details
+ * The scenario and the report are temporary files in `$TMPDIR`, deleted
+ * once the run is read.
+ *
+ * @ingroup philosopher_mix
+ */
+
+ #include "../../include/philo_mix.h"
+ #include <stddef.h>
+ #include <stdlib.h>
+ #include <string.h>
+ #include <unistd.h>
+
+ /**
+  * @brief One philosopher's timing at the spread of a point.
+  *
+  * @details
+  * The factor comes from a splitmix64 hash of the seed, the repeat and the
+  * draw, so it is the same for every spread and every platform.
+  *
+  * @param mix Benchmark settings.
+  * @param point Point with `spread` and `repeat` set.
+  * @param draw Which draw: twice the philosopher's index, plus 1 for naps.
+  * @param base Time of the command line (ms).
+  * @return The philosopher's time (ms), at least 1.
+  *
+  * @ingroup philosopher_mix
+  */
+ int	mixed_time(t_mix *mix, t_mix_point *point, int draw, int base)
+ {
+	 unsigned long long	z;
+	 double				factor;
+	 int					time;
+ 
+	 z = ((unsigned long long) mix->seed << 32) + point->repeat * 1000003ULL
+		 + draw + 0x9e3779b97f4a7c15ULL;
+	 z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	 z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+	 z ^= z >> 31;
+	 factor = 1 + point->spread / 100.0 * ((z >> 11) / 4503599627370496.0 - 1);
+	 time = (int)(base * factor + 0.5);
+	 if (time < 1)
+		 time = 1;
+	 return (time);
+ }
+ 
+ /**
+  * @internal
+  * @brief Write the scenario file of a point.
+  *
+  * @param mix Benchmark settings.
+  * @param point Point with `spread` and `repeat` set.
+  * @param path Temporary file to fill.
+  * @return 0 on success, -1 on failure.
+  *
+  * @ingroup philosopher_mix
+  */
+ static int	write_scenario(t_mix *mix, t_mix_point *point, const char *path)
+ {
+	 FILE	*file;
+	 int		i;
+ 
+	 file = fopen(path, "w");
+	 if (!file)
+		 return (-1);
+	 fprintf(file, "# spread %d%%, seed %u, repeat %d\n", point->spread,
+		 mix->seed, point->repeat);
+	 i = -1;
+	 while (++i < mix->count)
+		 fprintf(file, "%d - %d %d\n", i + 1,
+			 mixed_time(mix, point, 2 * i, mix->time_to_eat),
+			 mixed_time(mix, point, 2 * i + 1, mix->time_to_sleep));
+	 if (fclose(file) != 0)
+		 return (-1);
+	 return (0);
+ }
+ 
+ /**
+  * @internal
+  * @brief Fill the argument vector of a run.
+  *
+  * @details
+  * Runs `philo --run-for=<ms> --format=none --report=<path>
+  * --scenario=<path> N die eat sleep`.
+  *
+  * @param mix Benchmark settings.
+  * @param run Run whose `argv` and `timeout` are filled.
+  * @param args Storage for the options and numbers.
+  * @param paths Scenario and report files.
+  *
+  * @ingroup philosopher_mix
+  */
+ static void	set_arguments(t_mix *mix, t_bench_run *run,
+		 char args[7][PATH_MAX + 16], char paths[2][PATH_MAX])
+ {
+	 int	i;
+ 
+	 bench_init(run);
+	 snprintf(args[0], PATH_MAX + 16, "--run-for=%d", mix->run_for);
+	 snprintf(args[1], PATH_MAX + 16, "--scenario=%.*s",
+		 PATH_MAX, paths[0]);
+	 snprintf(args[2], PATH_MAX + 16, "--report=%.*s",
+		 PATH_MAX, paths[1]);
+	 snprintf(args[3], PATH_MAX + 16, "%d", mix->count);
+	 snprintf(args[4], PATH_MAX + 16, "%d", mix->time_to_die);
+	 snprintf(args[5], PATH_MAX + 16, "%d", mix->time_to_eat);
+	 snprintf(args[6], PATH_MAX + 16, "%d", mix->time_to_sleep);
+	 run->argv[0] = (char *) mix->philo_bin;
+	 run->argv[1] = "--format=none";
+	 i = -1;
+	 while (++i < 7)
+		 run->argv[i + 2] = args[i];
+	 run->argv[9] = NULL;
+	 run->timeout = mix->run_for + mix->timeout;
+ }
+ 
+ /**
+  * @brief Run one spread and read its figures.
+  *
+  * @details
+  * The outcome is the report's (`time` when the dinner lasted its wall
+  * time, `died` otherwise), `hung` when the watchdog killed it and `error`
+  * when no report came back.
+  *
+  * @param mix Benchmark settings.
+  * @param point Point with `spread` and `repeat` set; the rest is filled
+  * in.
+  *
+  * @ingroup philosopher_mix
+  */
+ void	measure_mix(t_mix *mix, t_mix_point *point)
+ {
+	 static char	args[7][PATH_MAX + 16];
+	 char		paths[2][PATH_MAX];
+	 t_bench_run	run;
+ 
+	 memset(&point->died, 0, sizeof(*point) - offsetof(t_mix_point, died));
+	 point->outcome = "error";
+	 if (make_temp(paths[0], "philo-mix") == -1)
+		 return ;
+	 if (make_temp(paths[1], "philo-mix") == 0)
+	 {
+		 set_arguments(mix, &run, args, paths);
+		 if (write_scenario(mix, point, paths[0]) == 0 && bench_run(&run) == 0)
+			 read_mix_report(mix, point, paths[1]);
+		 if (run.killed)
+			 point->outcome = "hung";
+		 point->cpu = run.cpu;
+		 unlink(paths[1]);
+	 }
+	 unlink(paths[0]);
+ }
+ 
\ No newline at end of file
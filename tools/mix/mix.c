@@ -0,0 +1,99 @@
+/**
+ * @file mix.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Entry point of the `philo-mix` heterogeneity benchmark.
+ *
+ * @details
+ * Usage: `philo-mix [-b philo] [-o out.csv] [-n count] [-H spreads] ...`.
+ * Runs the dinner at every spread, `repeats` times, and writes one CSV row
+ * per run, ready for gnuplot or a dataframe. Progress goes to stderr.
+ * Exits with 1 on usage errors.
+ *
+ * @ingroup philosopher_mix
+ */
+
+ #include "../../include/philo_mix.h"
+
+ /**
+  * @internal
+  * @brief Write the CSV header.
+  *
+  * @param out CSV stream.
+  *
+  * @ingroup philosopher_mix
+  */
+ static void	print_header(FILE *out)
+ {
+	 fprintf(out, "philosophers,spread_pct,repeat,outcome,died,meals,"
+		 "runtime_ms,meals_per_s,duty_avg,duty_min,fairness,slack_min_ms,"
+		 "cpu_s\n");
+ }
+ 
+ /**
+  * @internal
+  * @brief Write one run as a CSV row.
+  *
+  * @details
+  * Figures are left empty when no report came back, and `died` when
+  * nobody died.
+  *
+  * @param out CSV stream.
+  * @param mix Benchmark settings.
+  * @param point Measured run.
+  *
+  * @ingroup philosopher_mix
+  */
+ static void	print_point(FILE *out, t_mix *mix, t_mix_point *point)
+ {
+	 fprintf(out, "%d,%d,%d,%s,", mix->count, point->spread, point->repeat,
+		 point->outcome);
+	 if (point->died)
+		 fprintf(out, "%d", point->died);
+	 if (point->runtime > 0)
+		 fprintf(out, ",%ld,%lld,%.1f,%.3f,%.3f,%.4f,%lld", point->meals,
+			 point->runtime, point->meals * 1e3 / point->runtime,
+			 point->duty_avg, point->duty_min, point->fairness,
+			 point->slack_min);
+	 else
+		 fprintf(out, ",,,,,,,");
+	 fprintf(out, ",%.3f\n", point->cpu);
+	 fflush(out);
+ }
+ 
+ /**
+  * @brief Run the heterogeneity benchmark.
+  *
+  * @param argc Argument count.
+  * @param argv Argument vector.
+  * @return 0 when the benchmark ran, 1 on usage errors.
+  *
+  * @ingroup philosopher_mix
+  */
+ int	main(int argc, char **argv)
+ {
+	 t_mix		mix;
+	 t_mix_point	point;
+	 int			s;
+ 
+	 if (parse_mix_options(&mix, argc, argv) == -1)
+		 return (1);
+	 print_header(mix.out);
+	 s = -1;
+	 while (++s < mix.spread_len)
+	 {
+		 point.spread = mix.spreads[s];
+		 point.repeat = -1;
+		 while (++point.repeat < mix.repeats)
+		 {
+			 fprintf(stderr, "philo-mix: N=%d, spread %d%%, run %d\n",
+				 mix.count, point.spread, point.repeat + 1);
+			 measure_mix(&mix, &point);
+			 print_point(mix.out, &mix, &point);
+		 }
+	 }
+	 if (mix.out != stdout)
+		 fclose(mix.out);
+	 return (0);
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,172 @@
+/**
+ * @file setup.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Command-line parsing for `philo-mix`.
+ *
+ * @ingroup philosopher_mix
+ */
+
+ #include "../../include/philo_mix.h"
+ #include <stdlib.h>
+ #include <string.h>
+ #include <unistd.h>
+
+ /**
+  * @internal
+  * @brief Fill the default benchmark.
+  *
+  * @details
+  * 31 philosophers at `800 200 200`, an odd table with 200 ms to spare
+  * when every meal is the same, spread from 0 to 100 % for 5 s each.
+  *
+  * @param mix Benchmark to initialize.
+  *
+  * @ingroup philosopher_mix
+  */
+ static void	set_mix_defaults(t_mix *mix)
+ {
+	 memset(mix, 0, sizeof(*mix));
+	 mix->philo_bin = "./bin/philo-release";
+	 mix->out = stdout;
+	 mix->count = 31;
+	 mix->time_to_die = 800;
+	 mix->time_to_eat = 200;
+	 mix->time_to_sleep = 200;
+	 mix->run_for = 5000;
+	 mix->repeats = 1;
+	 mix->timeout = 10000;
+	 mix->seed = 42;
+ }
+ 
+ /**
+  * @internal
+  * @brief Print the usage message to stderr.
+  *
+  * @ingroup philosopher_mix
+  */
+ static void	mix_usage(void)
+ {
+	 fprintf(stderr, "Usage: philo-mix [-b philo] [-o out.csv] [-n count]"
+		 " [-d die] [-e eat] [-s sleep]\n"
+		 "                 [-H spreads] [-w run_for_ms] [-r repeats]"
+		 " [-t timeout_ms] [-x seed]\n"
+		 "  Spreads are comma separated percents, e.g. -H 0,50,100\n");
+ }
+ 
+ /**
+  * @internal
+  * @brief Parse a comma separated list of spreads.
+  *
+  * @details
+  * Like `parse_int_list`, but for percents, 0 included.
+  *
+  * @param mix Benchmark whose `spreads` are replaced.
+  * @param str List, e.g. `0,50,100`.
+  * @return 0 on success, -1 on an empty list or a value outside 0 to 100.
+  *
+  * @ingroup philosopher_mix
+  */
+ static int	parse_spreads(t_mix *mix, const char *str)
+ {
+	 char	*end;
+	 long	value;
+ 
+	 mix->spread_len = 0;
+	 while (*str)
+	 {
+		 value = strtol(str, &end, 10);
+		 if (end == str || value < 0 || value > 100
+			 || mix->spread_len == MIX_MAX_LIST || (*end && *end != ','))
+			 return (-1);
+		 mix->spreads[mix->spread_len++] = (int) value;
+		 str = end;
+		 if (*str == ',')
+			 str++;
+	 }
+	 if (mix->spread_len == 0)
+		 return (-1);
+	 return (0);
+ }
+ 
+ /**
+  * @internal
+  * @brief Apply one parsed `getopt` option to the benchmark.
+  *
+  * @param mix Benchmark being configured.
+  * @param opt Option character.
+  * @param arg Option argument.
+  * @return 0 on success, -1 on an invalid value.
+  *
+  * @ingroup philosopher_mix
+  */
+ static int	apply_mix_option(t_mix *mix, int opt, char *arg)
+ {
+	 if (opt == 'b')
+		 mix->philo_bin = arg;
+	 else if (opt == 'o')
+		 mix->out = fopen(arg, "w");
+	 else if (opt == 'n')
+		 mix->count = atoi(arg);
+	 else if (opt == 'd')
+		 mix->time_to_die = atoi(arg);
+	 else if (opt == 'e')
+		 mix->time_to_eat = atoi(arg);
+	 else if (opt == 's')
+		 mix->time_to_sleep = atoi(arg);
+	 else if (opt == 'H')
+		 return (parse_spreads(mix, arg));
+	 else if (opt == 'w')
+		 mix->run_for = atoi(arg);
+	 else if (opt == 'r')
+		 mix->repeats = atoi(arg);
+	 else if (opt == 't')
+		 mix->timeout = atoi(arg);
+	 else if (opt == 'x')
+		 mix->seed = strtoul(arg, NULL, 10);
+	 else
+		 return (-1);
+	 return (0);
+ }
+ 
+ /**
+  * @brief Parse `philo-mix` command-line options.
+  *
+  * @details
+  * Rejects fewer than two philosophers and non-positive timings. Without
+  * `-H`, the spreads are 0, 10, 25, 50, 75 and 100 %.
+  *
+  * @param mix Benchmark to fill.
+  * @param argc Argument count.
+  * @param argv Argument vector.
+  * @return 0 on success, -1 after printing the usage on error.
+  *
+  * @ingroup philosopher_mix
+  */
+ int	parse_mix_options(t_mix *mix, int argc, char **argv)
+ {
+	 int	opt;
+ 
+	 set_mix_defaults(mix);
+	 parse_spreads(mix, "0,10,25,50,75,100");
+	 opt = getopt(argc, argv, "b:o:n:d:e:s:H:w:r:t:x:");
+	 while (opt != -1)
+	 {
+		 if (apply_mix_option(mix, opt, optarg) == -1)
+		 {
+			 mix_usage();
+			 return (-1);
+		 }
+		 opt = getopt(argc, argv, "b:o:n:d:e:s:H:w:r:t:x:");
+	 }
+	 if (optind != argc || !mix->out || mix->count < 2
+		 || mix->time_to_die < 1 || mix->time_to_eat < 1
+		 || mix->time_to_sleep < 1 || mix->run_for < 1 || mix->repeats < 1
+		 || mix->timeout < 1)
+	 {
+		 mix_usage();
+		 return (-1);
+	 }
+	 return (0);
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,126 @@
+/**
+ * @file tally.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Figures of one heterogeneity run, from its `--report`.
+ *
+ * @details
+ * The report is read whole and scanned for the few members the benchmark
+ * needs (see reports.c).
+ *
+ * @ingroup philosopher_mix
+ */
+
+ #include "../../include/philo_mix.h"
+ #include <math.h>
+ #include <stdlib.h>
+ #include <string.h>
+
+ /**
+  * @internal
+  * @brief Read the outcome, the victim and the run time.
+  *
+  * @param point Point whose `outcome`, `died` and `runtime` are filled.
+  * @param text Report contents.
+  * @return 0 on success, -1 if a member is missing.
+  *
+  * @ingroup philosopher_mix
+  */
+ static int	read_ending(t_mix_point *point, const char *text)
+ {
+	 const char	*outcome;
+	 const char	*at;
+ 
+	 outcome = report_outcome(text);
+	 if (!outcome || report_number(text, "runtime_ms", &point->runtime) == -1)
+		 return (-1);
+	 point->outcome = outcome;
+	 at = strstr(text, "\"died\":{\"id\":");
+	 if (at)
+		 sscanf(at, "\"died\":{\"id\":%d", &point->died);
+	 return (0);
+ }
+ 
+ /**
+  * @internal
+  * @brief Add up the philosophers' lines.
+  *
+  * @details
+  * `sums` receives the number of philosophers, the sum of their duties
+  * and the sum of their squares.
+  *
+  * @param mix Benchmark settings.
+  * @param point Point whose meals, smallest duty and slack are filled.
+  * @param text Report contents, from the `philosophers` array on.
+  * @param sums Receives the three sums.
+  *
+  * @ingroup philosopher_mix
+  */
+ static void	add_duties(t_mix *mix, t_mix_point *point, const char *text,
+		 double sums[3])
+ {
+	 long long	slack;
+	 double		duty;
+	 long		meals;
+	 int			id;
+ 
+	 point->duty_min = INFINITY;
+	 point->slack_min = LLONG_MAX;
+	 text = strstr(text, "{\"id\":");
+	 while (text && sscanf(text, "{\"id\":%d,\"meals\":%ld,\"last_meal_ms\":%*d,"
+			 "\"hunger_max_ms\":%*d,\"slack_min_ms\":%lld", &id, &meals,
+			 &slack) == 3 && id >= 1 && id <= mix->count)
+	 {
+		 duty = (double) meals * (mixed_time(mix, point, 2 * id - 2,
+					 mix->time_to_eat) + mixed_time(mix, point, 2 * id - 1,
+					 mix->time_to_sleep)) / point->runtime;
+		 point->meals += meals;
+		 if (duty < point->duty_min)
+			 point->duty_min = duty;
+		 if (slack < point->slack_min)
+			 point->slack_min = slack;
+		 sums[0] += 1;
+		 sums[1] += duty;
+		 sums[2] += duty * duty;
+		 text = strstr(text + 1, "{\"id\":");
+	 }
+ }
+ 
+ /**
+  * @brief Read the figures of a run from its report.
+  *
+  * @param mix Benchmark settings.
+  * @param point Point with `spread` and `repeat` set; receives the
+  * outcome, meals, duties, fairness and smallest slack.
+  * @param path The run's `--report` file.
+  * @return 0 on success, -1 if the report is missing or incomplete.
+  *
+  * @ingroup philosopher_mix
+  */
+ int	read_mix_report(t_mix *mix, t_mix_point *point, const char *path)
+ {
+	 char	*text;
+	 char	*philosophers;
+	 double	sums[3];
+ 
+	 text = read_whole(path);
+	 if (!text)
+		 return (-1);
+	 philosophers = strstr(text, "\"philosophers\":[");
+	 memset(sums, 0, sizeof(sums));
+	 if (philosophers && read_ending(point, text) == 0
+		 && point->runtime > 0)
+		 add_duties(mix, point, philosophers, sums);
+	 free(text);
+	 if (sums[0] == 0)
+	 {
+		 point->outcome = "error";
+		 return (-1);
+	 }
+	 point->duty_avg = sums[1] / sums[0];
+	 point->fairness = 1;
+	 if (sums[2] > 0)
+		 point->fairness = sums[1] * sums[1] / (sums[0] * sums[2]);
+	 return (0);
+ }
+ 
\ No newline at end of file
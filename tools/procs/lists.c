@@ -0,0 +1,102 @@
+/**
+ * @file lists.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief The list options of `philo-procs`: modes, counts, workers and
+ * link delays.
+ *
+ * @ingroup philosopher_procs
+ */
+
+ #include "../../include/philo_procs.h"
+ #include <stdlib.h>
+ #include <string.h>
+
+ /**
+  * @internal
+  * @brief Parse a comma separated list of modes.
+  *
+  * @param procs Benchmark whose `modes` are replaced.
+  * @param str List, e.g. `threads,processes`.
+  * @return 0 on success, -1 on an empty list or an unknown mode.
+  *
+  * @ingroup philosopher_procs
+  */
+ static int	parse_modes(t_procs *procs, char *str)
+ {
+	 char	*name;
+	 char	*rest;
+ 
+	 procs->mode_len = 0;
+	 name = strtok_r(str, ",", &rest);
+	 while (name)
+	 {
+		 if (procs->mode_len == PROCS_MAX_LIST || find_procs_mode(name) < 0)
+			 return (-1);
+		 procs->modes[procs->mode_len++] = find_procs_mode(name);
+		 name = strtok_r(NULL, ",", &rest);
+	 }
+	 if (procs->mode_len == 0)
+		 return (-1);
+	 return (0);
+ }
+ 
+ /**
+  * @internal
+  * @brief Parse a comma separated list of link delays.
+  *
+  * @details
+  * Like `parse_int_list`, but for microseconds, 0 included.
+  *
+  * @param procs Benchmark whose `delays` are replaced.
+  * @param str List, e.g. `0,100,1000`.
+  * @return 0 on success, -1 on an empty list or a value outside 0 to a
+  * second.
+  *
+  * @ingroup philosopher_procs
+  */
+ static int	parse_delays(t_procs *procs, const char *str)
+ {
+	 char	*end;
+	 long	value;
+ 
+	 procs->delay_len = 0;
+	 while (*str)
+	 {
+		 value = strtol(str, &end, 10);
+		 if (end == str || value < 0 || value > 1000000
+			 || procs->delay_len == PROCS_MAX_LIST || (*end && *end != ','))
+			 return (-1);
+		 procs->delays[procs->delay_len++] = (int) value;
+		 str = end;
+		 if (*str == ',')
+			 str++;
+	 }
+	 if (procs->delay_len == 0)
+		 return (-1);
+	 return (0);
+ }
+ 
+ /**
+  * @brief Replace one axis of the benchmark with a comma separated list.
+  *
+  * @param procs Benchmark being configured.
+  * @param opt `m`, `n`, `k` or `L`: modes, counts, workers or link delays.
+  * @param arg The list.
+  * @return 0 on success, -1 on an invalid list.
+  *
+  * @ingroup philosopher_procs
+  */
+ int	apply_axis_option(t_procs *procs, int opt, char *arg)
+ {
+	 if (opt == 'm')
+		 return (parse_modes(procs, arg));
+	 if (opt == 'n')
+		 return (parse_int_list(arg, procs->counts, PROCS_MAX_LIST,
+				 &procs->count_len));
+	 if (opt == 'k')
+		 return (parse_int_list(arg, procs->workers, PROCS_MAX_LIST,
+				 &procs->worker_len));
+	 return (parse_delays(procs, arg));
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,127 @@
+/**
+ * @file measure.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief One run of the process benchmark.
+ *
+ * @details
+ * The report is a temporary file in `$TMPDIR`, deleted once the run is
+ * read.
+ *
+ * @ingroup philosopher_procs
+ */
+
+ #include "../../include/philo_procs.h"
+ #include <stddef.h>
+ #include <stdlib.h>
+ #include <string.h>
+ #include <unistd.h>
+
+ /**
+  * @internal
+  * @brief Add the options of a point's mode to the argument vector.
+  *
+  * @param run Run whose `argv` is being filled.
+  * @param args Storage; `args[5]` and `args[6]` receive the workers and
+  * the link delay.
+  * @param point Point being measured.
+  * @param n Next free slot of `argv`.
+  * @return The next free slot once the options are in.
+  *
+  * @ingroup philosopher_procs
+  */
+ static int	add_mode_options(t_bench_run *run, char args[7][PATH_MAX + 16],
+		 t_procs_point *point, int n)
+ {
+	 snprintf(args[5], PATH_MAX + 16, "--workers=%d", point->workers);
+	 snprintf(args[6], PATH_MAX + 16, "--link-delay=%d", point->delay);
+	 if (point->mode >= PROCS_WORKERS)
+		 run->argv[n++] = args[5];
+	 if (point->mode != PROCS_WORKERS && procs_mode(point->mode)[1])
+		 run->argv[n++] = (char *) procs_mode(point->mode)[1];
+	 if (point->mode > PROCS_WORKERS)
+		 run->argv[n++] = args[6];
+	 return (n);
+ }
+ 
+ /**
+  * @internal
+  * @brief Fill the argument vector of a run.
+  *
+  * @details
+  * Runs `philo --run-for=<ms> --format=none|text --report=<path>
+  * [--processes | --workers=<k> [--link=<how> --link-delay=<us>]] N
+  * INT_MAX eat sleep`: nobody can die, so the run only ends with its wall
+  * time. A text log goes to /dev/null.
+  *
+  * @param procs Benchmark settings.
+  * @param run Run whose `argv`, `cpus` and `timeout` are filled.
+  * @param args Storage for the options and numbers; the report option is
+  * already in `args[1]`.
+  * @param point Point being measured.
+  *
+  * @ingroup philosopher_procs
+  */
+ static void	set_arguments(t_procs *procs, t_bench_run *run,
+		 char args[7][PATH_MAX + 16], t_procs_point *point)
+ {
+	 int	n;
+ 
+	 bench_init(run);
+	 snprintf(args[0], PATH_MAX + 16, "--run-for=%d", procs->run_for);
+	 snprintf(args[2], PATH_MAX + 16, "%d", point->count);
+	 snprintf(args[3], PATH_MAX + 16, "%d", procs->time_to_eat);
+	 snprintf(args[4], PATH_MAX + 16, "%d", procs->time_to_sleep);
+	 run->argv[0] = (char *) procs->philo_bin;
+	 run->argv[1] = "--format=none";
+	 if (procs->log)
+		 run->argv[1] = "--format=text";
+	 run->argv[2] = args[0];
+	 run->argv[3] = args[1];
+	 n = add_mode_options(run, args, point, 4);
+	 run->argv[n++] = args[2];
+	 run->argv[n++] = "2147483647";
+	 run->argv[n++] = args[3];
+	 run->argv[n++] = args[4];
+	 run->argv[n] = NULL;
+	 run->cpus = procs->cpus;
+	 run->timeout = procs->run_for + procs->timeout;
+ }
+ 
+ /**
+  * @brief Run one point and read its figures.
+  *
+  * @details
+  * The outcome is `time` when the dinner lasted its wall time, `hung` when
+  * the watchdog killed it and `error` when no report came back. The wall
+  * and CPU times cover the whole run, philosopher processes included.
+  *
+  * @param procs Benchmark settings.
+  * @param point Point with `mode`, `count`, `workers`, `delay` and
+  * `repeat` set; the rest is
+  * filled in.
+  *
+  * @ingroup philosopher_procs
+  */
+ void	measure_procs(t_procs *procs, t_procs_point *point)
+ {
+	 static char	args[7][PATH_MAX + 16];
+	 char		path[PATH_MAX];
+	 t_bench_run	run;
+ 
+	 memset(&point->outcome, 0, sizeof(*point)
+		 - offsetof(t_procs_point, outcome));
+	 point->outcome = "error";
+	 if (make_temp(path, "philo-procs") == -1)
+		 return ;
+	 snprintf(args[1], PATH_MAX + 16, "--report=%.*s", PATH_MAX, path);
+	 set_arguments(procs, &run, args, point);
+	 if (bench_run(&run) == 0)
+		 read_procs_report(point, path);
+	 if (run.killed)
+		 point->outcome = "hung";
+	 point->wall = run.wall;
+	 point->cpu = run.cpu;
+	 unlink(path);
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,64 @@
+/**
+ * @file modes.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Names and options of the process benchmark's modes.
+ *
+ * @ingroup philosopher_procs
+ */
+
+ #include "../../include/philo_procs.h"
+ #include <string.h>
+
+ /**
+  * @brief Name and option of every mode, by index.
+  *
+  * @param mode Mode index.
+  * @return `{name, option}`, the option NULL for threads.
+  *
+  * @ingroup philosopher_procs
+  */
+ const char	**procs_mode(int mode)
+ {
+	 static const char	*modes[PROCS_MODE_COUNT][2] = {
+	 {"threads", NULL},
+	 {"processes", "--processes"},
+	 {"workers", "--workers"},
+	 {"unix", "--link=unix"},
+	 {"tcp", "--link=tcp"}};
+ 
+	 return (modes[mode]);
+ }
+ 
+ /**
+  * @brief Find a mode by name.
+  *
+  * @param name Mode name, e.g. `processes`.
+  * @return The mode index, or -1 if unknown.
+  *
+  * @ingroup philosopher_procs
+  */
+ int	find_procs_mode(const char *name)
+ {
+	 int	mode;
+ 
+	 mode = -1;
+	 while (++mode < PROCS_MODE_COUNT)
+		 if (strcmp(procs_mode(mode)[0], name) == 0)
+			 return (mode);
+	 return (-1);
+ }
+ 
+ /**
+  * @brief Name a mode.
+  *
+  * @param mode Mode index.
+  * @return Its name.
+  *
+  * @ingroup philosopher_procs
+  */
+ const char	*procs_mode_name(int mode)
+ {
+	 return (procs_mode(mode)[0]);
+ }
+ 
\ No newline at end of file
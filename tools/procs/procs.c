@@ -0,0 +1,166 @@
+/**
+ * @file procs.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Entry point of the `philo-procs` process benchmark.
+ *
+ * @details
+ * Usage: `philo-procs [-b philo] [-o out.csv] [-m modes] [-n counts] ...`.
+ * Runs a saturated dinner in every mode at every count, with every
+ * number of workers from the `workers` mode on and every link delay in
+ * the `unix` and `tcp` modes, `repeats` times,
+ * and writes one CSV row per run, ready for gnuplot or a dataframe.
+ * Progress goes to stderr. Exits with 1 on usage errors.
+ *
+ * @ingroup philosopher_procs
+ */
+
+ #include "../../include/philo_procs.h"
+
+ /**
+  * @internal
+  * @brief Write the CSV header.
+  *
+  * @param out CSV stream.
+  *
+  * @ingroup philosopher_procs
+  */
+ static void	print_header(FILE *out)
+ {
+	 fprintf(out, "mode,philosophers,processes,link_delay_us,cpus,repeat,"
+		 "outcome,meals,runtime_ms,meals_per_s,fork_wait_avg_us,"
+		 "fork_wait_max_us,hunger_max_ms,contended_locks,setup_ms,cpu_s,"
+		 "cpu_us_per_meal\n");
+ }
+ 
+ /**
+  * @internal
+  * @brief Write one run as a CSV row.
+  *
+  * @details
+  * Figures are left empty when no report came back. The setup time is
+  * the wall time of the run less the dinner's. The processes are those the
+  * philosophers dine in: 1 for threads, one each for processes. The CPU
+  * time per meal is 0 when nobody ate.
+  *
+  * @param out CSV stream.
+  * @param procs Benchmark settings.
+  * @param point Measured run.
+  *
+  * @ingroup philosopher_procs
+  */
+ static void	print_point(FILE *out, t_procs *procs, t_procs_point *point)
+ {
+	 double	cpu_meal;
+	 int		processes;
+ 
+	 cpu_meal = 0;
+	 if (point->meals > 0)
+		 cpu_meal = point->cpu * 1e6 / point->meals;
+	 processes = 1;
+	 if (point->mode >= PROCS_WORKERS && point->workers < point->count)
+		 processes = point->workers;
+	 else if (point->mode != 0)
+		 processes = point->count;
+	 fprintf(out, "%s,%d,%d,%d,%d,%d,%s", procs_mode_name(point->mode),
+		 point->count, processes, point->delay, procs->cpus, point->repeat,
+		 point->outcome);
+	 if (point->runtime > 0)
+		 fprintf(out, ",%ld,%lld,%.1f,%.2f,%.2f,%lld,%lld,%.1f,%.3f,%.3f",
+			 point->meals, point->runtime, point->meals * 1e3 / point->runtime,
+			 point->wait_avg, point->wait_max, point->hunger_max,
+			 point->contended, point->wall * 1e3 - point->runtime,
+			 point->cpu, cpu_meal);
+	 else
+		 fprintf(out, ",,,,,,,,,%.3f,", point->cpu);
+	 fprintf(out, "\n");
+	 fflush(out);
+ }
+ 
+ /**
+  * @internal
+  * @brief Measure every repeat of one point.
+  *
+  * @param procs Benchmark settings.
+  * @param point Point with `mode`, `count`, `workers` and `delay` set.
+  *
+  * @ingroup philosopher_procs
+  */
+ static void	measure_repeats(t_procs *procs, t_procs_point *point)
+ {
+	 point->repeat = -1;
+	 while (++point->repeat < procs->repeats)
+	 {
+		 fprintf(stderr, "philo-procs: %d %s (%d, %d us), run %d\n",
+			 point->count, procs_mode_name(point->mode), point->workers,
+			 point->delay, point->repeat + 1);
+		 measure_procs(procs, point);
+		 print_point(procs->out, procs, point);
+	 }
+ }
+ 
+ /**
+  * @internal
+  * @brief Measure every point of one mode at one count.
+  *
+  * @details
+  * Worker counts only matter from the `workers` mode on, link delays in
+  * the `unix` and `tcp` modes, which need two workers at least.
+  *
+  * @param procs Benchmark settings.
+  * @param mode Mode index.
+  * @param count Philosophers.
+  *
+  * @ingroup philosopher_procs
+  */
+ static void	measure_mode(t_procs *procs, int mode, int count)
+ {
+	 t_procs_point	point;
+	 int				k;
+	 int				d;
+ 
+	 k = -1;
+	 while (++k < procs->worker_len && (k == 0 || mode >= PROCS_WORKERS))
+	 {
+		 d = -1;
+		 while ((mode <= PROCS_WORKERS || procs->workers[k] > 1)
+			 && ++d < procs->delay_len && (d == 0 || mode > PROCS_WORKERS))
+		 {
+			 point = (t_procs_point){.mode = mode, .count = count,
+				 .workers = procs->workers[k],
+				 .delay = procs->delays[d] * (mode > PROCS_WORKERS)};
+			 measure_repeats(procs, &point);
+		 }
+	 }
+ }
+ 
+ /**
+  * @brief Run the process benchmark.
+  *
+  * @param argc Argument count.
+  * @param argv Argument vector.
+  * @return 0 when the benchmark ran, 1 on usage errors.
+  *
+  * @ingroup philosopher_procs
+  */
+ int	main(int argc, char **argv)
+ {
+	 t_procs	procs;
+	 int		n;
+	 int		m;
+ 
+	 if (parse_procs_options(&procs, argc, argv) == -1)
+		 return (1);
+	 print_header(procs.out);
+	 n = -1;
+	 while (++n < procs.count_len)
+	 {
+		 m = -1;
+		 while (++m < procs.mode_len)
+			 measure_mode(&procs, procs.modes[m], procs.counts[n]);
+	 }
+	 if (procs.out != stdout)
+		 fclose(procs.out);
+	 return (0);
+ }
+ 
\ No newline at end of file
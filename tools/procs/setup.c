@@ -0,0 +1,162 @@
+/**
+ * @file setup.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Command-line parsing for `philo-procs`.
+ *
+ * @ingroup philosopher_procs
+ */
+
+ #include "../../include/philo_procs.h"
+ #include <stdlib.h>
+ #include <string.h>
+ #include <unistd.h>
+
+ /**
+  * @internal
+  * @brief Fill the default benchmark.
+  *
+  * @details
+  * Every mode at 5, 50 and 200 philosophers, with 1, 2 and 4 workers and
+  * links without delay, saturated runs of 2 s: meals and naps take no
+  * time, so only taking the forks and the locks does.
+  *
+  * @param procs Benchmark to initialize.
+  *
+  * @ingroup philosopher_procs
+  */
+ static void	set_procs_defaults(t_procs *procs)
+ {
+	 memset(procs, 0, sizeof(*procs));
+	 procs->philo_bin = "./bin/philo-release";
+	 procs->out = stdout;
+	 procs->run_for = 2000;
+	 procs->repeats = 1;
+	 procs->timeout = 10000;
+	 while (procs->mode_len < PROCS_MODE_COUNT)
+	 {
+		 procs->modes[procs->mode_len] = procs->mode_len;
+		 procs->mode_len++;
+	 }
+	 parse_int_list("5,50,200", procs->counts, PROCS_MAX_LIST,
+		 &procs->count_len);
+	 parse_int_list("1,2,4", procs->workers, PROCS_MAX_LIST,
+		 &procs->worker_len);
+	 procs->delay_len = 1;
+ }
+ 
+ /**
+  * @internal
+  * @brief Print the usage message to stderr.
+  *
+  * @ingroup philosopher_procs
+  */
+ static void	procs_usage(void)
+ {
+	 fprintf(stderr, "Usage: philo-procs [-b philo] [-o out.csv] [-m modes]"
+		 " [-n counts] [-k workers]\n"
+		 "                   [-L delays_us] [-e eat] [-s sleep]"
+		 " [-w run_for_ms] [-r repeats]\n"
+		 "                   [-c cpus] [-t timeout_ms] [-l]\n"
+		 "  Modes are comma separated: threads, processes, workers, unix,"
+		 " tcp\n"
+		 "  Link delays are too, 0 for none: -L 0,100,1000\n"
+		 "  -l logs every action to /dev/null instead of --format=none\n");
+ }
+ 
+ /**
+  * @internal
+  * @brief Apply one option of the runs: timings, repeats, CPUs, timeout.
+  *
+  * @param procs Benchmark being configured.
+  * @param opt Option character.
+  * @param arg Option argument.
+  * @return 0 on success, -1 on an unknown option.
+  *
+  * @ingroup philosopher_procs
+  */
+ static int	apply_run_option(t_procs *procs, int opt, char *arg)
+ {
+	 if (opt == 'e')
+		 procs->time_to_eat = atoi(arg);
+	 else if (opt == 's')
+		 procs->time_to_sleep = atoi(arg);
+	 else if (opt == 'w')
+		 procs->run_for = atoi(arg);
+	 else if (opt == 'r')
+		 procs->repeats = atoi(arg);
+	 else if (opt == 'c')
+		 procs->cpus = atoi(arg);
+	 else if (opt == 't')
+		 procs->timeout = atoi(arg);
+	 else
+		 return (-1);
+	 return (0);
+ }
+ 
+ /**
+  * @internal
+  * @brief Apply one parsed `getopt` option to the benchmark.
+  *
+  * @param procs Benchmark being configured.
+  * @param opt Option character.
+  * @param arg Option argument.
+  * @return 0 on success, -1 on an invalid value.
+  *
+  * @ingroup philosopher_procs
+  */
+ static int	apply_procs_option(t_procs *procs, int opt, char *arg)
+ {
+	 if (opt == 'b')
+		 procs->philo_bin = arg;
+	 else if (opt == 'o')
+		 procs->out = fopen(arg, "w");
+	 else if (opt == 'l')
+		 procs->log = true;
+	 else if (opt == 'm' || opt == 'n' || opt == 'k' || opt == 'L')
+		 return (apply_axis_option(procs, opt, arg));
+	 else
+		 return (apply_run_option(procs, opt, arg));
+	 if (!procs->out)
+		 return (-1);
+	 return (0);
+ }
+ 
+ /**
+  * @brief Parse `philo-procs` command-line options.
+  *
+  * @details
+  * Rejects negative timings and CPU counts.
+  *
+  * @param procs Benchmark to fill.
+  * @param argc Argument count.
+  * @param argv Argument vector.
+  * @return 0 on success, -1 after printing the usage on error.
+  *
+  * @ingroup philosopher_procs
+  */
+ int	parse_procs_options(t_procs *procs, int argc, char **argv)
+ {
+	 int	opt;
+ 
+	 set_procs_defaults(procs);
+	 opt = getopt(argc, argv, "b:o:m:n:k:L:e:s:w:r:c:t:l");
+	 while (opt != -1)
+	 {
+		 if (apply_procs_option(procs, opt, optarg) == -1)
+		 {
+			 procs_usage();
+			 return (-1);
+		 }
+		 opt = getopt(argc, argv, "b:o:m:n:k:L:e:s:w:r:c:t:l");
+	 }
+	 if (optind != argc || procs->time_to_eat < 0 || procs->time_to_sleep < 0
+		 || procs->run_for < 1 || procs->repeats < 1 || procs->cpus < 0
+		 || procs->timeout < 1)
+	 {
+		 procs_usage();
+		 return (-1);
+	 }
+	 return (0);
+ }
+ 
\ No newline at end of file
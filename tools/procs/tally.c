@@ -0,0 +1,137 @@
+/**
+ * @file tally.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Figures of one process benchmark run, from its `--report`.
+ *
+ * @details
+ * The report is read whole and scanned for the few members the benchmark
+ * needs, relying on the layout `philo` writes rather than on a JSON
+ * parser.
+ *
+ * @ingroup philosopher_procs
+ */
+
+ #include "../../include/philo_procs.h"
+ #include <stdlib.h>
+ #include <string.h>
+
+ /**
+  * @internal
+  * @brief Read the outcome, the run time and the contended locks.
+  *
+  * @param point Point whose `outcome`, `runtime` and `contended` are
+  * filled.
+  * @param text Report contents.
+  * @return 0 on success, -1 if a member is missing.
+  *
+  * @ingroup philosopher_procs
+  */
+ static int	read_ending(t_procs_point *point, const char *text)
+ {
+	 const char	*outcome;
+ 
+	 outcome = report_outcome(text);
+	 if (!outcome || report_number(text, "runtime_ms", &point->runtime) == -1
+		 || report_number(text, "contended_locks", &point->contended) == -1)
+		 return (-1);
+	 point->outcome = outcome;
+	 return (0);
+ }
+ 
+ /**
+  * @internal
+  * @brief Read one philosopher's line.
+  *
+  * @param text Report contents, at the philosopher's `{"id":`.
+  * @param meals Receives the meals eaten.
+  * @param hunger Receives the longest hunger (ms).
+  * @param wait Receives the average and longest fork waits (us).
+  * @return Whether the line had every member.
+  *
+  * @ingroup philosopher_procs
+  */
+ static bool	read_philosopher(const char *text, long *meals, long long *hunger,
+		 double wait[2])
+ {
+	 return (sscanf(text, "{\"id\":%*d,\"meals\":%ld,\"last_meal_ms\":%*d,"
+			 "\"hunger_max_ms\":%lld,\"slack_min_ms\":%*d,"
+			 "\"fork_wait_avg_us\":%lf,\"fork_wait_max_us\":%lf",
+			 meals, hunger, &wait[0], &wait[1]) == 4);
+ }
+ 
+ /**
+  * @internal
+  * @brief Add up the philosophers' lines.
+  *
+  * @param point Point whose meals, longest fork wait and longest hunger
+  * are filled.
+  * @param text Report contents, from the `philosophers` array on.
+  * @param waits Receives the sum of the fork waits (us) over all meals.
+  * @return The number of philosophers read.
+  *
+  * @ingroup philosopher_procs
+  */
+ static int	add_meals(t_procs_point *point, const char *text, double *waits)
+ {
+	 double		wait[2];
+	 long long	hunger;
+	 long		meals;
+	 int			seen;
+ 
+	 seen = 0;
+	 text = strstr(text, "{\"id\":");
+	 while (text && seen < point->count
+		 && read_philosopher(text, &meals, &hunger, wait))
+	 {
+		 point->meals += meals;
+		 if (wait[1] > point->wait_max)
+			 point->wait_max = wait[1];
+		 if (hunger > point->hunger_max)
+			 point->hunger_max = hunger;
+		 *waits += wait[0] * meals;
+		 seen++;
+		 text = strstr(text + 1, "{\"id\":");
+	 }
+	 return (seen);
+ }
+ 
+ /**
+  * @brief Read the figures of a run from its report.
+  *
+  * @details
+  * The fork wait is averaged over all meals.
+  *
+  * @param point Point with `mode`, `count` and `repeat` set; receives the
+  * outcome, meals, fork waits, longest hunger and contended locks.
+  * @param path The run's `--report` file.
+  * @return 0 on success, -1 if the report is missing or incomplete.
+  *
+  * @ingroup philosopher_procs
+  */
+ int	read_procs_report(t_procs_point *point, const char *path)
+ {
+	 char	*text;
+	 char	*philosophers;
+	 double	waits;
+	 int		seen;
+ 
+	 text = read_whole(path);
+	 if (!text)
+		 return (-1);
+	 philosophers = strstr(text, "\"philosophers\":[");
+	 waits = 0;
+	 seen = 0;
+	 if (philosophers && read_ending(point, text) == 0)
+		 seen = add_meals(point, philosophers, &waits);
+	 free(text);
+	 if (seen == 0)
+	 {
+		 point->outcome = "error";
+		 return (-1);
+	 }
+	 if (point->meals > 0)
+		 point->wait_avg = waits / point->meals;
+	 return (0);
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,65 @@
+/**
+ * @file defaults.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Default study of `philo-scale`.
+ *
+ * @ingroup philosopher_scale
+ */
+
+ #include "../../include/philo_scale.h"
+ #include <string.h>
+
+ /**
+  * @internal
+  * @brief Fill the default CPU axis: 1, 2, 4, ... and every allowed CPU.
+  *
+  * @param scale Study whose `cpus` axis is filled.
+  *
+  * @ingroup philosopher_scale
+  */
+ static void	set_default_cpus(t_scale *scale)
+ {
+	 int	available;
+	 int	cpus;
+ 
+	 available = bench_cpu_count();
+	 scale->cpu_len = 0;
+	 cpus = 1;
+	 while (cpus < available && scale->cpu_len < SCALE_MAX_LIST - 1)
+	 {
+		 scale->cpus[scale->cpu_len++] = cpus;
+		 cpus *= 2;
+	 }
+	 scale->cpus[scale->cpu_len++] = available;
+ }
+ 
+ /**
+  * @brief Fill the default study.
+  *
+  * @details
+  * The default family is `N 800 200 200 5`, comfortably alive at every
+  * size with ideal timing, with a detection run at `time_to_die` 100. N
+  * doubles from 2 to 8192 and ends at 10000, the release build's limit.
+  *
+  * @param scale Study to initialize.
+  *
+  * @ingroup philosopher_scale
+  */
+ void	set_scale_defaults(t_scale *scale)
+ {
+	 memset(scale, 0, sizeof(*scale));
+	 scale->philo_bin = "./bin/philo-release";
+	 scale->out = stdout;
+	 scale->time_to_die = 800;
+	 scale->time_to_eat = 200;
+	 scale->time_to_sleep = 200;
+	 scale->meals = 5;
+	 scale->starve_after = 100;
+	 scale->repeats = 1;
+	 scale->timeout = 30000;
+	 parse_int_list("2,4,8,16,32,64,128,256,512,1024,2048,4096,8192,10000",
+		 scale->counts, SCALE_MAX_LIST, &scale->count_len);
+	 set_default_cpus(scale);
+ }
+ 
\ No newline at end of file
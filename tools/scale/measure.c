@@ -0,0 +1,177 @@
+/**
+ * @file measure.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief The two runs behind every point of the scaling study.
+ *
+ * @details
+ * Logs are written to a temporary file in `$TMPDIR`, checked in one
+ * streaming pass and deleted, so even 10000-philosopher runs leave nothing
+ * behind and never hold their log in memory.
+ *
+ * @ingroup philosopher_scale
+ */
+
+ #include "../../include/philo_scale.h"
+ #include "../../include/philo_check.h"
+ #include <limits.h>
+ #include <stdlib.h>
+ #include <sys/wait.h>
+ #include <unistd.h>
+
+ /**
+  * @brief Fill the argument vector of a throughput run.
+  *
+  * @param scale Study settings.
+  * @param run Run whose `argv`, `cpus` and `timeout` are filled.
+  * @param args Storage for the formatted numbers.
+  * @param point Point being measured.
+  *
+  * @ingroup philosopher_scale
+  */
+ void	set_scale_arguments(t_scale *scale, t_bench_run *run, char args[5][16],
+		 t_point *point)
+ {
+	 bench_init(run);
+	 snprintf(args[0], 16, "%d", point->count);
+	 snprintf(args[1], 16, "%d", scale->time_to_die);
+	 snprintf(args[2], 16, "%d", scale->time_to_eat);
+	 snprintf(args[3], 16, "%d", scale->time_to_sleep);
+	 snprintf(args[4], 16, "%d", scale->meals);
+	 run->argv[0] = (char *) scale->philo_bin;
+	 run->argv[1] = args[0];
+	 run->argv[2] = args[1];
+	 run->argv[3] = args[2];
+	 run->argv[4] = args[3];
+	 run->argv[5] = args[4];
+	 run->argv[6] = NULL;
+	 run->cpus = point->cpus;
+	 run->timeout = scale->timeout + 2 * scale->meals
+		 * meal_period(point->count, scale->time_to_eat, scale->time_to_sleep);
+ }
+ 
+ /**
+  * @internal
+  * @brief Run `philo` into a temporary log and check that log.
+  *
+  * @details
+  * The log of a run the watchdog killed is still checked, as an open-ended
+  * log, so a hung point reports how far it got.
+  *
+  * @param run Prepared run; its `out_path` is set here.
+  * @param check Checker with its rules filled in; receives the results.
+  * @return 0 if the run exited normally and its log was checked, -1
+  * otherwise.
+  *
+  * @ingroup philosopher_scale
+  */
+ static int	run_and_check(t_bench_run *run, t_check *check)
+ {
+	 char	path[PATH_MAX];
+	 int		status;
+ 
+	 if (make_temp(path, "philo-scale") == -1)
+		 return (-1);
+	 run->out_path = path;
+	 status = bench_run(run);
+	 check->rules.open_ended = run->killed;
+	 if (status == 0)
+		 status = check_file(check, path);
+	 if (status == 0 && (run->killed || !WIFEXITED(run->status)
+			 || WEXITSTATUS(run->status) != 0))
+		 status = -1;
+	 unlink(path);
+	 return (status);
+ }
+ 
+ /**
+  * @internal
+  * @brief Rules of a run, as `philo-check` would be given them.
+  *
+  * @param check Checker to prepare.
+  * @param run Run whose arguments are copied into the rules.
+  *
+  * @ingroup philosopher_scale
+  */
+ static void	set_rules_from(t_check *check, t_bench_run *run)
+ {
+	 check_defaults(check);
+	 check->rules.philosopher_count = atoi(run->argv[1]);
+	 check->rules.time_to_die = atoi(run->argv[2]);
+	 check->rules.time_to_eat = atoi(run->argv[3]);
+	 check->rules.time_to_sleep = atoi(run->argv[4]);
+	 if (run->argv[5])
+		 check->rules.must_eat_count = atoi(run->argv[5]);
+ }
+ 
+ /**
+  * @internal
+  * @brief Measure how late a certain death is reported.
+  *
+  * @details
+  * Drops the meal quota and lowers `time_to_die` below `time_to_eat`: the
+  * philosophers left without forks at the start must die at exactly
+  * `starve_after` ms, and the checker reports how long after that the death
+  * line came.
+  *
+  * @param scale Study settings.
+  * @param point Point whose `detect` and `violations` are updated.
+  *
+  * @ingroup philosopher_scale
+  */
+ static void	measure_detection(t_scale *scale, t_point *point)
+ {
+	 t_bench_run	run;
+	 t_check		check;
+	 char		args[5][16];
+ 
+	 set_scale_arguments(scale, &run, args, point);
+	 snprintf(args[1], 16, "%d", scale->starve_after);
+	 run.argv[5] = NULL;
+	 set_rules_from(&check, &run);
+	 point->detect = -1;
+	 if (run_and_check(&run, &check) == 0 && check.death_id)
+		 point->detect = check.death_delay;
+	 point->violations += check.total_violations;
+	 check_free(&check);
+ }
+ 
+ /**
+  * @brief Measure one point: a throughput run, then a detection run.
+  *
+  * @details
+  * Meals are the completed meals of the log and `span` its last timestamp,
+  * so thread creation before the first line is not counted against
+  * throughput. The ideal rate is `count` meals per `meal_period`.
+  *
+  * @param scale Study settings.
+  * @param point Point with `count`, `cpus` and `repeat` set; the rest is
+  * filled in.
+  *
+  * @ingroup philosopher_scale
+  */
+ void	measure_point(t_scale *scale, t_point *point)
+ {
+	 t_bench_run	run;
+	 t_check		check;
+	 char		args[5][16];
+ 
+	 set_scale_arguments(scale, &run, args, point);
+	 set_rules_from(&check, &run);
+	 point->outcome = "error";
+	 if (run_and_check(&run, &check) == 0)
+		 point->outcome = "completed";
+	 if (run.killed)
+		 point->outcome = "hung";
+	 else if (check.death_id)
+		 point->outcome = "died";
+	 point->meals = check.meals;
+	 point->span = check.last_time / 1e3;
+	 point->cpu = run.cpu;
+	 point->ideal = point->count * 1e3 / meal_period(point->count,
+			 scale->time_to_eat, scale->time_to_sleep);
+	 point->violations = check.total_violations;
+	 check_free(&check);
+	 measure_detection(scale, point);
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,109 @@
+/**
+ * @file saturation.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Saturation runs of the scaling study.
+ *
+ * @details
+ * Nothing is logged in this mode: the meal count and elapsed time come
+ * from the bill `philo` prints on stderr, kept in a temporary file.
+ *
+ * @ingroup philosopher_scale
+ */
+
+ #include "../../include/philo_scale.h"
+ #include <limits.h>
+ #include <stdio.h>
+ #include <unistd.h>
+
+ /**
+  * @internal
+  * @brief Read the meal count and elapsed time from `philo`'s bill.
+  *
+  * @param path File holding the run's stderr.
+  * @param point Point whose `meals` and `span` are filled in.
+  * @return 0 on success, -1 if the bill is missing.
+  *
+  * @ingroup philosopher_scale
+  */
+ static int	read_bill(const char *path, t_point *point)
+ {
+	 FILE		*bill;
+	 long long	elapsed;
+	 int			found;
+ 
+	 bill = fopen(path, "r");
+	 if (!bill)
+		 return (-1);
+	 found = fscanf(bill, "philo: %ld meals in %lld ms", &point->meals,
+			 &elapsed);
+	 fclose(bill);
+	 if (found != 2)
+		 return (-1);
+	 point->span = elapsed / 1e3;
+	 return (0);
+ }
+ 
+ /**
+  * @internal
+  * @brief Reset the figures of a point before a saturation run.
+  *
+  * @param point Point whose results are cleared.
+  *
+  * @ingroup philosopher_scale
+  */
+ static void	clear_point(t_point *point)
+ {
+	 point->outcome = "error";
+	 point->meals = 0;
+	 point->span = 0;
+	 point->cpu = 0;
+	 point->ideal = 0;
+	 point->violations = 0;
+	 point->detect = -1;
+ }
+ 
+ /**
+  * @brief Measure one point in saturation mode.
+  *
+  * @details
+  * Runs `philo --run-for=<ms> --format=none N INT_MAX 0 0`: nobody can
+  * die, meals and naps take no time and nothing is logged, so the rate
+  * only reflects the fork protocol, meal bookkeeping and scheduling. The
+  * meal count and elapsed time come from the bill `philo` prints on stderr.
+  *
+  * @param scale Study settings; `saturate` is the wall time per run.
+  * @param point Point with `count`, `cpus` and `repeat` set; the rest is
+  * filled in.
+  *
+  * @ingroup philosopher_scale
+  */
+ void	measure_saturation(t_scale *scale, t_point *point)
+ {
+	 t_bench_run	run;
+	 char		args[5][16];
+	 char		run_for[32];
+	 char		path[PATH_MAX];
+ 
+	 set_scale_arguments(scale, &run, args, point);
+	 snprintf(run_for, sizeof(run_for), "--run-for=%d", scale->saturate);
+	 run.argv[1] = run_for;
+	 run.argv[2] = "--format=none";
+	 run.argv[3] = args[0];
+	 run.argv[4] = "2147483647";
+	 run.argv[5] = "0";
+	 run.argv[6] = "0";
+	 run.argv[7] = NULL;
+	 run.timeout = scale->timeout + scale->saturate;
+	 clear_point(point);
+	 if (make_temp(path, "philo-scale") == -1)
+		 return ;
+	 run.err_path = path;
+	 if (bench_run(&run) == 0 && read_bill(path, point) == 0)
+		 point->outcome = "saturated";
+	 if (run.killed)
+		 point->outcome = "hung";
+	 point->cpu = run.cpu;
+	 unlink(path);
+ }
+ 
\ No newline at end of file
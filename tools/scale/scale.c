@@ -0,0 +1,127 @@
+/**
+ * @file scale.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Entry point of the `philo-scale` scaling study driver.
+ *
+ * @details
+ * Usage: `philo-scale [-b philo] [-o out.csv] [-n counts] [-c cpus] ...`.
+ * Measures every philosopher count on every CPU set, `repeats` times, and
+ * writes one CSV row per measurement, ready for gnuplot or a dataframe.
+ * Progress goes to stderr. Exits with 1 on usage errors.
+ *
+ * @ingroup philosopher_scale
+ */
+
+ #include "../../include/philo_scale.h"
+
+ /**
+  * @internal
+  * @brief Write the CSV header.
+  *
+  * @param out CSV stream.
+  *
+  * @ingroup philosopher_scale
+  */
+ static void	print_header(FILE *out)
+ {
+	 fprintf(out, "philosophers,cpus,repeat,outcome,meals,span_s,meals_per_s,"
+		 "ideal_meals_per_s,efficiency,cpu_s,cpu_ms_per_meal,detect_ms,"
+		 "violations\n");
+ }
+ 
+ /**
+  * @internal
+  * @brief Write one measurement as a CSV row.
+  *
+  * @details
+  * Rates are left empty when the log covers no time or no meal, the ideal
+  * rate and efficiency in saturation mode, and `detect_ms` when no death
+  * was printed.
+  *
+  * @param out CSV stream.
+  * @param point Measured point.
+  *
+  * @ingroup philosopher_scale
+  */
+ static void	print_point(FILE *out, t_point *point)
+ {
+	 fprintf(out, "%d,%d,%d,%s,%ld,%.3f,", point->count, point->cpus,
+		 point->repeat, point->outcome, point->meals, point->span);
+	 if (point->span > 0)
+		 fprintf(out, "%.1f", point->meals / point->span);
+	 fprintf(out, ",");
+	 if (point->ideal > 0)
+		 fprintf(out, "%.1f", point->ideal);
+	 fprintf(out, ",");
+	 if (point->span > 0 && point->ideal > 0)
+		 fprintf(out, "%.3f", point->meals / point->span / point->ideal);
+	 fprintf(out, ",%.3f,", point->cpu);
+	 if (point->meals)
+		 fprintf(out, "%.4f", point->cpu * 1e3 / point->meals);
+	 fprintf(out, ",");
+	 if (point->detect >= 0)
+		 fprintf(out, "%lld", point->detect);
+	 fprintf(out, ",%ld\n", point->violations);
+	 fflush(out);
+ }
+ 
+ /**
+  * @internal
+  * @brief Measure and print every repeat of one grid point.
+  *
+  * @param scale Study settings.
+  * @param point Point with `count` and `cpus` set.
+  *
+  * @ingroup philosopher_scale
+  */
+ static void	measure_repeats(t_scale *scale, t_point *point)
+ {
+	 point->repeat = -1;
+	 while (++point->repeat < scale->repeats)
+	 {
+		 fprintf(stderr, "philo-scale: N=%d on %d CPU(s), run %d\n",
+			 point->count, point->cpus, point->repeat + 1);
+		 if (scale->saturate)
+			 measure_saturation(scale, point);
+		 else
+			 measure_point(scale, point);
+		 print_point(scale->out, point);
+	 }
+ }
+ 
+ /**
+  * @brief Run the scaling study.
+  *
+  * @param argc Argument count.
+  * @param argv Argument vector.
+  * @return 0 when the study ran, 1 on usage errors.
+  *
+  * @ingroup philosopher_scale
+  */
+ int	main(int argc, char **argv)
+ {
+	 t_scale	scale;
+	 t_point	point;
+	 int		n;
+	 int		c;
+ 
+	 if (parse_scale_options(&scale, argc, argv) == -1)
+		 return (1);
+	 print_header(scale.out);
+	 n = -1;
+	 while (++n < scale.count_len)
+	 {
+		 c = -1;
+		 while (++c < scale.cpu_len)
+		 {
+			 point.count = scale.counts[n];
+			 point.cpus = scale.cpus[c];
+			 measure_repeats(&scale, &point);
+		 }
+	 }
+	 if (scale.out != stdout)
+		 fclose(scale.out);
+	 return (0);
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,152 @@
+/**
+ * @file study.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Command-line parsing for `philo-scale`.
+ *
+ * @ingroup philosopher_scale
+ */
+
+ #include "../../include/philo_scale.h"
+ #include <stdlib.h>
+ #include <unistd.h>
+
+ /**
+  * @internal
+  * @brief Print the usage message to stderr.
+  *
+  * @ingroup philosopher_scale
+  */
+ static void	scale_usage(void)
+ {
+	 fprintf(stderr, "Usage: philo-scale [-b philo] [-o out.csv] [-n counts]"
+		 " [-c cpus]\n"
+		 "                   [-d die] [-e eat] [-s sleep] [-m meals]"
+		 " [-x starve_after]\n"
+		 "                   [-r repeats] [-t timeout_ms] [-S saturate_ms]\n"
+		 "  Lists are comma separated, e.g. -n 2,100,10000 -c 1,2,4\n");
+ }
+ 
+ /**
+  * @internal
+  * @brief Replace the N or the CPU axis with a comma-separated list.
+  *
+  * @param scale Study being configured.
+  * @param opt `n` for the philosopher counts, `c` for the CPU sets.
+  * @param arg The list.
+  * @return 0 on success, -1 on an invalid list.
+  *
+  * @ingroup philosopher_scale
+  */
+ static int	apply_axis_option(t_scale *scale, int opt, char *arg)
+ {
+	 if (opt == 'n')
+		 return (parse_int_list(arg, scale->counts, SCALE_MAX_LIST,
+				 &scale->count_len));
+	 return (parse_int_list(arg, scale->cpus, SCALE_MAX_LIST,
+			 &scale->cpu_len));
+ }
+ 
+ /**
+  * @internal
+  * @brief Apply one parsed `getopt` option to the study.
+  *
+  * @param scale Study being configured.
+  * @param opt Option character.
+  * @param arg Option argument.
+  * @return 0 on success, -1 on an invalid value.
+  *
+  * @ingroup philosopher_scale
+  */
+ static int	apply_scale_option(t_scale *scale, int opt, char *arg)
+ {
+	 if (opt == 'b')
+		 scale->philo_bin = arg;
+	 else if (opt == 'o')
+		 scale->out = fopen(arg, "w");
+	 else if (opt == 'd')
+		 scale->time_to_die = atoi(arg);
+	 else if (opt == 'e')
+		 scale->time_to_eat = atoi(arg);
+	 else if (opt == 's')
+		 scale->time_to_sleep = atoi(arg);
+	 else if (opt == 'm')
+		 scale->meals = atoi(arg);
+	 else if (opt == 'x')
+		 scale->starve_after = atoi(arg);
+	 else if (opt == 'r')
+		 scale->repeats = atoi(arg);
+	 else if (opt == 't')
+		 scale->timeout = atoi(arg);
+	 else if (opt == 'S')
+		 scale->saturate = atoi(arg);
+	 else if (opt == 'n' || opt == 'c')
+		 return (apply_axis_option(scale, opt, arg));
+	 else
+		 return (-1);
+	 return (0);
+ }
+ 
+ /**
+  * @internal
+  * @brief Check that every CPU set fits in this process's affinity mask.
+  *
+  * @param scale Study to check.
+  * @return `true` if every entry of the `cpus` axis can be honored.
+  *
+  * @ingroup philosopher_scale
+  */
+ static bool	cpus_fit(t_scale *scale)
+ {
+	 int	i;
+ 
+	 i = -1;
+	 while (++i < scale->cpu_len)
+		 if (scale->cpus[i] > bench_cpu_count())
+			 return (false);
+	 return (true);
+ }
+ 
+ /**
+  * @brief Parse `philo-scale` command-line options.
+  *
+  * @details
+  * Rejects non-positive timings, a detection `time_to_die` that is not
+  * below `time_to_eat` (nobody would be sure to starve) and CPU sets larger
+  * than the CPUs this process may use.
+  *
+  * @param scale Study to fill.
+  * @param argc Argument count.
+  * @param argv Argument vector.
+  * @return 0 on success, -1 after printing the usage on error.
+  *
+  * @ingroup philosopher_scale
+  */
+ int	parse_scale_options(t_scale *scale, int argc, char **argv)
+ {
+	 int	opt;
+ 
+	 set_scale_defaults(scale);
+	 opt = getopt(argc, argv, "b:o:n:c:d:e:s:m:x:r:t:S:");
+	 while (opt != -1)
+	 {
+		 if (apply_scale_option(scale, opt, optarg) == -1)
+		 {
+			 scale_usage();
+			 return (-1);
+		 }
+		 opt = getopt(argc, argv, "b:o:n:c:d:e:s:m:x:r:t:S:");
+	 }
+	 if (optind != argc || !scale->out || !cpus_fit(scale)
+		 || scale->time_to_die < 1
+		 || scale->time_to_eat < 1 || scale->time_to_sleep < 1
+		 || scale->meals < 1 || scale->starve_after < 1
+		 || scale->starve_after >= scale->time_to_eat
+		 || scale->repeats < 1 || scale->timeout < 1 || scale->saturate < 0)
+	 {
+		 scale_usage();
+		 return (-1);
+	 }
+	 return (0);
+ }
+ 
\ No newline at end of file
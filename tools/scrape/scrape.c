@@ -0,0 +1,191 @@
+/**
+ * @file scrape.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Entry point of the `philo-scrape` metrics client.
+ *
+ * @details
+ * Usage: `philo-scrape [-i ms] [-n count] [-H] socket`. Waits for the
+ * socket of a `philo --metrics` run, then scrapes it every `-i` ms and
+ * prints each answer followed by an empty line, until the server goes
+ * away with the dinner or `-n` scrapes are made. With `-H` the request is
+ * an HTTP GET, as Prometheus sends, and the headers are printed too.
+ * Exits with 0 once done, 1 on usage errors and 2 if the socket could not
+ * be reached.
+ *
+ * @ingroup philosopher_scrape
+ */
+
+ #include "../../include/philo_scrape.h"
+ #include <stdio.h>
+ #include <stdlib.h>
+ #include <string.h>
+ #include <sys/socket.h>
+ #include <sys/un.h>
+ #include <unistd.h>
+
+ /**
+  * @internal
+  * @brief Parse the options into the scraper's settings.
+  *
+  * @param scraper Settings to fill.
+  * @param argc Argument count.
+  * @param argv Argument vector.
+  * @return 0 on success, -1 on a usage error.
+  *
+  * @ingroup philosopher_scrape
+  */
+ static int	parse_scrape_options(t_scraper *scraper, int argc, char **argv)
+ {
+	 int	opt;
+ 
+	 *scraper = (t_scraper){NULL, 1000, 0, false};
+	 opt = getopt(argc, argv, "i:n:H");
+	 while (opt != -1)
+	 {
+		 if (opt == 'i')
+			 scraper->interval = atoi(optarg);
+		 else if (opt == 'n')
+			 scraper->count = atoi(optarg);
+		 else if (opt == 'H')
+			 scraper->http = true;
+		 else
+			 return (-1);
+		 opt = getopt(argc, argv, "i:n:H");
+	 }
+	 if (optind != argc - 1 || scraper->interval < 1 || scraper->count < 0)
+		 return (-1);
+	 scraper->path = argv[optind];
+	 return (0);
+ }
+ 
+ /**
+  * @internal
+  * @brief Connect to the metrics socket.
+  *
+  * @param path Socket path.
+  * @return The connected socket, or -1.
+  *
+  * @ingroup philosopher_scrape
+  */
+ static int	dial(const char *path)
+ {
+	 struct sockaddr_un	address;
+	 int					fd;
+ 
+	 memset(&address, 0, sizeof(address));
+	 address.sun_family = AF_UNIX;
+	 strncpy(address.sun_path, path, sizeof(address.sun_path) - 1);
+	 fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	 if (fd != -1 && connect(fd, (struct sockaddr *)&address,
+			 sizeof(address)) == -1)
+	 {
+		 close(fd);
+		 fd = -1;
+	 }
+	 return (fd);
+ }
+ 
+ /**
+  * @internal
+  * @brief Make one scrape and print the answer.
+  *
+  * @details
+  * Without `-H` the writing side is shut down at once, which tells the
+  * server not to wait for a request.
+  *
+  * @param scraper Settings.
+  * @return 0 on success, -1 if the server could not be reached.
+  *
+  * @ingroup philosopher_scrape
+  */
+ static int	scrape(const t_scraper *scraper)
+ {
+	 static char	buffer[SCRAPE_BUFFER];
+	 const char	*request;
+	 ssize_t		got;
+	 int			fd;
+ 
+	 fd = dial(scraper->path);
+	 if (fd == -1)
+		 return (-1);
+	 request = "GET /metrics HTTP/1.0\r\nAccept: text/plain\r\n\r\n";
+	 if (scraper->http)
+		 send(fd, request, strlen(request), MSG_NOSIGNAL);
+	 else
+		 shutdown(fd, SHUT_WR);
+	 got = read(fd, buffer, sizeof(buffer));
+	 while (got > 0)
+	 {
+		 fwrite(buffer, 1, got, stdout);
+		 got = read(fd, buffer, sizeof(buffer));
+	 }
+	 close(fd);
+	 fputc('\n', stdout);
+	 fflush(stdout);
+	 return (0);
+ }
+ 
+ /**
+  * @internal
+  * @brief Make the first scrape, retrying until the server answers.
+  *
+  * @details
+  * Waits up to SCRAPE_ATTACH_MS, so the scraper may be started first.
+  *
+  * @param scraper Settings.
+  * @return 0 once a scrape succeeded, -1 if the server never answered.
+  *
+  * @ingroup philosopher_scrape
+  */
+ static int	first_scrape(const t_scraper *scraper)
+ {
+	 int	waited;
+ 
+	 waited = 0;
+	 while (scrape(scraper) == -1)
+	 {
+		 if (waited++ >= SCRAPE_ATTACH_MS)
+			 return (-1);
+		 usleep(1000);
+	 }
+	 return (0);
+ }
+ 
+ /**
+  * @brief Scrape a `philo --metrics` socket.
+  *
+  * @param argc Argument count.
+  * @param argv Argument vector.
+  * @return 0 once done, 1 on usage errors, 2 if the socket was never
+  * reached.
+  *
+  * @ingroup philosopher_scrape
+  */
+ int	main(int argc, char **argv)
+ {
+	 t_scraper	scraper;
+	 int			made;
+ 
+	 if (parse_scrape_options(&scraper, argc, argv) == -1)
+	 {
+		 fprintf(stderr, "Usage: philo-scrape [-i interval_ms] [-n count]"
+			 " [-H] socket\n");
+		 return (1);
+	 }
+	 if (first_scrape(&scraper) == -1)
+	 {
+		 fprintf(stderr, "philo-scrape: no server at %s\n", scraper.path);
+		 return (2);
+	 }
+	 made = 1;
+	 while (scraper.count == 0 || made < scraper.count)
+	 {
+		 usleep(scraper.interval * 1000);
+		 if (scrape(&scraper) == -1)
+			 break ;
+		 made++;
+	 }
+	 return (0);
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,117 @@
+/**
+ * @file grid.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Grid construction for `philo-stress`.
+ *
+ * @details
+ * Turns the axis lists into the cartesian product of runs and predicts,
+ * for each point, whether `philo` should survive or starve.
+ *
+ * @ingroup philosopher_stress
+ */
+
+ #include "../../include/philo_stress.h"
+ #include "../../include/philo_bench.h"
+ #include <stdlib.h>
+
+ /**
+  * @brief Length of the slowest meal-to-meal cycle `philo` can sustain.
+  *
+  * @details
+  * `last_meal` is refreshed when a meal ends, so the gap to watch is from
+  * one meal end to the next, which is one `meal_period`.
+  *
+  * @param grid_case The configuration.
+  * @return Cycle length in milliseconds.
+  *
+  * @ingroup philosopher_stress
+  */
+ int	case_period(const t_case *grid_case)
+ {
+	 return (meal_period(grid_case->count, grid_case->eat, grid_case->sleep));
+ }
+ 
+ /**
+  * @brief Predict whether a configuration should starve someone.
+  *
+  * @details
+  * A lone philosopher always dies. Otherwise the deadline is compared with
+  * `case_period`; within `guard` milliseconds of it either outcome is
+  * accepted, since scheduling noise decides.
+  *
+  * @param grid_case The configuration.
+  * @param guard Width of the ambiguous band in milliseconds.
+  * @return `EXPECT_LIVE`, `EXPECT_DIE` or `EXPECT_EITHER`.
+  *
+  * @ingroup philosopher_stress
+  */
+ int	expect_outcome(const t_case *grid_case, int guard)
+ {
+	 int	period;
+ 
+	 if (grid_case->count == 1)
+		 return (EXPECT_DIE);
+	 period = case_period(grid_case);
+	 if (grid_case->die < period - guard)
+		 return (EXPECT_DIE);
+	 if (grid_case->die > period + guard)
+		 return (EXPECT_LIVE);
+	 return (EXPECT_EITHER);
+ }
+ 
+ /**
+  * @brief Expand the axes into one `t_run` per grid point.
+  *
+  * @param stress Session whose axes are expanded into `stress->runs`.
+  * @return 0 on success, -1 if allocation fails.
+  *
+  * @ingroup philosopher_stress
+  */
+ int	build_grid(t_stress *stress)
+ {
+	 int		i;
+	 int		rest;
+	 t_case	*grid_case;
+ 
+	 stress->run_count = stress->axis_len[0] * stress->axis_len[1]
+		 * stress->axis_len[2] * stress->axis_len[3];
+	 stress->runs = calloc(stress->run_count, sizeof(t_run));
+	 if (!stress->runs)
+		 return (-1);
+	 i = -1;
+	 while (++i < stress->run_count)
+	 {
+		 rest = i;
+		 grid_case = &stress->runs[i].grid_case;
+		 grid_case->sleep = stress->sleeps[rest % stress->axis_len[3]];
+		 rest /= stress->axis_len[3];
+		 grid_case->eat = stress->eats[rest % stress->axis_len[2]];
+		 rest /= stress->axis_len[2];
+		 grid_case->die = stress->dies[rest % stress->axis_len[1]];
+		 grid_case->count = stress->counts[rest / stress->axis_len[1]];
+		 grid_case->meals = stress->meals;
+		 grid_case->expect = expect_outcome(grid_case, stress->guard);
+		 stress->runs[i].index = i;
+	 }
+	 return (0);
+ }
+ 
+ /**
+  * @brief Human-readable name of an outcome.
+  *
+  * @param outcome One of the OUT_* values.
+  * @return Static string such as `"died-unexpectedly"`.
+  *
+  * @ingroup philosopher_stress
+  */
+ const char	*outcome_name(int outcome)
+ {
+	 static const char	*names[OUT_COUNT] = {"completed", "died-as-expected",
+		 "died-unexpectedly", "hung", "log-invalid"};
+ 
+	 if (outcome < 0 || outcome >= OUT_COUNT)
+		 return ("unknown");
+	 return (names[outcome]);
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,110 @@
+/**
+ * @file launch.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Starting one `philo` child for `philo-stress`.
+ *
+ * @details
+ * Each child gets its own process group, its output captured in the
+ * output directory and a watchdog deadline scaled to the case.
+ *
+ * @ingroup philosopher_stress
+ */
+
+ #include "../../include/philo_stress.h"
+ #include <fcntl.h>
+ #include <stdio.h>
+ #include <time.h>
+ #include <unistd.h>
+
+ /**
+  * @brief Monotonic clock in milliseconds.
+  *
+  * @return Milliseconds since an arbitrary fixed point.
+  *
+  * @ingroup philosopher_stress
+  */
+ long long	stress_clock(void)
+ {
+	 struct timespec	now;
+ 
+	 clock_gettime(CLOCK_MONOTONIC, &now);
+	 return (now.tv_sec * 1000LL + now.tv_nsec / 1000000);
+ }
+ 
+ /**
+  * @internal
+  * @brief Replace the child image with `philo` for the given case.
+  *
+  * @details
+  * Runs in the forked child: moves into its own process group so the
+  * watchdog can kill anything it spawns, redirects stdout and stderr to the
+  * run's capture files and `exec`s the binary. Never returns.
+  *
+  * @param stress Session settings.
+  * @param run Run to execute.
+  *
+  * @ingroup philosopher_stress
+  */
+ static void	exec_philo(t_stress *stress, t_run *run)
+ {
+	 char	args[5][16];
+	 char	*argv[7];
+	 int		out;
+	 int		err;
+	 int		i;
+ 
+	 setpgid(0, 0);
+	 out = open(run->log_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	 err = open(run->err_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	 if (out == -1 || err == -1 || dup2(out, 1) == -1 || dup2(err, 2) == -1)
+		 _exit(127);
+	 snprintf(args[0], 16, "%d", run->grid_case.count);
+	 snprintf(args[1], 16, "%d", run->grid_case.die);
+	 snprintf(args[2], 16, "%d", run->grid_case.eat);
+	 snprintf(args[3], 16, "%d", run->grid_case.sleep);
+	 snprintf(args[4], 16, "%d", run->grid_case.meals);
+	 argv[0] = (char *) stress->philo_bin;
+	 i = -1;
+	 while (++i < 5)
+		 argv[i + 1] = args[i];
+	 argv[6] = NULL;
+	 execv(stress->philo_bin, argv);
+	 _exit(127);
+ }
+ 
+ /**
+  * @brief Start one run in a child process.
+  *
+  * @details
+  * The watchdog deadline is the base timeout plus twice the time needed to
+  * serve every meal at the case's cycle length, so slow but healthy large
+  * tables are not mistaken for hangs.
+  *
+  * @param stress Session settings.
+  * @param run Run to start; `pid` and `deadline` are filled in.
+  * @return 0 on success, -1 if `fork` failed.
+  *
+  * @ingroup philosopher_stress
+  */
+ int	launch_run(t_stress *stress, t_run *run)
+ {
+	 snprintf(run->log_path, PATH_MAX, "%s/logs/run-%05d.log",
+		 stress->out_dir, run->index);
+	 snprintf(run->err_path, PATH_MAX, "%s/logs/run-%05d.err",
+		 stress->out_dir, run->index);
+	 run->killed = false;
+	 run->failed = false;
+	 run->deadline = stress_clock() + stress->timeout
+		 + 2LL * run->grid_case.meals * case_period(&run->grid_case);
+	 run->pid = fork();
+	 if (run->pid == -1)
+	 {
+		 run->pid = 0;
+		 return (-1);
+	 }
+	 if (run->pid == 0)
+		 exec_philo(stress, run);
+	 return (0);
+ }
+ 
\ No newline at end of file
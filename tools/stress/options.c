@@ -0,0 +1,177 @@
+/**
+ * @file options.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Command-line parsing for `philo-stress`.
+ *
+ * @details
+ * Starts from a default grid and overrides any axis or runner setting
+ * given on the command line. Axes are comma-separated lists.
+ *
+ * @ingroup philosopher_stress
+ */
+
+ #include "../../include/philo_stress.h"
+ #include "../../include/philo_bench.h"
+ #include <stdio.h>
+ #include <stdlib.h>
+ #include <string.h>
+ #include <unistd.h>
+
+ /**
+  * @internal
+  * @brief Fill the default grid and runner settings.
+  *
+  * @details
+  * The default grid mixes the classic evaluation cases (1, 4 and 5
+  * philosophers, 310/410/800 ms deadlines) with large and odd tables.
+  *
+  * @param stress Session to initialize.
+  *
+  * @ingroup philosopher_stress
+  */
+ static void	set_stress_defaults(t_stress *stress)
+ {
+	 memset(stress, 0, sizeof(*stress));
+	 stress->philo_bin = "./bin/philo";
+	 stress->out_dir = "stress-out";
+	 stress->jobs = (int) sysconf(_SC_NPROCESSORS_ONLN);
+	 if (stress->jobs < 1)
+		 stress->jobs = 1;
+	 stress->timeout = 10000;
+	 stress->guard = 20;
+	 stress->tolerance = 10;
+	 stress->shrink_budget = 24;
+	 stress->attempts = 3;
+	 stress->meals = 5;
+	 parse_int_list("1,2,3,4,5,31,64,199,200", stress->counts,
+		 STRESS_MAX_LIST, &stress->axis_len[0]);
+	 parse_int_list("130,310,410,610,800", stress->dies, STRESS_MAX_LIST,
+		 &stress->axis_len[1]);
+	 parse_int_list("60,100,200", stress->eats, STRESS_MAX_LIST,
+		 &stress->axis_len[2]);
+	 parse_int_list("60,100,200", stress->sleeps, STRESS_MAX_LIST,
+		 &stress->axis_len[3]);
+ }
+ 
+ /**
+  * @internal
+  * @brief Print the usage message to stderr.
+  *
+  * @ingroup philosopher_stress
+  */
+ static void	stress_usage(void)
+ {
+	 fprintf(stderr, "Usage: philo-stress [-b philo] [-j jobs] [-t timeout_ms]"
+		 " [-o out_dir]\n"
+		 "                    [-n counts] [-d dies] [-e eats] [-s sleeps]"
+		 " [-m meals]\n"
+		 "                    [-g guard_ms] [-T tolerance_ms] [-r shrink_runs]"
+		 " [-a attempts] [-k]\n"
+		 "  Lists are comma separated, e.g. -n 1,4,5,200 -d 310,410,800\n");
+ }
+ 
+ /**
+  * @internal
+  * @brief Replace one axis of the grid with a comma-separated list.
+  *
+  * @param stress Session being configured.
+  * @param opt `n`, `d`, `e` or `s`: counts, dies, eats or sleeps.
+  * @param arg The list.
+  * @return 0 on success, -1 on an invalid list.
+  *
+  * @ingroup philosopher_stress
+  */
+ static int	apply_axis_option(t_stress *stress, int opt, char *arg)
+ {
+	 if (opt == 'n')
+		 return (parse_int_list(arg, stress->counts, STRESS_MAX_LIST,
+				 &stress->axis_len[0]));
+	 if (opt == 'd')
+		 return (parse_int_list(arg, stress->dies, STRESS_MAX_LIST,
+				 &stress->axis_len[1]));
+	 if (opt == 'e')
+		 return (parse_int_list(arg, stress->eats, STRESS_MAX_LIST,
+				 &stress->axis_len[2]));
+	 return (parse_int_list(arg, stress->sleeps, STRESS_MAX_LIST,
+			 &stress->axis_len[3]));
+ }
+ 
+ /**
+  * @internal
+  * @brief Apply one parsed `getopt` option to the session.
+  *
+  * @param stress Session being configured.
+  * @param opt Option character.
+  * @param arg Option argument (may be NULL for flags).
+  * @return 0 on success, -1 on an invalid value.
+  *
+  * @ingroup philosopher_stress
+  */
+ static int	apply_stress_option(t_stress *stress, int opt, char *arg)
+ {
+	 if (opt == 'b')
+		 stress->philo_bin = arg;
+	 else if (opt == 'o')
+		 stress->out_dir = arg;
+	 else if (opt == 'j')
+		 stress->jobs = atoi(arg);
+	 else if (opt == 't')
+		 stress->timeout = atoi(arg);
+	 else if (opt == 'g')
+		 stress->guard = atoi(arg);
+	 else if (opt == 'T')
+		 stress->tolerance = atoi(arg);
+	 else if (opt == 'r')
+		 stress->shrink_budget = atoi(arg);
+	 else if (opt == 'a')
+		 stress->attempts = atoi(arg);
+	 else if (opt == 'm')
+		 stress->meals = atoi(arg);
+	 else if (opt == 'k')
+		 stress->keep_logs = true;
+	 else if (opt == 'n' || opt == 'd' || opt == 'e' || opt == 's')
+		 return (apply_axis_option(stress, opt, arg));
+	 else
+		 return (-1);
+	 return (0);
+ }
+ 
+ /**
+  * @brief Parse `philo-stress` command-line options.
+  *
+  * @details
+  * Starts from the default grid and overrides any axis or setting given on
+  * the command line. Rejects zero jobs, meals or timeouts.
+  *
+  * @param stress Session to fill.
+  * @param argc Argument count.
+  * @param argv Argument vector.
+  * @return 0 on success, -1 after printing the usage on error.
+  *
+  * @ingroup philosopher_stress
+  */
+ int	parse_stress_options(t_stress *stress, int argc, char **argv)
+ {
+	 int	opt;
+ 
+	 set_stress_defaults(stress);
+	 opt = getopt(argc, argv, "b:j:t:o:n:d:e:s:m:g:T:r:a:k");
+	 while (opt != -1)
+	 {
+		 if (apply_stress_option(stress, opt, optarg) == -1)
+		 {
+			 stress_usage();
+			 return (-1);
+		 }
+		 opt = getopt(argc, argv, "b:j:t:o:n:d:e:s:m:g:T:r:a:k");
+	 }
+	 if (optind != argc || stress->jobs < 1 || stress->meals < 1
+		 || stress->timeout < 1 || stress->attempts < 1)
+	 {
+		 stress_usage();
+		 return (-1);
+	 }
+	 return (0);
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,177 @@
+/**
+ * @file reproducer.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Failure shrinking and reproducer scripts for `philo-stress`.
+ *
+ * @details
+ * A failing grid case is shrunk greedily: fewer philosophers (keeping the
+ * table's parity, which decides the routine's timing) and fewer meals are
+ * tried while the same outcome keeps failing. The smallest failing case is
+ * written as an executable shell script next to its captured log.
+ *
+ * @ingroup philosopher_stress
+ */
+
+ #include "../../include/philo_stress.h"
+ #include <stdio.h>
+ #include <string.h>
+ #include <sys/stat.h>
+
+ /**
+  * @internal
+  * @brief Derive the `step`-th smaller candidate of a failing case.
+  *
+  * @param from Current smallest failing case.
+  * @param step Which reduction to try (0 to 3).
+  * @param to Receives the candidate.
+  * @return `true` if the reduction applies to this case.
+  *
+  * @ingroup philosopher_stress
+  */
+ static bool	shrink_step(const t_case *from, int step, t_case *to)
+ {
+	 *to = *from;
+	 if (step == 0)
+	 {
+		 to->count = from->count / 2;
+		 if (to->count % 2 != from->count % 2)
+			 to->count++;
+	 }
+	 else if (step == 1)
+		 to->count = from->count - 2;
+	 else if (step == 2)
+		 to->meals = from->meals / 2;
+	 else
+		 to->meals = from->meals - 1;
+	 return (to->count >= 2 && to->meals >= 1
+		 && (to->count < from->count || to->meals < from->meals));
+ }
+ 
+ /**
+  * @internal
+  * @brief Check whether a candidate still fails the same way.
+  *
+  * @param stress Session settings; consumes shrink budget.
+  * @param candidate Case to try.
+  * @param outcome Outcome that must be reproduced.
+  * @param scratch Run used for the attempts; holds the last log on success.
+  * @return `true` if any attempt reproduced the failure.
+  *
+  * @ingroup philosopher_stress
+  */
+ static bool	reproduces(t_stress *stress, t_case *candidate, int outcome,
+		 t_run *scratch)
+ {
+	 int	attempt;
+ 
+	 candidate->expect = expect_outcome(candidate, stress->guard);
+	 attempt = -1;
+	 while (++attempt < stress->attempts && stress->shrink_budget-- > 0)
+	 {
+		 memset(scratch, 0, sizeof(*scratch));
+		 scratch->grid_case = *candidate;
+		 scratch->index = stress->next_index++;
+		 run_one(stress, scratch);
+		 if (scratch->failed && scratch->outcome == outcome)
+			 return (true);
+	 }
+	 return (false);
+ }
+ 
+ /**
+  * @internal
+  * @brief Greedily shrink a failing run in place.
+  *
+  * @details
+  * Keeps applying the first reduction that still reproduces the failure
+  * until none does or the shrink budget is spent. The budget is restored
+  * afterwards so every failure gets the same allowance.
+  *
+  * @param stress Session settings.
+  * @param run Failing run; replaced by the smallest reproduction found.
+  *
+  * @ingroup philosopher_stress
+  */
+ static void	shrink_run(t_stress *stress, t_run *run)
+ {
+	 t_run	scratch;
+	 t_case	candidate;
+	 int		budget;
+	 int		step;
+ 
+	 budget = stress->shrink_budget;
+	 step = 0;
+	 while (step < 4 && stress->shrink_budget > 0)
+	 {
+		 if (shrink_step(&run->grid_case, step, &candidate)
+			 && reproduces(stress, &candidate, run->outcome, &scratch))
+		 {
+			 *run = scratch;
+			 step = 0;
+		 }
+		 else
+			 step++;
+	 }
+	 stress->shrink_budget = budget;
+ }
+ 
+ /**
+  * @internal
+  * @brief Describe an expectation in words.
+  *
+  * @param expect One of the EXPECT_* values.
+  * @return Static description.
+  *
+  * @ingroup philosopher_stress
+  */
+ static const char	*expect_name(int expect)
+ {
+	 if (expect == EXPECT_LIVE)
+		 return ("everybody survives");
+	 if (expect == EXPECT_DIE)
+		 return ("somebody dies");
+	 return ("either outcome");
+ }
+ 
+ /**
+  * @brief Shrink a failing run and write its reproducer script.
+  *
+  * @details
+  * The script is `<out_dir>/repro/<outcome>-<index>.sh`. It runs the
+  * smallest failing configuration with `$PHILO` (defaulting to the binary
+  * under test) and records the original case, the expectation, the reason
+  * and the path of the failing log. The path is printed on stdout.
+  *
+  * @param stress Session settings.
+  * @param run Failing run from the grid.
+  *
+  * @ingroup philosopher_stress
+  */
+ void	write_reproducer(t_stress *stress, t_run *run)
+ {
+	 t_run	small;
+	 char	path[PATH_MAX];
+	 FILE	*script;
+ 
+	 small = *run;
+	 shrink_run(stress, &small);
+	 snprintf(path, PATH_MAX, "%s/repro/%s-%05d.sh", stress->out_dir,
+		 outcome_name(run->outcome), run->index);
+	 script = fopen(path, "w");
+	 if (!script)
+		 return ;
+	 fprintf(script, "#!/bin/sh\n# philo-stress reproducer\n"
+		 "# outcome:  %s (%s)\n# expected: %s\n# original: %d %d %d %d %d\n"
+		 "# log:      %s\nexec \"${PHILO:-%s}\" %d %d %d %d %d\n",
+		 outcome_name(small.outcome), small.reason,
+		 expect_name(small.grid_case.expect), run->grid_case.count,
+		 run->grid_case.die, run->grid_case.eat, run->grid_case.sleep,
+		 run->grid_case.meals, small.log_path, stress->philo_bin,
+		 small.grid_case.count, small.grid_case.die, small.grid_case.eat,
+		 small.grid_case.sleep, small.grid_case.meals);
+	 fclose(script);
+	 chmod(path, 0755);
+	 printf("  reproducer: %s\n", path);
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,176 @@
+/**
+ * @file runner.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Process pool and watchdog for `philo-stress`.
+ *
+ * @details
+ * Keeps at most `jobs` `philo` children running (see launch.c), reaps
+ * them as they finish and kills any child that outlives its watchdog
+ * deadline.
+ *
+ * @ingroup philosopher_stress
+ */
+
+ #include "../../include/philo_stress.h"
+ #include <signal.h>
+ #include <stdio.h>
+ #include <sys/wait.h>
+ #include <unistd.h>
+
+ /**
+  * @internal
+  * @brief Kill every running child whose deadline has passed.
+  *
+  * @param runs Runs to inspect.
+  * @param count Number of runs.
+  *
+  * @ingroup philosopher_stress
+  */
+ static void	watchdog(t_run *runs, int count)
+ {
+	 long long	now;
+	 int			i;
+ 
+	 now = stress_clock();
+	 i = -1;
+	 while (++i < count)
+	 {
+		 if (runs[i].pid > 0 && !runs[i].killed && now > runs[i].deadline)
+		 {
+			 kill(-runs[i].pid, SIGKILL);
+			 kill(runs[i].pid, SIGKILL);
+			 runs[i].killed = true;
+		 }
+	 }
+ }
+ 
+ /**
+  * @internal
+  * @brief Reap every finished child without blocking.
+  *
+  * @param stress Session owning the runs.
+  * @return Number of children reaped.
+  *
+  * @ingroup philosopher_stress
+  */
+ static int	reap_runs(t_stress *stress)
+ {
+	 pid_t	pid;
+	 int		status;
+	 int		reaped;
+	 int		i;
+ 
+	 reaped = 0;
+	 pid = waitpid(-1, &status, WNOHANG);
+	 while (pid > 0)
+	 {
+		 i = -1;
+		 while (++i < stress->run_count)
+		 {
+			 if (stress->runs[i].pid == pid)
+			 {
+				 stress->runs[i].pid = 0;
+				 classify_run(stress, &stress->runs[i], status);
+				 reaped++;
+			 }
+		 }
+		 pid = waitpid(-1, &status, WNOHANG);
+	 }
+	 return (reaped);
+ }
+ 
+ /**
+  * @internal
+  * @brief Start runs in grid order while slots are free.
+  *
+  * @param stress Session owning the runs.
+  * @param next Index of the next run to start.
+  * @param running Number of children still running.
+  * @return Index of the next run to start after this round.
+  *
+  * @ingroup philosopher_stress
+  */
+ static int	start_runs(t_stress *stress, int next, int running)
+ {
+	 while (running < stress->jobs && next < stress->run_count)
+	 {
+		 if (launch_run(stress, &stress->runs[next]) == -1)
+			 break ;
+		 next++;
+		 running++;
+	 }
+	 return (next);
+ }
+ 
+ /**
+  * @brief Run the whole grid with at most `jobs` concurrent children.
+  *
+  * @details
+  * Polls once per millisecond: starts new runs while slots are free, reaps
+  * finished ones and lets the watchdog kill overdue ones. Progress is shown
+  * on stderr each time runs finish.
+  *
+  * @param stress Session whose runs are executed and classified.
+  *
+  * @ingroup philosopher_stress
+  */
+ void	run_grid(t_stress *stress)
+ {
+	 int	next;
+	 int	running;
+	 int	done;
+	 int	reaped;
+ 
+	 next = 0;
+	 running = 0;
+	 done = 0;
+	 fprintf(stderr, "philo-stress: 0/%d runs", stress->run_count);
+	 while (done < stress->run_count)
+	 {
+		 next = start_runs(stress, next, running);
+		 watchdog(stress->runs, next);
+		 reaped = reap_runs(stress);
+		 done += reaped;
+		 running = next - done;
+		 if (reaped)
+			 fprintf(stderr, "\rphilo-stress: %d/%d runs", done,
+				 stress->run_count);
+		 usleep(1000);
+	 }
+	 fprintf(stderr, "\n");
+ }
+ 
+ /**
+  * @brief Execute a single run synchronously (used while shrinking).
+  *
+  * @param stress Session settings.
+  * @param run Run to execute and classify.
+  *
+  * @ingroup philosopher_stress
+  */
+ void	run_one(t_stress *stress, t_run *run)
+ {
+	 int		status;
+	 pid_t	pid;
+ 
+	 if (launch_run(stress, run) == -1)
+	 {
+		 run->outcome = OUT_LOG_INVALID;
+		 run->failed = true;
+		 snprintf(run->reason, STRESS_REASON, "fork failed");
+		 return ;
+	 }
+	 pid = waitpid(run->pid, &status, WNOHANG);
+	 while (pid == 0)
+	 {
+		 watchdog(run, 1);
+		 usleep(1000);
+		 pid = waitpid(run->pid, &status, WNOHANG);
+	 }
+	 run->pid = 0;
+	 if (pid == -1)
+		 status = 0;
+	 classify_run(stress, run, status);
+ }
+ 
\ No newline at end of file
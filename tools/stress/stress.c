@@ -0,0 +1,110 @@
+/**
+ * @file stress.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Entry point of the `philo-stress` tool.
+ *
+ * @details
+ * Parses options, prepares the output directory, runs the grid and prints
+ * a per-outcome summary followed by one line and one reproducer per
+ * failing run. Exits with status 1 if any run failed.
+ *
+ * @ingroup philosopher_stress
+ */
+
+ #include "../../include/philo_stress.h"
+ #include <errno.h>
+ #include <stdio.h>
+ #include <stdlib.h>
+ #include <sys/stat.h>
+
+ /**
+  * @internal
+  * @brief Create the output directory and its `logs/` and `repro/` children.
+  *
+  * @param out_dir Output directory.
+  * @return 0 on success, -1 on failure.
+  *
+  * @ingroup philosopher_stress
+  */
+ static int	make_out_dirs(const char *out_dir)
+ {
+	 char	path[PATH_MAX];
+ 
+	 if (mkdir(out_dir, 0755) == -1 && errno != EEXIST)
+		 return (-1);
+	 snprintf(path, PATH_MAX, "%s/logs", out_dir);
+	 if (mkdir(path, 0755) == -1 && errno != EEXIST)
+		 return (-1);
+	 snprintf(path, PATH_MAX, "%s/repro", out_dir);
+	 if (mkdir(path, 0755) == -1 && errno != EEXIST)
+		 return (-1);
+	 return (0);
+ }
+ 
+ /**
+  * @internal
+  * @brief Print the per-outcome summary, then every failure.
+  *
+  * @param stress Session with classified runs.
+  *
+  * @ingroup philosopher_stress
+  */
+ static void	report(t_stress *stress)
+ {
+	 int		i;
+	 t_run	*run;
+ 
+	 i = -1;
+	 while (++i < stress->run_count)
+	 {
+		 stress->tally[stress->runs[i].outcome]++;
+		 stress->failures += stress->runs[i].failed;
+	 }
+	 printf("philo-stress: %d runs, %d jobs, %d failed\n", stress->run_count,
+		 stress->jobs, stress->failures);
+	 i = -1;
+	 while (++i < OUT_COUNT)
+		 printf("  %-18s %6d\n", outcome_name(i), stress->tally[i]);
+	 i = -1;
+	 while (++i < stress->run_count)
+	 {
+		 run = &stress->runs[i];
+		 if (!run->failed)
+			 continue ;
+		 printf("FAIL %-18s %d %d %d %d %d: %s\n", outcome_name(run->outcome),
+			 run->grid_case.count, run->grid_case.die, run->grid_case.eat,
+			 run->grid_case.sleep, run->grid_case.meals, run->reason);
+		 write_reproducer(stress, run);
+	 }
+ }
+ 
+ /**
+  * @brief Run the stress grid against the `philo` binary.
+  *
+  * @param argc Argument count.
+  * @param argv Argument vector.
+  * @return `EXIT_SUCCESS` if no run failed, `EXIT_FAILURE` otherwise.
+  *
+  * @ingroup philosopher_stress
+  */
+ int	main(int argc, char **argv)
+ {
+	 t_stress	stress;
+ 
+	 if (parse_stress_options(&stress, argc, argv) == -1)
+		 return (2);
+	 if (make_out_dirs(stress.out_dir) == -1 || build_grid(&stress) == -1)
+	 {
+		 perror("philo-stress");
+		 return (EXIT_FAILURE);
+	 }
+	 stress.next_index = stress.run_count;
+	 run_grid(&stress);
+	 report(&stress);
+	 free(stress.runs);
+	 if (stress.failures)
+		 return (EXIT_FAILURE);
+	 return (EXIT_SUCCESS);
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,145 @@
+/**
+ * @file verdict.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Classification of finished `philo-stress` runs.
+ *
+ * @details
+ * Combines how the child exited with a single streaming pass over its
+ * captured log, made by the shared `philo-check` rules, to decide the
+ * run's outcome.
+ *
+ * @ingroup philosopher_stress
+ */
+
+ #include "../../include/philo_stress.h"
+ #include "../../include/philo_check.h"
+ #include <string.h>
+ #include <sys/wait.h>
+ #include <unistd.h>
+
+ /**
+  * @internal
+  * @brief Give the checker the parameters of a grid case.
+  *
+  * @param rules Rules to fill.
+  * @param grid_case The case that was run.
+  * @param tolerance Duration tolerance and death window (ms).
+  *
+  * @ingroup philosopher_stress
+  */
+ static void	set_case_rules(t_check_rules *rules, const t_case *grid_case,
+		 int tolerance)
+ {
+	 rules->philosopher_count = grid_case->count;
+	 rules->time_to_die = grid_case->die;
+	 rules->time_to_eat = grid_case->eat;
+	 rules->time_to_sleep = grid_case->sleep;
+	 rules->must_eat_count = grid_case->meals;
+	 rules->tolerance = tolerance;
+	 rules->death_window = tolerance;
+ }
+ 
+ /**
+  * @internal
+  * @brief Classify a cleanly exited run from its log.
+  *
+  * @details
+  * The log goes through the same streaming checker as `philo-check`, with
+  * the case's parameters and the session's tolerance. Any violation makes
+  * the run `log-invalid`, with the first one as the reason.
+  *
+  * @param stress Session settings.
+  * @param run Run to classify.
+  *
+  * @ingroup philosopher_stress
+  */
+ static void	inspect_log(t_stress *stress, t_run *run)
+ {
+	 t_check	check;
+ 
+	 check_defaults(&check);
+	 set_case_rules(&check.rules, &run->grid_case, stress->tolerance);
+	 run->outcome = OUT_LOG_INVALID;
+	 if (check_file(&check, run->log_path) != 0)
+		 snprintf(run->reason, STRESS_REASON, "log unreadable");
+	 else if (check.total_violations)
+		 snprintf(run->reason, STRESS_REASON, "%s", check.first);
+	 else if (check.death_id && run->grid_case.expect == EXPECT_LIVE)
+	 {
+		 run->outcome = OUT_DIED_UNEXPECTED;
+		 snprintf(run->reason, STRESS_REASON, "philosopher %d died at %lld ms",
+			 check.death_id, check.death_time);
+	 }
+	 else if (check.death_id)
+		 run->outcome = OUT_DIED_EXPECTED;
+	 else
+		 run->outcome = OUT_COMPLETED;
+	 check_free(&check);
+ }
+ 
+ /**
+  * @internal
+  * @brief Give the signal or the exit status of an abnormal exit as the
+  * reason.
+  *
+  * @param run Run that exited abnormally.
+  * @param status Status returned by `waitpid`.
+  *
+  * @ingroup philosopher_stress
+  */
+ static void	note_exit(t_run *run, int status)
+ {
+	 if (WIFSIGNALED(status))
+		 snprintf(run->reason, STRESS_REASON, "abnormal exit (signal %d)",
+			 WTERMSIG(status));
+	 else
+		 snprintf(run->reason, STRESS_REASON, "abnormal exit (status %d)",
+			 WEXITSTATUS(status));
+ }
+ 
+ /**
+  * @brief Classify a reaped run and decide whether it failed.
+  *
+  * @details
+  * Watchdog kills are `hung`; signals and non-zero exit statuses (for
+  * example a ThreadSanitizer report) are `log-invalid`. Otherwise the log
+  * decides. A run that completed although a death was predicted is kept
+  * as `completed` but marked failed. Logs of passing runs are deleted
+  * unless `-k` was given.
+  *
+  * @param stress Session settings.
+  * @param run Run to classify.
+  * @param status Status returned by `waitpid`.
+  *
+  * @ingroup philosopher_stress
+  */
+ void	classify_run(t_stress *stress, t_run *run, int status)
+ {
+	 run->reason[0] = '\0';
+	 if (run->killed)
+	 {
+		 run->outcome = OUT_HUNG;
+		 snprintf(run->reason, STRESS_REASON, "watchdog fired");
+	 }
+	 else if (WIFSIGNALED(status) || WEXITSTATUS(status) != 0)
+	 {
+		 run->outcome = OUT_LOG_INVALID;
+		 note_exit(run, status);
+	 }
+	 else
+		 inspect_log(stress, run);
+	 run->failed = (run->outcome == OUT_DIED_UNEXPECTED
+			 || run->outcome == OUT_HUNG || run->outcome == OUT_LOG_INVALID);
+	 if (run->outcome == OUT_COMPLETED && run->grid_case.expect == EXPECT_DIE)
+	 {
+		 run->failed = true;
+		 snprintf(run->reason, STRESS_REASON, "a death was expected");
+	 }
+	 if (!run->failed && !stress->keep_logs)
+	 {
+		 unlink(run->log_path);
+		 unlink(run->err_path);
+	 }
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,86 @@
+/**
+ * @file attach.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Mapping of the stats page of a `philo --live` run.
+ *
+ * @ingroup philosopher_top
+ */
+
+ #include "../../include/philo_top.h"
+ #include <fcntl.h>
+ #include <sys/mman.h>
+ #include <sys/stat.h>
+ #include <unistd.h>
+
+ #define TOP_ATTACH_MS	10000
+ 
+ /**
+  * @internal
+  * @brief Map `size` bytes of the page once it is announced, read-only.
+  *
+  * @param name Shared memory object name.
+  * @param size Bytes to map.
+  * @return The mapping, or MAP_FAILED if the object is missing, smaller
+  * than `size` or not announced yet.
+  *
+  * @ingroup philosopher_top
+  */
+ static t_live_page	*map_page(const char *name, size_t size)
+ {
+	 t_live_page	*page;
+	 struct stat	status;
+	 int			fd;
+ 
+	 page = MAP_FAILED;
+	 fd = shm_open(name, O_RDONLY, 0);
+	 if (fd != -1 && fstat(fd, &status) == 0
+		 && status.st_size >= (off_t)size)
+		 page = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+	 if (fd != -1)
+		 close(fd);
+	 if (page != MAP_FAILED
+		 && __atomic_load_n(&page->version, __ATOMIC_ACQUIRE) != LIVE_VERSION)
+	 {
+		 munmap(page, size);
+		 page = MAP_FAILED;
+	 }
+	 return (page);
+ }
+ 
+ /**
+  * @brief Attach to the stats page once `philo` has created it.
+  *
+  * @details
+  * Waits up to TOP_ATTACH_MS, so the viewer may be started first. The
+  * header is mapped alone to learn the number of seats, then the whole
+  * page.
+  *
+  * @param name Shared memory object name.
+  * @param size Receives the size of the mapping.
+  * @return The mapping, or MAP_FAILED.
+  *
+  * @ingroup philosopher_top
+  */
+ t_live_page	*attach_page(const char *name, size_t *size)
+ {
+	 t_live_page	*page;
+	 int			waited;
+ 
+	 page = MAP_FAILED;
+	 waited = 0;
+	 while (page == MAP_FAILED && waited++ < TOP_ATTACH_MS)
+	 {
+		 page = map_page(name, sizeof(t_live_page));
+		 if (page == MAP_FAILED)
+		 {
+			 usleep(1000);
+			 continue ;
+		 }
+		 *size = sizeof(t_live_page) + page->seat_count * sizeof(t_live_seat);
+		 munmap(page, sizeof(t_live_page));
+		 page = map_page(name, *size);
+	 }
+	 return (page);
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,69 @@
+/**
+ * @file snapshot.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Copy of the seats a `philo-top` frame is drawn from.
+ *
+ * @details
+ * The copy is taken as quickly as possible and read with relaxed atomic
+ * loads, so the page is never touched while sorting or printing.
+ *
+ * @ingroup philosopher_top
+ */
+
+ #include "../../include/philo_top.h"
+ #include <sys/time.h>
+
+ /**
+  * @internal
+  * @brief Copy one seat, field by field.
+  *
+  * @param to Copy.
+  * @param from Seat of the page.
+  *
+  * @ingroup philosopher_top
+  */
+ static void	copy_seat(t_live_seat *to, const t_live_seat *from)
+ {
+	 to->state = __atomic_load_n(&from->state, __ATOMIC_RELAXED);
+	 to->forks = __atomic_load_n(&from->forks, __ATOMIC_RELAXED);
+	 to->meals = __atomic_load_n(&from->meals, __ATOMIC_RELAXED);
+	 to->since = __atomic_load_n(&from->since, __ATOMIC_RELAXED);
+	 to->last_meal = __atomic_load_n(&from->last_meal, __ATOMIC_RELAXED);
+ }
+ 
+ /**
+  * @brief Copy every seat out of the page and work out its slack.
+  *
+  * @param page Mapped stats page.
+  * @param rows One row per seat.
+  * @return The time of the frame, in ms since the start: now, when the
+  * dinner ended, or 0 while the guests are still being seated.
+  *
+  * @ingroup philosopher_top
+  */
+ long long	copy_rows(const t_live_page *page, t_top_row *rows)
+ {
+	 struct timeval	now;
+	 long long		start;
+	 long long		at;
+	 uint32_t		i;
+ 
+	 gettimeofday(&now, NULL);
+	 start = __atomic_load_n(&page->start_time, __ATOMIC_ACQUIRE);
+	 at = 0;
+	 if (start)
+		 at = now.tv_sec * 1000LL + now.tv_usec / 1000 - start;
+	 if (__atomic_load_n(&page->closed, __ATOMIC_ACQUIRE))
+		 at = page->closed_at;
+	 i = 0;
+	 while (i < page->seat_count)
+	 {
+		 rows[i].id = i + 1;
+		 copy_seat(&rows[i].seat, &page->seats[i]);
+		 rows[i].slack = page->time_to_die - (at - rows[i].seat.last_meal);
+		 i++;
+	 }
+	 return (at);
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,88 @@
+/**
+ * @file summary.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Summary lines at the top of a `philo-top` frame.
+ *
+ * @ingroup philosopher_top
+ */
+
+ #include "../../include/philo_top.h"
+ #include <stdio.h>
+ #include <string.h>
+
+ /**
+  * @internal
+  * @brief Count the meals, states and forks in use of a frame.
+  *
+  * @param page Mapped stats page.
+  * @param rows Rows copied for the frame.
+  * @param meals Receives the total, the fewest and the most meals.
+  * @param states Receives the number of seats per TRACE_* kind.
+  * @return The number of forks in use.
+  *
+  * @ingroup philosopher_top
+  */
+ static int	count_rows(const t_live_page *page, const t_top_row *rows,
+		 long long meals[3], int states[5])
+ {
+	 int			forks;
+	 uint32_t	i;
+ 
+	 meals[0] = 0;
+	 meals[1] = rows[0].seat.meals;
+	 meals[2] = rows[0].seat.meals;
+	 memset(states, 0, 5 * sizeof(*states));
+	 forks = 0;
+	 i = 0;
+	 while (i < page->seat_count)
+	 {
+		 meals[0] += rows[i].seat.meals;
+		 if (rows[i].seat.meals < meals[1])
+			 meals[1] = rows[i].seat.meals;
+		 if (rows[i].seat.meals > meals[2])
+			 meals[2] = rows[i].seat.meals;
+		 states[rows[i].seat.state % 5]++;
+		 if (rows[i].seat.forks & LIVE_LEFT)
+			 forks++;
+		 if (rows[i].seat.forks & LIVE_RIGHT)
+			 forks++;
+		 i++;
+	 }
+	 return (forks);
+ }
+ 
+ /**
+  * @brief Print the two summary lines of a frame.
+  *
+  * @param page Mapped stats page.
+  * @param rows Rows copied for the frame.
+  * @param at Time of the frame (ms since the start).
+  * @param name Shared memory object name.
+  *
+  * @ingroup philosopher_top
+  */
+ void	print_summary(const t_live_page *page, const t_top_row *rows,
+		 long long at, const char *name)
+ {
+	 long long	meals[3];
+	 int			states[5];
+	 int			forks;
+ 
+	 forks = count_rows(page, rows, meals, states);
+	 printf("philo-top: %s, %u philosophers, %d/%d/%d ms", name,
+		 page->seat_count, page->time_to_die, page->time_to_eat,
+		 page->time_to_sleep);
+	 if (page->must_eat >= 0)
+		 printf(", %d meals each", page->must_eat);
+	 printf(", at %.3f s", at / 1e3);
+	 if (page->closed && page->closer)
+		 printf(", over: philosopher %d died", page->closer);
+	 else if (page->closed)
+		 printf(", over");
+	 printf("\n%lld meals (%lld to %lld each), %d eating, %d sleeping, "
+		 "%d thinking, %d of %u forks in use\n\n", meals[0], meals[1],
+		 meals[2], states[TRACE_EAT], states[TRACE_SLEEP], states[TRACE_THINK],
+		 forks, page->seat_count);
+ }
+ 
\ No newline at end of file
@@ -0,0 +1,165 @@
+/**
+ * @file top.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Entry point of the `philo-top` live viewer.
+ *
+ * @details
+ * Usage: `philo-top [-m name] [-d ms] [-n frames] [-s slack|id|meals]
+ * [-l rows] [-b]`. Waits for the stats page of a `philo --live` run,
+ * then draws a frame every `-d` ms until the dinner is over, drawing the
+ * final state once more, or until `-n` frames are drawn. Exits with 0
+ * once done, 1 on usage errors and 2 if no page could be attached.
+ *
+ * @ingroup philosopher_top
+ */
+
+ #include "../../include/philo_top.h"
+ #include <stdio.h>
+ #include <stdlib.h>
+ #include <string.h>
+ #include <sys/mman.h>
+ #include <unistd.h>
+
+ /**
+  * @internal
+  * @brief Print the usage message to stderr.
+  *
+  * @ingroup philosopher_top
+  */
+ static void	top_usage(void)
+ {
+	 fprintf(stderr, "Usage: philo-top [-m name] [-d delay_ms] [-n frames]"
+		 " [-s slack|id|meals] [-l rows] [-b]\n"
+		 "  -m  stats page of philo --live=/name (default " LIVE_NAME ")\n"
+		 "  -n  stop after this many frames (default: when the dinner ends)\n"
+		 "  -s  hungriest first (default), by ID, or most fed first\n"
+		 "  -b  append frames instead of redrawing the terminal\n");
+ }
+ 
+ /**
+  * @internal
+  * @brief Apply one option to the viewer's settings.
+  *
+  * @param top Settings being filled.
+  * @param opt Option character.
+  * @param arg Option argument (NULL for `-b`).
+  * @return 0 on success, -1 on an unknown option or sort order.
+  *
+  * @ingroup philosopher_top
+  */
+ static int	apply_top_option(t_top *top, int opt, char *arg)
+ {
+	 if (opt == 'm')
+		 top->name = arg;
+	 else if (opt == 'd')
+		 top->delay = atoi(arg);
+	 else if (opt == 'n')
+		 top->frames = atoi(arg);
+	 else if (opt == 's' && !strcmp(arg, "id"))
+		 top->sort = TOP_BY_ID;
+	 else if (opt == 's' && !strcmp(arg, "meals"))
+		 top->sort = TOP_BY_MEALS;
+	 else if (opt == 'l')
+		 top->rows = atoi(arg);
+	 else if (opt == 'b')
+		 top->batch = true;
+	 else if (opt != 's' || strcmp(arg, "slack"))
+		 return (-1);
+	 return (0);
+ }
+ 
+ /**
+  * @internal
+  * @brief Parse the options into the viewer's settings.
+  *
+  * @param top Settings to fill.
+  * @param argc Argument count.
+  * @param argv Argument vector.
+  * @return 0 on success, -1 on a usage error.
+  *
+  * @ingroup philosopher_top
+  */
+ static int	parse_top_options(t_top *top, int argc, char **argv)
+ {
+	 int	opt;
+ 
+	 *top = (t_top){LIVE_NAME, 1000, 0, TOP_BY_SLACK, 20, false};
+	 opt = getopt(argc, argv, "m:d:n:s:l:b");
+	 while (opt != -1)
+	 {
+		 if (apply_top_option(top, opt, optarg) == -1)
+			 return (-1);
+		 opt = getopt(argc, argv, "m:d:n:s:l:b");
+	 }
+	 if (optind != argc || top->delay < 1 || top->frames < 0 || top->rows < 0)
+		 return (-1);
+	 return (0);
+ }
+ 
+ /**
+  * @internal
+  * @brief Draw frames until the dinner is over or enough were drawn.
+  *
+  * @details
+  * The frame that sees the page closed is the last one, so the final
+  * state is always shown.
+  *
+  * @param top Viewer settings.
+  * @param page Mapped stats page.
+  * @param rows Room for one row per seat.
+  *
+  * @ingroup philosopher_top
+  */
+ static void	watch(const t_top *top, const t_live_page *page, t_top_row *rows)
+ {
+	 int		drawn;
+	 bool	closed;
+ 
+	 drawn = 0;
+	 while (!top->frames || drawn++ < top->frames)
+	 {
+		 closed = __atomic_load_n(&page->closed, __ATOMIC_ACQUIRE);
+		 draw_frame(top, page, rows);
+		 if (closed)
+			 break ;
+		 usleep(top->delay * 1000);
+	 }
+ }
+ 
+ /**
+  * @brief Watch a `philo --live` dinner.
+  *
+  * @param argc Argument count.
+  * @param argv Argument vector.
+  * @return 0 once done, 1 on usage errors, 2 if no page was found.
+  *
+  * @ingroup philosopher_top
+  */
+ int	main(int argc, char **argv)
+ {
+	 t_top		top;
+	 t_live_page	*page;
+	 t_top_row	*rows;
+	 size_t		size;
+ 
+	 if (parse_top_options(&top, argc, argv) == -1)
+	 {
+		 top_usage();
+		 return (1);
+	 }
+	 page = attach_page(top.name, &size);
+	 rows = NULL;
+	 if (page != MAP_FAILED)
+		 rows = malloc(page->seat_count * sizeof(*rows));
+	 if (!rows)
+	 {
+		 fprintf(stderr, "philo-top: no stats page at %s\n", top.name);
+		 return (2);
+	 }
+	 watch(&top, page, rows);
+	 free(rows);
+	 munmap(page, size);
+	 return (0);
+ }
+ 
\ No newline at end of file
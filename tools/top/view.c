@@ -0,0 +1,135 @@
+/**
+ * @file view.c
+ * @author Toonsa
+ * @date 2026/10/18
+ * @brief Frames of the `philo-top` viewer.
+ *
+ * @details
+ * Every frame starts from a copy of the seats (see snapshot.c), sorted
+ * and printed without touching the page again.
+ *
+ * @ingroup philosopher_top
+ */
+
+ #define _GNU_SOURCE
+ #include "../../include/philo_top.h"
+ #include <stdio.h>
+ #include <stdlib.h>
+ 
+ /**
+  * @internal
+  * @brief Name a seat's state as shown in the STATE column.
+  *
+  * @param state TRACE_* kind, or 0 before the first action.
+  * @return The state's name.
+  *
+  * @ingroup philosopher_top
+  */
+ static const char	*state_name(uint32_t state)
+ {
+	 if (state == TRACE_EAT)
+		 return ("eating");
+	 if (state == TRACE_SLEEP)
+		 return ("sleeping");
+	 if (state == TRACE_THINK)
+		 return ("thinking");
+	 if (state == TRACE_DIE)
+		 return ("died");
+	 return ("seated");
+ }
+ 
+ /**
+  * @internal
+  * @brief Order rows by the viewer's sort key, then by ID.
+  *
+  * @details
+  * Hungriest first (smallest slack) by slack, most fed first by meals.
+  *
+  * @param a First row.
+  * @param b Second row.
+  * @param sort One of the TOP_BY_* orders.
+  * @return Negative, zero or positive, as `qsort_r` expects.
+  *
+  * @ingroup philosopher_top
+  */
+ static int	compare_rows(const void *a, const void *b, void *sort)
+ {
+	 const t_top_row	*x;
+	 const t_top_row	*y;
+	 long long		diff;
+ 
+	 x = a;
+	 y = b;
+	 diff = 0;
+	 if (*(int *)sort == TOP_BY_SLACK)
+		 diff = x->slack - y->slack;
+	 else if (*(int *)sort == TOP_BY_MEALS)
+		 diff = (long long)y->seat.meals - x->seat.meals;
+	 if (diff == 0)
+		 diff = x->id - y->id;
+	 return ((diff > 0) - (diff < 0));
+ }
+ 
+ /**
+  * @internal
+  * @brief Print the line of one philosopher.
+  *
+  * @param page Mapped stats page.
+  * @param row The philosopher's row.
+  * @param at Time of the frame (ms since the start).
+  *
+  * @ingroup philosopher_top
+  */
+ static void	print_row(const t_live_page *page, const t_top_row *row,
+		 long long at)
+ {
+	 printf("%6d %-9s %8lld %6u %10lld %9lld  ", row->id,
+		 state_name(row->seat.state), at - row->seat.since, row->seat.meals,
+		 (long long)row->seat.last_meal, row->slack);
+	 if (row->seat.forks & LIVE_LEFT)
+		 printf("%d ", row->id - 1);
+	 else
+		 printf("- ");
+	 if (row->seat.forks & LIVE_RIGHT)
+		 printf("%u\n", row->id % page->seat_count);
+	 else
+		 printf("-\n");
+ }
+ 
+ /**
+  * @brief Copy the page, sort it and print one frame.
+  *
+  * @details
+  * Outside batch mode the terminal is cleared first, so that frames
+  * replace each other. Only the first `rows` philosophers in the sort
+  * order are listed; FORKS shows the index of each fork held, `-` for
+  * one that is not.
+  *
+  * @param top Viewer settings.
+  * @param page Mapped stats page.
+  * @param rows Room for one row per seat.
+  *
+  * @ingroup philosopher_top
+  */
+ void	draw_frame(const t_top *top, const t_live_page *page, t_top_row *rows)
+ {
+	 long long	at;
+	 uint32_t	i;
+ 
+	 at = copy_rows(page, rows);
+	 qsort_r(rows, page->seat_count, sizeof(*rows), compare_rows,
+		 (void *)&top->sort);
+	 if (!top->batch)
+		 printf("\033[H\033[2J");
+	 print_summary(page, rows, at, top->name);
+	 printf("%6s %-9s %8s %6s %10s %9s  %s\n", "ID", "STATE", "FOR_MS",
+		 "MEALS", "LAST_MEAL", "SLACK_MS", "FORKS");
+	 i = 0;
+	 while (i < page->seat_count && i < (uint32_t)top->rows)
+	 {
+		 print_row(page, &rows[i], at);
+		 i++;
+	 }
+	 fflush(stdout);
+ }
+ 
\ No newline at end of file